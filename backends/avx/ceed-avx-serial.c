@@ -27,7 +27,9 @@ static int CeedInit_Avx(const char *resource, Ceed ceed) {
   CeedCallBackend(CeedSetDelegate(ceed, ceed_ref));
   CeedCallBackend(CeedDestroy(&ceed_ref));
 
-  CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "TensorContractCreate", CeedTensorContractCreate_Avx));
+  // Use the widest vector unit of the host
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "TensorContractCreate",
+                                         (CeedAvxSupportsAvx512() ? CeedTensorContractCreate_Avx512 : CeedTensorContractCreate_Avx)));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -10,6 +10,8 @@
 #include <immintrin.h>
 #include <stdbool.h>
 
+#include "ceed-avx.h"
+
 #ifdef CEED_SCALAR_IS_FP64
 #define rtype __m256d
 #define loadu _mm256_loadu_pd
@@ -22,6 +24,13 @@
 #else
 #define fmadd(c, a, b) (c) += _mm256_mul_pd((a), (b))
 #endif
+// Full column tiles use the same registers
+#define btype rtype
+#define bloadu loadu
+#define bstoreu storeu
+#define bset1 set1
+#define bfmadd fmadd
+#define blanes 4
 #else
 #define rtype __m128
 #define loadu _mm_loadu_ps
@@ -34,6 +43,35 @@
 #else
 #define fmadd(c, a, b) (c) += _mm_mul_ps((a), (b))
 #endif
+// Full column tiles use 256-bit registers
+#define btype __m256
+#define bloadu _mm256_loadu_ps
+#define bstoreu _mm256_storeu_ps
+#define bset1 _mm256_set1_ps
+#ifdef __FMA__
+#define bfmadd(c, a, b) (c) = _mm256_fmadd_ps((a), (b), (c))
+#else
+#define bfmadd(c, a, b) (c) = _mm256_add_ps((c), _mm256_mul_ps((a), (b)))
+#endif
+#define blanes 8
+#endif
+
+#ifdef CEED_AVX_HAS_AVX512
+#ifdef CEED_SCALAR_IS_FP64
+#define ztype __m512d
+#define zloadu _mm512_loadu_pd
+#define zstoreu _mm512_storeu_pd
+#define zset1 _mm512_set1_pd
+#define zfmadd(c, a, b) (c) = _mm512_fmadd_pd((a), (b), (c))
+#define zlanes 8
+#else
+#define ztype __m512
+#define zloadu _mm512_loadu_ps
+#define zstoreu _mm512_storeu_ps
+#define zset1 _mm512_set1_ps
+#define zfmadd(c, a, b) (c) = _mm512_fmadd_ps((a), (b), (c))
+#define zlanes 16
+#endif
 #endif
 
 //------------------------------------------------------------------------------
@@ -53,20 +91,20 @@ static inline int CeedTensorContract_Avx_Blocked(CeedTensorContract contract, Ce
     // Blocks of 4 rows
     for (CeedInt j = 0; j < (J / JJ) * JJ; j += JJ) {
       for (CeedInt c = 0; c < (C / CC) * CC; c += CC) {
-        rtype vv[JJ][CC / 4];  // Output tile to be held in registers
+        btype vv[JJ][CC / blanes];  // Output tile to be held in registers
         for (CeedInt jj = 0; jj < JJ; jj++) {
-          for (CeedInt cc = 0; cc < CC / 4; cc++) vv[jj][cc] = loadu(&v[(a * J + j + jj) * C + c + cc * 4]);
+          for (CeedInt cc = 0; cc < CC / blanes; cc++) vv[jj][cc] = bloadu(&v[(a * J + j + jj) * C + c + cc * blanes]);
         }
         for (CeedInt b = 0; b < B; b++) {
           for (CeedInt jj = 0; jj < JJ; jj++) {  // unroll
-            rtype tqv = set1(t[(j + jj) * t_stride_0 + b * t_stride_1]);
-            for (CeedInt cc = 0; cc < CC / 4; cc++) {  // unroll
-              fmadd(vv[jj][cc], tqv, loadu(&u[(a * B + b) * C + c + cc * 4]));
+            btype tqv = bset1(t[(j + jj) * t_stride_0 + b * t_stride_1]);
+            for (CeedInt cc = 0; cc < CC / blanes; cc++) {  // unroll
+              bfmadd(vv[jj][cc], tqv, bloadu(&u[(a * B + b) * C + c + cc * blanes]));
             }
           }
         }
         for (CeedInt jj = 0; jj < JJ; jj++) {
-          for (CeedInt cc = 0; cc < CC / 4; cc++) storeu(&v[(a * J + j + jj) * C + c + cc * 4], vv[jj][cc]);
+          for (CeedInt cc = 0; cc < CC / blanes; cc++) bstoreu(&v[(a * J + j + jj) * C + c + cc * blanes], vv[jj][cc]);
         }
       }
     }
@@ -75,22 +113,22 @@ static inline int CeedTensorContract_Avx_Blocked(CeedTensorContract contract, Ce
 
     if (j < J) {
       for (CeedInt c = 0; c < (C / CC) * CC; c += CC) {
-        rtype vv[JJ][CC / 4];  // Output tile to be held in registers
+        btype vv[JJ][CC / blanes];  // Output tile to be held in registers
 
         for (CeedInt jj = 0; jj < J - j; jj++) {
-          for (CeedInt cc = 0; cc < CC / 4; cc++) vv[jj][cc] = loadu(&v[(a * J + j + jj) * C + c + cc * 4]);
+          for (CeedInt cc = 0; cc < CC / blanes; cc++) vv[jj][cc] = bloadu(&v[(a * J + j + jj) * C + c + cc * blanes]);
         }
         for (CeedInt b = 0; b < B; b++) {
           for (CeedInt jj = 0; jj < J - j; jj++) {  // doesn't unroll
-            rtype tqv = set1(t[(j + jj) * t_stride_0 + b * t_stride_1]);
+            btype tqv = bset1(t[(j + jj) * t_stride_0 + b * t_stride_1]);
 
-            for (CeedInt cc = 0; cc < CC / 4; cc++) {  // unroll
-              fmadd(vv[jj][cc], tqv, loadu(&u[(a * B + b) * C + c + cc * 4]));
+            for (CeedInt cc = 0; cc < CC / blanes; cc++) {  // unroll
+              bfmadd(vv[jj][cc], tqv, bloadu(&u[(a * B + b) * C + c + cc * blanes]));
             }
           }
         }
         for (CeedInt jj = 0; jj < J - j; jj++) {
-          for (CeedInt cc = 0; cc < CC / 4; cc++) storeu(&v[(a * J + j + jj) * C + c + cc * 4], vv[jj][cc]);
+          for (CeedInt cc = 0; cc < CC / blanes; cc++) bstoreu(&v[(a * J + j + jj) * C + c + cc * blanes], vv[jj][cc]);
         }
       }
     }
@@ -98,6 +136,71 @@ static inline int CeedTensorContract_Avx_Blocked(CeedTensorContract contract, Ce
   return CEED_ERROR_SUCCESS;
 }
 
+#ifdef CEED_AVX_HAS_AVX512
+//------------------------------------------------------------------------------
+// Blocked Tensor Contract - AVX-512
+//------------------------------------------------------------------------------
+CEED_AVX512_TARGET static inline int CeedTensorContract_Avx512_Blocked(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J,
+                                                                       const CeedScalar *restrict t, CeedTransposeMode t_mode, const CeedInt add,
+                                                                       const CeedScalar *restrict u, CeedScalar *restrict v, const CeedInt JJ,
+                                                                       const CeedInt CC) {
+  CeedInt t_stride_0 = B, t_stride_1 = 1;
+
+  if (t_mode == CEED_TRANSPOSE) {
+    t_stride_0 = 1;
+    t_stride_1 = J;
+  }
+
+  for (CeedInt a = 0; a < A; a++) {
+    // Blocks of 4 rows
+    for (CeedInt j = 0; j < (J / JJ) * JJ; j += JJ) {
+      for (CeedInt c = 0; c < (C / CC) * CC; c += CC) {
+        ztype vv[JJ][CC / zlanes];  // Output tile to be held in registers
+        for (CeedInt jj = 0; jj < JJ; jj++) {
+          for (CeedInt cc = 0; cc < CC / zlanes; cc++) vv[jj][cc] = zloadu(&v[(a * J + j + jj) * C + c + cc * zlanes]);
+        }
+        for (CeedInt b = 0; b < B; b++) {
+          for (CeedInt jj = 0; jj < JJ; jj++) {  // unroll
+            ztype tqv = zset1(t[(j + jj) * t_stride_0 + b * t_stride_1]);
+            for (CeedInt cc = 0; cc < CC / zlanes; cc++) {  // unroll
+              zfmadd(vv[jj][cc], tqv, zloadu(&u[(a * B + b) * C + c + cc * zlanes]));
+            }
+          }
+        }
+        for (CeedInt jj = 0; jj < JJ; jj++) {
+          for (CeedInt cc = 0; cc < CC / zlanes; cc++) zstoreu(&v[(a * J + j + jj) * C + c + cc * zlanes], vv[jj][cc]);
+        }
+      }
+    }
+    // Remainder of rows
+    const CeedInt j = (J / JJ) * JJ;
+
+    if (j < J) {
+      for (CeedInt c = 0; c < (C / CC) * CC; c += CC) {
+        ztype vv[JJ][CC / zlanes];  // Output tile to be held in registers
+
+        for (CeedInt jj = 0; jj < J - j; jj++) {
+          for (CeedInt cc = 0; cc < CC / zlanes; cc++) vv[jj][cc] = zloadu(&v[(a * J + j + jj) * C + c + cc * zlanes]);
+        }
+        for (CeedInt b = 0; b < B; b++) {
+          for (CeedInt jj = 0; jj < J - j; jj++) {  // doesn't unroll
+            ztype tqv = zset1(t[(j + jj) * t_stride_0 + b * t_stride_1]);
+
+            for (CeedInt cc = 0; cc < CC / zlanes; cc++) {  // unroll
+              zfmadd(vv[jj][cc], tqv, zloadu(&u[(a * B + b) * C + c + cc * zlanes]));
+            }
+          }
+        }
+        for (CeedInt jj = 0; jj < J - j; jj++) {
+          for (CeedInt cc = 0; cc < CC / zlanes; cc++) zstoreu(&v[(a * J + j + jj) * C + c + cc * zlanes], vv[jj][cc]);
+        }
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+#endif
+
 //------------------------------------------------------------------------------
 // Serial Tensor Contract Remainder
 //------------------------------------------------------------------------------
@@ -264,6 +367,18 @@ static int CeedTensorContract_Avx_Single_4_8(CeedTensorContract contract, CeedIn
   return CeedTensorContract_Avx_Single(contract, A, B, C, J, t, t_mode, add, u, v, 4, 8);
 }
 
+#ifdef CEED_AVX_HAS_AVX512
+CEED_AVX512_TARGET static int CeedTensorContract_Avx512_Blocked_8_Z(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J,
+                                                                   const CeedScalar *restrict t, CeedTransposeMode t_mode, const CeedInt add,
+                                                                   const CeedScalar *restrict u, CeedScalar *restrict v) {
+  return CeedTensorContract_Avx512_Blocked(contract, A, B, C, J, t, t_mode, add, u, v, 8, zlanes);
+}
+static int CeedTensorContract_Avx_Remainder_8_Z(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+                                                CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u, CeedScalar *restrict v) {
+  return CeedTensorContract_Avx_Remainder(contract, A, B, C, J, t, t_mode, add, u, v, 8, zlanes);
+}
+#endif
+
 //------------------------------------------------------------------------------
 // Tensor Contract Apply
 //------------------------------------------------------------------------------
@@ -287,6 +402,43 @@ static int CeedTensorContractApply_Avx(CeedTensorContract contract, CeedInt A, C
   return CEED_ERROR_SUCCESS;
 }
 
+#ifdef CEED_AVX_HAS_AVX512
+//------------------------------------------------------------------------------
+// Tensor Contract Apply - AVX-512
+//------------------------------------------------------------------------------
+static int CeedTensorContractApply_Avx512(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+                                          CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u, CeedScalar *restrict v) {
+  const CeedInt blk_size = zlanes;
+
+  if (!add) {
+    for (CeedInt q = 0; q < A * J * C; q++) v[q] = (CeedScalar)0.0;
+  }
+
+  if (C == 1) {
+    // Serial C=1 Case
+    CeedTensorContract_Avx_Single_4_8(contract, A, B, C, J, t, t_mode, true, u, v);
+  } else {
+    // Blocks of one 512-bit register of columns
+    if (C >= blk_size) CeedTensorContract_Avx512_Blocked_8_Z(contract, A, B, C, J, t, t_mode, true, u, v);
+    // Remainder of columns
+    if (C % blk_size) CeedTensorContract_Avx_Remainder_8_Z(contract, A, B, C, J, t, t_mode, true, u, v);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+#endif
+
+//------------------------------------------------------------------------------
+// Host Vector Width
+//------------------------------------------------------------------------------
+bool CeedAvxSupportsAvx512(void) {
+#ifdef CEED_AVX_HAS_AVX512
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx512f");
+#else
+  return false;
+#endif
+}
+
 //------------------------------------------------------------------------------
 // Tensor Contract Create
 //------------------------------------------------------------------------------
@@ -295,4 +447,14 @@ int CeedTensorContractCreate_Avx(CeedTensorContract contract) {
   return CEED_ERROR_SUCCESS;
 }
 
+int CeedTensorContractCreate_Avx512(CeedTensorContract contract) {
+#ifdef CEED_AVX_HAS_AVX512
+  CeedCallBackend(
+      CeedSetBackendFunction(CeedTensorContractReturnCeed(contract), "TensorContract", contract, "Apply", CeedTensorContractApply_Avx512));
+  return CEED_ERROR_SUCCESS;
+#else
+  return CeedTensorContractCreate_Avx(contract);
+#endif
+}
+
 //------------------------------------------------------------------------------
@@ -8,5 +8,15 @@
 
 #include <ceed.h>
 #include <ceed/backend.h>
+#include <stdbool.h>
+
+// AVX-512 kernels are compiled with function target attributes and selected at runtime
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CEED_AVX_HAS_AVX512
+#define CEED_AVX512_TARGET __attribute__((target("avx512f")))
+#endif
+
+CEED_INTERN bool CeedAvxSupportsAvx512(void);
 
 CEED_INTERN int CeedTensorContractCreate_Avx(CeedTensorContract contract);
+CEED_INTERN int CeedTensorContractCreate_Avx512(CeedTensorContract contract);
@@ -430,10 +430,12 @@ static inline int CeedOperatorRestoreInputs_Blocked(CeedInt num_input_fields, Ce
 // Operator Apply
 //------------------------------------------------------------------------------
 static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  bool                  is_profiling;
   CeedInt               Q, num_input_fields, num_output_fields, num_elem, size;
   const CeedInt         block_size = 8;
   CeedEvalMode          eval_mode;
-  CeedScalar           *e_data_full[2 * CEED_FIELD_MAX] = {0};
+  double                time, phase_times[CEED_OPERATOR_NUM_PHASES] = {0.0};
+  CeedScalar           *e_data_full[2 * CEED_FIELD_MAX]             = {0};
   CeedQFunctionField   *qf_input_fields, *qf_output_fields;
   CeedQFunction         qf;
   CeedOperatorField    *op_input_fields, *op_output_fields;
@@ -443,11 +445,18 @@ static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector in_vec, Ceed
   CeedCallBackend(CeedOperatorSetup_Blocked(op));
 
   CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorIsProfiling(op, &is_profiling));
+  if (is_profiling) CeedCallBackend(CeedOperatorProfileLap(&time, NULL));
 
   // Restriction only operator
   if (impl->is_identity_rstr_op) {
     CeedCallBackend(CeedElemRestrictionApply(impl->block_rstr[0], CEED_NOTRANSPOSE, in_vec, impl->e_vecs_full[0], request));
+    if (is_profiling) CeedCallBackend(CeedOperatorProfileLap(&time, &phase_times[CEED_OPERATOR_PHASE_INPUT_RESTRICTION]));
     CeedCallBackend(CeedElemRestrictionApply(impl->block_rstr[1], CEED_TRANSPOSE, impl->e_vecs_full[0], out_vec, request));
+    if (is_profiling) {
+      CeedCallBackend(CeedOperatorProfileLap(&time, &phase_times[CEED_OPERATOR_PHASE_OUTPUT_RESTRICTION]));
+      CeedCallBackend(CeedOperatorAddProfile(op, phase_times));
+    }
     return CEED_ERROR_SUCCESS;
   }
   CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
@@ -459,6 +468,7 @@ static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector in_vec, Ceed
 
   // Input Evecs and Restriction
   CeedCallBackend(CeedOperatorSetupInputs_Blocked(num_input_fields, qf_input_fields, op_input_fields, in_vec, false, e_data_full, impl, request));
+  if (is_profiling) CeedCallBackend(CeedOperatorProfileLap(&time, &phase_times[CEED_OPERATOR_PHASE_INPUT_RESTRICTION]));
 
   // Output Evecs
   for (CeedInt i = num_output_fields - 1; i >= 0; i--) {
@@ -483,15 +493,18 @@ static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector in_vec, Ceed
 
     // Input basis apply
     CeedCallBackend(CeedOperatorInputBasis_Blocked(e, Q, qf_input_fields, op_input_fields, num_input_fields, block_size, false, e_data_full, impl));
+    if (is_profiling) CeedCallBackend(CeedOperatorProfileLap(&time, &phase_times[CEED_OPERATOR_PHASE_INPUT_BASIS]));
 
     // Q function
     if (!impl->is_identity_qf) {
       CeedCallBackend(CeedQFunctionApply(qf, Q * block_size, impl->q_vecs_in, impl->q_vecs_out));
     }
+    if (is_profiling) CeedCallBackend(CeedOperatorProfileLap(&time, &phase_times[CEED_OPERATOR_PHASE_QFUNCTION]));
 
     // Output basis apply
     CeedCallBackend(CeedOperatorOutputBasis_Blocked(e, Q, qf_output_fields, op_output_fields, block_size, num_input_fields, num_output_fields,
                                                     impl->apply_add_basis_out, op, e_data_full, impl));
+    if (is_profiling) CeedCallBackend(CeedOperatorProfileLap(&time, &phase_times[CEED_OPERATOR_PHASE_OUTPUT_BASIS]));
   }
 
   // Output restriction
@@ -512,10 +525,12 @@ static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector in_vec, Ceed
         CeedElemRestrictionApply(impl->block_rstr[i + impl->num_inputs], CEED_TRANSPOSE, impl->e_vecs_full[i + impl->num_inputs], vec, request));
     if (!is_active) CeedCallBackend(CeedVectorDestroy(&vec));
   }
+  if (is_profiling) CeedCallBackend(CeedOperatorProfileLap(&time, &phase_times[CEED_OPERATOR_PHASE_OUTPUT_RESTRICTION]));
 
   // Restore input arrays
   CeedCallBackend(CeedOperatorRestoreInputs_Blocked(num_input_fields, qf_input_fields, op_input_fields, false, e_data_full, impl));
   CeedCallBackend(CeedQFunctionDestroy(&qf));
+  if (is_profiling) CeedCallBackend(CeedOperatorAddProfile(op, phase_times));
   return CEED_ERROR_SUCCESS;
 }
 
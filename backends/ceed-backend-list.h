@@ -31,5 +31,6 @@ CEED_BACKEND(CeedRegister_Opt_Blocked, 1, "/cpu/self/opt/blocked")
 CEED_BACKEND(CeedRegister_Opt_Serial, 1, "/cpu/self/opt/serial")
 CEED_BACKEND(CeedRegister_Ref, 1, "/cpu/self/ref/serial")
 CEED_BACKEND(CeedRegister_Ref_Blocked, 1, "/cpu/self/ref/blocked")
+CEED_BACKEND(CeedRegister_Trace, 1, "/cpu/self/trace/")
 CEED_BACKEND(CeedRegister_Xsmm_Blocked, 1, "/cpu/self/xsmm/blocked")
 CEED_BACKEND(CeedRegister_Xsmm_Serial, 1, "/cpu/self/xsmm/serial")
@@ -8,6 +8,7 @@
 #include <ceed.h>
 #include <ceed/backend.h>
 #include <stdbool.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "ceed-opt.h"
@@ -23,15 +24,31 @@ static int CeedDestroy_Opt(Ceed ceed) {
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Backend Set Block Size
+//------------------------------------------------------------------------------
+static int CeedSetBlockSize_Opt(Ceed ceed, CeedInt block_size) {
+  Ceed_Opt *data;
+
+  CeedCheck(block_size == 1 || block_size == 4 || block_size == 8 || block_size == 16 || block_size == 32, ceed, CEED_ERROR_BACKEND,
+            "Opt backend cannot use blocksize: %" CeedInt_FMT, block_size);
+  CeedCallBackend(CeedGetData(ceed, &data));
+  data->block_size = block_size;
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Backend Init
 //------------------------------------------------------------------------------
 static int CeedInit_Opt_Blocked(const char *resource, Ceed ceed) {
   Ceed      ceed_ref;
   Ceed_Opt *data;
+  char     *resource_root;
 
-  CeedCheck(!strcmp(resource, "/cpu/self") || !strcmp(resource, "/cpu/self/opt") || !strcmp(resource, "/cpu/self/opt/blocked"), ceed,
+  CeedCallBackend(CeedGetResourceRoot(ceed, resource, ":", &resource_root));
+  CeedCheck(!strcmp(resource_root, "/cpu/self") || !strcmp(resource_root, "/cpu/self/opt") || !strcmp(resource_root, "/cpu/self/opt/blocked"), ceed,
             CEED_ERROR_BACKEND, "Opt backend cannot use resource: %s", resource);
+  CeedCallBackend(CeedFree(&resource_root));
   CeedCallBackend(CeedSetDeterministic(ceed, true));
 
   // Create reference Ceed that implementation will be dispatched through unless overridden
@@ -40,13 +57,42 @@ static int CeedInit_Opt_Blocked(const char *resource, Ceed ceed) {
   CeedCallBackend(CeedDestroy(&ceed_ref));
 
   CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "Destroy", CeedDestroy_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "SetBlockSize", CeedSetBlockSize_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "VectorCreate", CeedVectorCreate_Opt));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "TensorContractCreate", CeedTensorContractCreate_Opt));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "OperatorCreate", CeedOperatorCreate_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "CompositeOperatorCreate", CeedCompositeOperatorCreate_Opt));
 
-  // Set block size
+  // Set block size, number of threads, huge page use, mixed precision, and QFunction JiT
   CeedCallBackend(CeedCalloc(1, &data));
-  data->block_size = 8;
+  data->num_threads = 1;
+  {
+    const char *threads_spec = strstr(resource, ":threads=");
+
+    if (threads_spec) data->num_threads = atoi(threads_spec + strlen(":threads="));
+  }
+  CeedCheck(data->num_threads > 0, ceed, CEED_ERROR_BACKEND, "Opt backend cannot use %" CeedInt_FMT " threads", data->num_threads);
+  {
+    const char *huge_pages_spec = strstr(resource, ":huge_pages=");
+
+    if (huge_pages_spec) data->use_huge_pages = atoi(huge_pages_spec + strlen(":huge_pages="));
+  }
+  {
+    const char *mixed_precision_spec = strstr(resource, ":mixed_precision=");
+
+    if (mixed_precision_spec) data->use_mixed_precision = atoi(mixed_precision_spec + strlen(":mixed_precision="));
+  }
+  {
+    const char *jit_spec = strstr(resource, ":jit=");
+
+    if (jit_spec) data->use_jit = atoi(jit_spec + strlen(":jit="));
+  }
   CeedCallBackend(CeedSetData(ceed, data));
+  {
+    const char *block_size_spec = strstr(resource, ":block_size=");
+
+    CeedCallBackend(CeedSetBlockSize_Opt(ceed, block_size_spec ? atoi(block_size_spec + strlen(":block_size=")) : CEED_OPT_DEFAULT_BLOCK_SIZE));
+  }
   return CEED_ERROR_SUCCESS;
 }
 
@@ -10,6 +10,9 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include "ceed-opt.h"
 
@@ -17,11 +20,12 @@
 // Setup Input/Output Fields
 //------------------------------------------------------------------------------
 static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op, bool is_input, bool *skip_rstr, bool *apply_add_basis,
-                                       const CeedInt block_size, CeedElemRestriction *block_rstr, CeedVector *e_vecs_full, CeedVector *e_vecs,
-                                       CeedVector *q_vecs, CeedInt start_e, CeedInt num_fields, CeedInt Q) {
+                                       const CeedInt block_size, const CeedInt num_threads, CeedOperatorFieldInfo_Opt *fields,
+                                       CeedElemRestriction *block_rstr, CeedVector *e_vecs_full, CeedVector *e_vecs, CeedVector *q_vecs,
+                                       CeedInt start_e, CeedInt num_fields, CeedInt Q) {
   Ceed                ceed;
-  CeedSize            e_size, q_size;
-  CeedInt             num_comp, size, P;
+  CeedSize            e_size = 0, q_size = 0;
+  CeedInt             P;
   CeedQFunctionField *qf_fields;
   CeedOperatorField  *op_fields;
 
@@ -44,13 +48,18 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op, bool i
   // Loop over fields
   for (CeedInt i = 0; i < num_fields; i++) {
     CeedEvalMode eval_mode;
-    CeedBasis    basis;
+    CeedVector   vec;
 
     CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_fields[i], &eval_mode));
+    CeedCallBackend(CeedQFunctionFieldGetSize(qf_fields[i], &fields[i].size));
+    CeedCallBackend(CeedOperatorFieldGetVector(op_fields[i], &vec));
+    fields[i].is_active = vec == CEED_VECTOR_ACTIVE;
+    fields[i].eval_mode = eval_mode;
+    CeedCallBackend(CeedVectorDestroy(&vec));
     if (eval_mode != CEED_EVAL_WEIGHT) {
       Ceed                ceed_rstr;
       CeedSize            l_size;
-      CeedInt             num_elem, elem_size, comp_stride;
+      CeedInt             num_elem, elem_size, num_comp, comp_stride;
       CeedRestrictionType rstr_type;
       CeedElemRestriction rstr;
 
@@ -61,6 +70,8 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op, bool i
       CeedCallBackend(CeedElemRestrictionGetLVectorSize(rstr, &l_size));
       CeedCallBackend(CeedElemRestrictionGetNumComponents(rstr, &num_comp));
       CeedCallBackend(CeedElemRestrictionGetCompStride(rstr, &comp_stride));
+      fields[i].elem_size = elem_size;
+      fields[i].num_comp  = num_comp;
 
       CeedCallBackend(CeedElemRestrictionGetType(rstr, &rstr_type));
       switch (rstr_type) {
@@ -106,43 +117,61 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op, bool i
           // Empty case - won't occur
           break;
       }
+      // Passive inputs avoid a full E-vector when possible
+      if (is_input && !fields[i].is_active) {
+        if (rstr_type == CEED_RESTRICTION_STRIDED) {
+          bool    has_backend_strides;
+          CeedInt strides[3];
+
+          CeedCallBackend(CeedElemRestrictionHasBackendStrides(rstr, &has_backend_strides));
+          CeedCallBackend(CeedElemRestrictionGetStrides(rstr, strides));
+          fields[i].use_l_vec = block_size == 1 && (has_backend_strides || (strides[0] == 1 && strides[1] == elem_size &&
+                                                                            strides[2] == elem_size * num_comp));
+        } else {
+          fields[i].restrict_by_block = true;
+        }
+      }
       CeedCallBackend(CeedDestroy(&ceed_rstr));
       CeedCallBackend(CeedElemRestrictionDestroy(&rstr));
-      CeedCallBackend(CeedElemRestrictionCreateVector(block_rstr[i + start_e], NULL, &e_vecs_full[i + start_e]));
+      if (!fields[i].restrict_by_block && !fields[i].use_l_vec) {
+        CeedCallBackend(CeedElemRestrictionCreateVector(block_rstr[i + start_e], NULL, &e_vecs_full[i + start_e]));
+      }
     }
 
     switch (eval_mode) {
       case CEED_EVAL_NONE:
-        CeedCallBackend(CeedQFunctionFieldGetSize(qf_fields[i], &size));
-        e_size = (CeedSize)Q * size * block_size;
-        CeedCallBackend(CeedVectorCreate(ceed, e_size, &e_vecs[i]));
-        q_size = (CeedSize)Q * size * block_size;
-        CeedCallBackend(CeedVectorCreate(ceed, q_size, &q_vecs[i]));
+        e_size = (CeedSize)Q * fields[i].size * block_size;
+        q_size = (CeedSize)Q * fields[i].size * block_size;
         break;
       case CEED_EVAL_INTERP:
       case CEED_EVAL_GRAD:
       case CEED_EVAL_DIV:
       case CEED_EVAL_CURL:
-        CeedCallBackend(CeedOperatorFieldGetBasis(op_fields[i], &basis));
-        CeedCallBackend(CeedQFunctionFieldGetSize(qf_fields[i], &size));
-        CeedCallBackend(CeedBasisGetNumNodes(basis, &P));
-        CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
-        CeedCallBackend(CeedBasisDestroy(&basis));
-        e_size = (CeedSize)P * num_comp * block_size;
-        CeedCallBackend(CeedVectorCreate(ceed, e_size, &e_vecs[i]));
-        q_size = (CeedSize)Q * size * block_size;
-        CeedCallBackend(CeedVectorCreate(ceed, q_size, &q_vecs[i]));
+        CeedCallBackend(CeedOperatorFieldGetBasis(op_fields[i], &fields[i].basis));
+        CeedCallBackend(CeedBasisGetNumNodes(fields[i].basis, &P));
+        CeedCallBackend(CeedBasisGetNumComponents(fields[i].basis, &fields[i].num_comp));
+        e_size = (CeedSize)P * fields[i].num_comp * block_size;
+        q_size = (CeedSize)Q * fields[i].size * block_size;
         break;
       case CEED_EVAL_WEIGHT:  // Only on input fields
-        CeedCallBackend(CeedOperatorFieldGetBasis(op_fields[i], &basis));
+        CeedCallBackend(CeedOperatorFieldGetBasis(op_fields[i], &fields[i].basis));
         q_size = (CeedSize)Q * block_size;
-        CeedCallBackend(CeedVectorCreate(ceed, q_size, &q_vecs[i]));
-        CeedCallBackend(CeedBasisApply(basis, block_size, CEED_NOTRANSPOSE, CEED_EVAL_WEIGHT, CEED_VECTOR_NONE, q_vecs[i]));
-        CeedCallBackend(CeedBasisDestroy(&basis));
         break;
     }
-    // Initialize E-vec arrays
-    if (e_vecs[i]) CeedCallBackend(CeedVectorSetValue(e_vecs[i], 0.0));
+    // Each thread gets its own element block E-vecs and Q-vecs
+    for (CeedInt t = 0; t < num_threads; t++) {
+      CeedVector *e_vecs_t = &e_vecs[t * CEED_FIELD_MAX], *q_vecs_t = &q_vecs[t * CEED_FIELD_MAX];
+
+      if (eval_mode != CEED_EVAL_WEIGHT) {
+        CeedCallBackend(CeedVectorCreate(ceed, e_size, &e_vecs_t[i]));
+        // Initialize E-vec arrays
+        CeedCallBackend(CeedVectorSetValue(e_vecs_t[i], 0.0));
+      }
+      CeedCallBackend(CeedVectorCreate(ceed, q_size, &q_vecs_t[i]));
+      if (eval_mode == CEED_EVAL_WEIGHT) {
+        CeedCallBackend(CeedBasisApply(fields[i].basis, block_size, CEED_NOTRANSPOSE, CEED_EVAL_WEIGHT, CEED_VECTOR_NONE, q_vecs_t[i]));
+      }
+    }
   }
   // Drop duplicate restrictions
   if (is_input) {
@@ -159,8 +188,10 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op, bool i
         CeedCallBackend(CeedOperatorFieldGetVector(op_fields[j], &vec_j));
         CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_fields[j], &rstr_j));
         if (vec_i == vec_j && rstr_i == rstr_j) {
-          CeedCallBackend(CeedVectorReferenceCopy(e_vecs[i], &e_vecs[j]));
-          CeedCallBackend(CeedVectorReferenceCopy(e_vecs_full[i + start_e], &e_vecs_full[j + start_e]));
+          for (CeedInt t = 0; t < num_threads; t++) {
+            CeedCallBackend(CeedVectorReferenceCopy(e_vecs[t * CEED_FIELD_MAX + i], &e_vecs[t * CEED_FIELD_MAX + j]));
+          }
+          if (e_vecs_full[i + start_e]) CeedCallBackend(CeedVectorReferenceCopy(e_vecs_full[i + start_e], &e_vecs_full[j + start_e]));
           skip_rstr[j] = true;
         }
         CeedCallBackend(CeedVectorDestroy(&vec_j));
@@ -183,7 +214,9 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op, bool i
         CeedCallBackend(CeedOperatorFieldGetVector(op_fields[j], &vec_j));
         CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_fields[j], &rstr_j));
         if (vec_i == vec_j && rstr_i == rstr_j) {
-          CeedCallBackend(CeedVectorReferenceCopy(e_vecs[i], &e_vecs[j]));
+          for (CeedInt t = 0; t < num_threads; t++) {
+            CeedCallBackend(CeedVectorReferenceCopy(e_vecs[t * CEED_FIELD_MAX + i], &e_vecs[t * CEED_FIELD_MAX + j]));
+          }
           CeedCallBackend(CeedVectorReferenceCopy(e_vecs_full[i + start_e], &e_vecs_full[j + start_e]));
           skip_rstr[j]       = true;
           apply_add_basis[i] = true;
@@ -199,6 +232,156 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op, bool i
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Setup Element Block Coloring
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupColors_Opt(CeedOperator_Opt *impl, CeedInt num_blocks, CeedInt block_size) {
+  CeedSize       l_size_max = 0;
+  CeedInt        num_colors = 0, color_counts[65] = {0};
+  CeedInt        elem_size[CEED_FIELD_MAX], num_comp[CEED_FIELD_MAX], comp_stride[CEED_FIELD_MAX];
+  CeedInt       *block_colors            = NULL;
+  uint64_t      *node_colors             = NULL;
+  const CeedInt *offsets[CEED_FIELD_MAX] = {NULL};
+
+  // Blocks of the same color write to disjoint output L-vector entries and may be processed concurrently.
+  // Colors are assigned greedily, one bit per color; blocks conflicting with all 64 colors go in a final color processed serially.
+
+  // Output restrictions with explicit offsets
+  for (CeedInt i = 0; i < impl->num_outputs; i++) {
+    CeedSize            l_size;
+    CeedRestrictionType rstr_type;
+    CeedElemRestriction rstr = impl->block_rstr[impl->num_inputs + i];
+
+    if (impl->skip_rstr_out[i]) continue;
+    CeedCallBackend(CeedElemRestrictionGetType(rstr, &rstr_type));
+    if (rstr_type == CEED_RESTRICTION_STRIDED) continue;  // Strided restrictions never share nodes between elements
+    CeedCallBackend(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets[i]));
+    CeedCallBackend(CeedElemRestrictionGetElementSize(rstr, &elem_size[i]));
+    CeedCallBackend(CeedElemRestrictionGetNumComponents(rstr, &num_comp[i]));
+    CeedCallBackend(CeedElemRestrictionGetCompStride(rstr, &comp_stride[i]));
+    CeedCallBackend(CeedElemRestrictionGetLVectorSize(rstr, &l_size));
+    if (l_size > l_size_max) l_size_max = l_size;
+  }
+  CeedCallBackend(CeedCalloc(l_size_max, &node_colors));
+  CeedCallBackend(CeedCalloc(num_blocks, &block_colors));
+
+  // Greedy coloring
+  for (CeedInt b = 0; b < num_blocks; b++) {
+    CeedInt  color = 0;
+    uint64_t used  = 0;
+
+    for (CeedInt i = 0; i < impl->num_outputs; i++) {
+      if (!offsets[i]) continue;
+      for (CeedInt n = b * block_size * elem_size[i]; n < (b + 1) * block_size * elem_size[i]; n++) {
+        for (CeedInt k = 0; k < num_comp[i]; k++) used |= node_colors[offsets[i][n] + k * comp_stride[i]];
+      }
+    }
+    while (color < 64 && (used >> color) & 1) color++;
+    block_colors[b] = color;
+    color_counts[color]++;
+    if (color == 64) continue;
+    for (CeedInt i = 0; i < impl->num_outputs; i++) {
+      if (!offsets[i]) continue;
+      for (CeedInt n = b * block_size * elem_size[i]; n < (b + 1) * block_size * elem_size[i]; n++) {
+        for (CeedInt k = 0; k < num_comp[i]; k++) node_colors[offsets[i][n] + k * comp_stride[i]] |= (uint64_t)1 << color;
+      }
+    }
+  }
+  for (CeedInt i = 0; i < impl->num_outputs; i++) {
+    if (offsets[i]) CeedCallBackend(CeedElemRestrictionRestoreOffsets(impl->block_rstr[impl->num_inputs + i], &offsets[i]));
+  }
+  CeedCallBackend(CeedFree(&node_colors));
+
+  // Greedy colors are contiguous; move the serial color, if any, to the end
+  while (num_colors < 64 && color_counts[num_colors] > 0) num_colors++;
+  impl->has_serial_color = color_counts[64] > 0;
+  if (impl->has_serial_color) {
+    for (CeedInt b = 0; b < num_blocks; b++) {
+      if (block_colors[b] == 64) block_colors[b] = num_colors;
+    }
+    color_counts[num_colors] = color_counts[64];
+    num_colors++;
+  }
+  impl->num_colors = num_colors;
+
+  // Sort blocks by color, keeping blocks of one color in mesh order
+  CeedCallBackend(CeedCalloc(num_colors + 1, &impl->color_offsets));
+  CeedCallBackend(CeedCalloc(num_blocks, &impl->color_blocks));
+  for (CeedInt c = 0; c < num_colors; c++) impl->color_offsets[c + 1] = impl->color_offsets[c] + color_counts[c];
+  for (CeedInt c = 0; c < num_colors; c++) color_counts[c] = impl->color_offsets[c];
+  for (CeedInt b = 0; b < num_blocks; b++) impl->color_blocks[color_counts[block_colors[b]]++] = b;
+  CeedCallBackend(CeedFree(&block_colors));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Setup Per-Thread L-Vector Views
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupThreads_Opt(CeedOperator op, CeedOperator_Opt *impl) {
+  Ceed     ceed;
+  CeedSize l_size;
+
+  {
+    Ceed ceed_parent;
+
+    CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+    CeedCallBackend(CeedGetParent(ceed, &ceed_parent));
+    CeedCallBackend(CeedReferenceCopy(ceed_parent, &ceed));
+    CeedCallBackend(CeedDestroy(&ceed_parent));
+  }
+  CeedCallBackend(CeedCalloc(impl->num_threads * CEED_FIELD_MAX, &impl->l_vecs_in));
+  CeedCallBackend(CeedCalloc(impl->num_threads * CEED_FIELD_MAX, &impl->l_vecs_out));
+
+  // Inputs restricted block by block
+  for (CeedInt i = 0; i < impl->num_inputs; i++) {
+    if (!(impl->fields_in[i].is_active || impl->fields_in[i].restrict_by_block) || !impl->block_rstr[i] || impl->skip_rstr_in[i]) continue;
+    CeedCallBackend(CeedElemRestrictionGetLVectorSize(impl->block_rstr[i], &l_size));
+    for (CeedInt t = 0; t < impl->num_threads; t++) {
+      CeedCallBackend(CeedVectorCreate(ceed, l_size, &impl->l_vecs_in[t * CEED_FIELD_MAX + i]));
+    }
+  }
+  // Outputs
+  for (CeedInt i = 0; i < impl->num_outputs; i++) {
+    if (impl->skip_rstr_out[i]) continue;
+    CeedCallBackend(CeedElemRestrictionGetLVectorSize(impl->block_rstr[impl->num_inputs + i], &l_size));
+    for (CeedInt t = 0; t < impl->num_threads; t++) {
+      CeedCallBackend(CeedVectorCreate(ceed, l_size, &impl->l_vecs_out[t * CEED_FIELD_MAX + i]));
+    }
+  }
+  CeedCallBackend(CeedDestroy(&ceed));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Setup per-thread work vectors in memory local to the thread that uses them
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupFirstTouchThread_Opt(CeedOperator_Opt *impl, CeedInt t) {
+  for (CeedInt i = 0; i < CEED_FIELD_MAX; i++) {
+    CeedVector vecs[4] = {impl->e_vecs_in[t * CEED_FIELD_MAX + i], impl->e_vecs_out[t * CEED_FIELD_MAX + i], impl->q_vecs_in[t * CEED_FIELD_MAX + i],
+                          impl->q_vecs_out[t * CEED_FIELD_MAX + i]};
+
+    for (CeedInt j = 0; j < 4; j++) {
+      if (vecs[j]) CeedCallBackend(CeedVectorFirstTouch_Opt(vecs[j]));
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+static int CeedOperatorSetupFirstTouch_Opt(CeedOperator_Opt *impl) {
+  int ierr = CEED_ERROR_SUCCESS;
+
+  // Thread t handles iteration t, as in the element loop
+  CeedPragmaOMP(parallel for num_threads(impl->num_threads) schedule(static, 1))
+  for (CeedInt t = 0; t < impl->num_threads; t++) {
+    const int ierr_thread = CeedOperatorSetupFirstTouchThread_Opt(impl, t);
+
+    if (ierr_thread) {
+      CeedPragmaCritical(CeedOperatorSetupFirstTouch_Opt) ierr = ierr_thread;
+    }
+  }
+  return ierr;
+}
+
 //------------------------------------------------------------------------------
 // Setup Operator
 //------------------------------------------------------------------------------
@@ -206,7 +389,7 @@ static int CeedOperatorSetup_Opt(CeedOperator op) {
   bool                is_setup_done;
   Ceed                ceed;
   Ceed_Opt           *ceed_impl;
-  CeedInt             Q, num_input_fields, num_output_fields;
+  CeedInt             Q, num_elem, num_input_fields, num_output_fields;
   CeedQFunctionField *qf_input_fields, *qf_output_fields;
   CeedQFunction       qf;
   CeedOperatorField  *op_input_fields, *op_output_fields;
@@ -221,10 +404,17 @@ static int CeedOperatorSetup_Opt(CeedOperator op) {
   CeedCallBackend(CeedOperatorGetData(op, &impl));
   CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
   CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
   CeedCallBackend(CeedQFunctionIsIdentity(qf, &impl->is_identity_qf));
   CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
   CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
-  const CeedInt block_size = ceed_impl->block_size;
+  // Shrink the block for meshes with fewer elements than the block size to limit padding
+  CeedInt block_size = ceed_impl->block_size;
+
+  while (block_size > 1 && block_size / 2 >= num_elem) block_size /= 2;
+  impl->block_size = block_size;
+  const CeedInt num_threads = ceed_impl->num_threads;
+  const CeedInt num_blocks  = (num_elem / block_size) + !!(num_elem % block_size);
 
   // Allocate
   CeedCallBackend(CeedCalloc(num_input_fields + num_output_fields, &impl->block_rstr));
@@ -234,21 +424,37 @@ static int CeedOperatorSetup_Opt(CeedOperator op) {
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->skip_rstr_out));
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->apply_add_basis_out));
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->input_states));
-  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->e_vecs_in));
-  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->e_vecs_out));
-  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->q_vecs_in));
-  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->q_vecs_out));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->e_data_fp32));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->fields_in));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->fields_out));
+  CeedCallBackend(CeedCalloc(num_threads * CEED_FIELD_MAX, &impl->e_vecs_in));
+  CeedCallBackend(CeedCalloc(num_threads * CEED_FIELD_MAX, &impl->e_vecs_out));
+  CeedCallBackend(CeedCalloc(num_threads * CEED_FIELD_MAX, &impl->q_vecs_in));
+  CeedCallBackend(CeedCalloc(num_threads * CEED_FIELD_MAX, &impl->q_vecs_out));
 
   impl->num_inputs  = num_input_fields;
   impl->num_outputs = num_output_fields;
+  impl->num_threads = num_threads;
 
   // Set up infield and outfield pointer arrays
   // Infields
-  CeedCallBackend(CeedOperatorSetupFields_Opt(qf, op, true, impl->skip_rstr_in, NULL, block_size, impl->block_rstr, impl->e_vecs_full,
-                                              impl->e_vecs_in, impl->q_vecs_in, 0, num_input_fields, Q));
+  CeedCallBackend(CeedOperatorSetupFields_Opt(qf, op, true, impl->skip_rstr_in, NULL, block_size, num_threads, impl->fields_in, impl->block_rstr,
+                                              impl->e_vecs_full, impl->e_vecs_in, impl->q_vecs_in, 0, num_input_fields, Q));
   // Outfields
-  CeedCallBackend(CeedOperatorSetupFields_Opt(qf, op, false, impl->skip_rstr_out, impl->apply_add_basis_out, block_size, impl->block_rstr,
-                                              impl->e_vecs_full, impl->e_vecs_out, impl->q_vecs_out, num_input_fields, num_output_fields, Q));
+  CeedCallBackend(CeedOperatorSetupFields_Opt(qf, op, false, impl->skip_rstr_out, impl->apply_add_basis_out, block_size, num_threads,
+                                              impl->fields_out, impl->block_rstr, impl->e_vecs_full, impl->e_vecs_out, impl->q_vecs_out,
+                                              num_input_fields, num_output_fields, Q));
+
+  // Mixed precision, passive QFunction data is stored in single precision and widened block by block into owned Q-vecs
+  if (ceed_impl->use_mixed_precision && sizeof(CeedScalar) > sizeof(float)) {
+    for (CeedInt i = 0; i < num_input_fields; i++) {
+      CeedOperatorFieldInfo_Opt *field = &impl->fields_in[i];
+
+      field->use_fp32 = !field->is_active && !field->restrict_by_block && field->eval_mode == CEED_EVAL_NONE;
+      if (!field->use_fp32) continue;
+      for (CeedInt t = 0; t < num_threads; t++) CeedCallBackend(CeedVectorSetValue(impl->q_vecs_in[t * CEED_FIELD_MAX + i], 0.0));
+    }
+  }
 
   // Identity QFunctions
   if (impl->is_identity_qf) {
@@ -262,50 +468,101 @@ static int CeedOperatorSetup_Opt(CeedOperator op) {
     if (in_mode == CEED_EVAL_NONE && out_mode == CEED_EVAL_NONE) {
       impl->is_identity_rstr_op = true;
     } else {
-      CeedCallBackend(CeedVectorReferenceCopy(impl->q_vecs_in[0], &impl->q_vecs_out[0]));
+      for (CeedInt t = 0; t < num_threads; t++) {
+        CeedCallBackend(CeedVectorReferenceCopy(impl->q_vecs_in[t * CEED_FIELD_MAX], &impl->q_vecs_out[t * CEED_FIELD_MAX]));
+      }
     }
   }
 
+  impl->use_jit = ceed_impl->use_jit && !impl->is_identity_qf;
+
+  // Threaded element loop
+  if (num_threads > 1 && !impl->is_identity_rstr_op) {
+    CeedCallBackend(CeedOperatorSetupThreads_Opt(op, impl));
+    CeedCallBackend(CeedOperatorSetupColors_Opt(impl, num_blocks, block_size));
+    CeedCallBackend(CeedOperatorSetupFirstTouch_Opt(impl));
+  }
+
   CeedCallBackend(CeedOperatorSetSetupDone(op));
   CeedCallBackend(CeedQFunctionDestroy(&qf));
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Setup JiT QFunction, with the context data compiled in until the context is first modified
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupJit_Opt(CeedQFunction qf, CeedInt Q, CeedOperator_Opt *impl) {
+  uint64_t             ctx_state = 0;
+  CeedQFunctionContext ctx;
+
+  CeedCallBackend(CeedQFunctionGetContext(qf, &ctx));
+  if (ctx) CeedCallBackend(CeedQFunctionContextGetState(ctx, &ctx_state));
+  CeedCallBackend(CeedQFunctionContextDestroy(&ctx));
+  if (impl->is_jit_setup && (!impl->is_jit_ctx_constant || ctx_state == impl->jit_ctx_state)) return CEED_ERROR_SUCCESS;
+
+  // A context modified after it was compiled in is read at runtime from then on, so it is recompiled at most once
+  CeedCallBackend(CeedQFunctionJitDestroy_Opt(&impl->jit_module));
+  CeedCallBackend(CeedQFunctionJitCompile_Opt(qf, Q, !impl->is_jit_setup, &impl->jit_module, &impl->jit_f, &impl->is_jit_ctx_constant));
+  impl->jit_ctx_state = ctx_state;
+  impl->is_jit_setup  = true;
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Setup Input Fields
 //------------------------------------------------------------------------------
-static inline int CeedOperatorSetupInputs_Opt(CeedInt num_input_fields, CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
-                                              CeedVector in_vec, CeedScalar *e_data[2 * CEED_FIELD_MAX], CeedOperator_Opt *impl,
-                                              CeedRequest *request) {
+static inline int CeedOperatorSetupInputs_Opt(CeedInt num_input_fields, CeedVector *in_vecs, CeedScalar *e_data[2 * CEED_FIELD_MAX],
+                                              CeedScalar **e_data_shared, CeedOperator_Opt *impl, CeedRequest *request) {
   for (CeedInt i = 0; i < num_input_fields; i++) {
-    CeedEvalMode eval_mode;
-
-    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
-    if (eval_mode == CEED_EVAL_WEIGHT) {  // Skip
-    } else {
-      uint64_t   state;
-      CeedVector vec;
-
-      // Get input vector
-      CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
-      if (vec != CEED_VECTOR_ACTIVE) {
-        // Restrict
-        CeedCallBackend(CeedVectorGetState(vec, &state));
-        if (state != impl->input_states[i] && impl->block_rstr[i] && !impl->skip_rstr_in[i]) {
-          CeedCallBackend(CeedElemRestrictionApply(impl->block_rstr[i], CEED_NOTRANSPOSE, vec, impl->e_vecs_full[i], request));
-        }
-        impl->input_states[i] = state;
-        // Get evec
-        CeedCallBackend(CeedVectorGetArrayRead(impl->e_vecs_full[i], CEED_MEM_HOST, (const CeedScalar **)&e_data[i]));
-      } else {
-        // Set Qvec for CEED_EVAL_NONE
-        if (eval_mode == CEED_EVAL_NONE) {
-          CeedCallBackend(CeedVectorGetArrayRead(impl->e_vecs_in[i], CEED_MEM_HOST, (const CeedScalar **)&e_data[i]));
-          CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, e_data[i]));
-          CeedCallBackend(CeedVectorRestoreArrayRead(impl->e_vecs_in[i], (const CeedScalar **)&e_data[i]));
+    const CeedOperatorFieldInfo_Opt *field = &impl->fields_in[i];
+
+    if (field->eval_mode == CEED_EVAL_WEIGHT) continue;
+    if (e_data_shared && e_data_shared[i]) {
+      // Active input restricted by the composite operator
+      e_data[i] = e_data_shared[i];
+    } else if (field->use_fp32) {
+      uint64_t state;
+
+      // Restrict and convert to single precision only when the input changes
+      CeedCallBackend(CeedVectorGetState(in_vecs[i], &state));
+      if (state != impl->input_states[i]) {
+        CeedSize          length;
+        const CeedScalar *e_array;
+        CeedVector        e_vec = field->use_l_vec ? in_vecs[i] : impl->e_vecs_full[i];
+
+        if (!field->use_l_vec && impl->block_rstr[i] && !impl->skip_rstr_in[i]) {
+          CeedCallBackend(CeedElemRestrictionApply(impl->block_rstr[i], CEED_NOTRANSPOSE, in_vecs[i], impl->e_vecs_full[i], request));
         }
+        CeedCallBackend(CeedVectorGetLength(e_vec, &length));
+        if (!impl->e_data_fp32[i]) CeedCallBackend(CeedMalloc(length, &impl->e_data_fp32[i]));
+        CeedCallBackend(CeedVectorGetArrayRead(e_vec, CEED_MEM_HOST, &e_array));
+        CeedPragmaSIMD for (CeedSize j = 0; j < length; j++) impl->e_data_fp32[i][j] = (float)e_array[j];
+        CeedCallBackend(CeedVectorRestoreArrayRead(e_vec, &e_array));
+      }
+      impl->input_states[i] = state;
+    } else if (field->use_l_vec) {
+      // Read E-vec in place
+      CeedCallBackend(CeedVectorGetArrayRead(in_vecs[i], CEED_MEM_HOST, (const CeedScalar **)&e_data[i]));
+    } else if (!field->is_active && !field->restrict_by_block) {
+      uint64_t state;
+
+      // Restrict
+      CeedCallBackend(CeedVectorGetState(in_vecs[i], &state));
+      if (state != impl->input_states[i] && impl->block_rstr[i] && !impl->skip_rstr_in[i]) {
+        CeedCallBackend(CeedElemRestrictionApply(impl->block_rstr[i], CEED_NOTRANSPOSE, in_vecs[i], impl->e_vecs_full[i], request));
+      }
+      impl->input_states[i] = state;
+      // Get evec
+      CeedCallBackend(CeedVectorGetArrayRead(impl->e_vecs_full[i], CEED_MEM_HOST, (const CeedScalar **)&e_data[i]));
+    } else if (field->eval_mode == CEED_EVAL_NONE) {
+      // Set Qvec for CEED_EVAL_NONE
+      for (CeedInt t = 0; t < impl->num_threads; t++) {
+        CeedVector e_vec = impl->e_vecs_in[t * CEED_FIELD_MAX + i], q_vec = impl->q_vecs_in[t * CEED_FIELD_MAX + i];
+
+        CeedCallBackend(CeedVectorGetArrayRead(e_vec, CEED_MEM_HOST, (const CeedScalar **)&e_data[i]));
+        CeedCallBackend(CeedVectorSetArray(q_vec, CEED_MEM_HOST, CEED_USE_POINTER, e_data[i]));
+        CeedCallBackend(CeedVectorRestoreArrayRead(e_vec, (const CeedScalar **)&e_data[i]));
       }
-      CeedCallBackend(CeedVectorDestroy(&vec));
     }
   }
   return CEED_ERROR_SUCCESS;
@@ -314,55 +571,54 @@ static inline int CeedOperatorSetupInputs_Opt(CeedInt num_input_fields, CeedQFun
 //------------------------------------------------------------------------------
 // Input Basis Action
 //------------------------------------------------------------------------------
-static inline int CeedOperatorInputBasis_Opt(CeedInt e, CeedInt Q, CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
-                                             CeedInt num_input_fields, CeedInt block_size, CeedVector in_vec, bool skip_active,
-                                             CeedScalar *e_data[2 * CEED_FIELD_MAX], CeedOperator_Opt *impl, CeedRequest *request) {
+static inline int CeedOperatorInputBasis_Opt(CeedInt e, CeedInt Q, CeedOperatorFieldInfo_Opt *fields_in, CeedInt num_input_fields,
+                                             CeedInt block_size, CeedVector *in_vecs, bool skip_active, CeedScalar *e_data[2 * CEED_FIELD_MAX],
+                                             CeedScalar **e_data_shared, CeedOperator_Opt *impl, CeedVector *e_vecs_in, CeedVector *q_vecs_in,
+                                             double *time, double *phase_times, CeedRequest *request) {
   for (CeedInt i = 0; i < num_input_fields; i++) {
-    bool                is_active;
-    CeedInt             elem_size, size, num_comp;
-    CeedEvalMode        eval_mode;
-    CeedVector          vec;
-    CeedElemRestriction elem_rstr;
-    CeedBasis           basis;
+    const bool         is_active = fields_in[i].is_active, is_shared = e_data_shared && e_data_shared[i];
+    const bool         is_block_input = (is_active && !is_shared) || fields_in[i].restrict_by_block;
+    const CeedEvalMode eval_mode = fields_in[i].eval_mode;
 
     // Skip active input
-    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
-    is_active = vec == CEED_VECTOR_ACTIVE;
-    CeedCallBackend(CeedVectorDestroy(&vec));
     if (skip_active && is_active) continue;
 
-    // Get elem_size, eval_mode, size
-    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[i], &elem_rstr));
-    CeedCallBackend(CeedElemRestrictionGetElementSize(elem_rstr, &elem_size));
-    CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
-    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
-    CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &size));
-    // Restrict block active input
-    if (is_active && impl->block_rstr[i]) {
-      CeedCallBackend(CeedElemRestrictionApplyBlock(impl->block_rstr[i], e / block_size, CEED_NOTRANSPOSE, in_vec, impl->e_vecs_in[i], request));
+    // Restrict block of active input or passive input restricted by block
+    if (is_block_input && impl->block_rstr[i] && !impl->skip_rstr_in[i]) {
+      CeedCallBackend(CeedElemRestrictionApplyBlock(impl->block_rstr[i], e / block_size, CEED_NOTRANSPOSE, in_vecs[i], e_vecs_in[i], request));
     }
+    if (phase_times) CeedCallBackend(CeedOperatorProfileLap(time, &phase_times[CEED_OPERATOR_PHASE_INPUT_RESTRICTION]));
     // Basis action
     switch (eval_mode) {
       case CEED_EVAL_NONE:
-        if (!is_active) {
-          CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data[i][(CeedSize)e * Q * size]));
+        if (fields_in[i].use_fp32) {
+          const float *e_array = &impl->e_data_fp32[i][(CeedSize)e * Q * fields_in[i].size];
+          CeedSize     q_size;
+          CeedScalar  *q_array;
+
+          // Widen block of single precision data
+          CeedCallBackend(CeedVectorGetLength(q_vecs_in[i], &q_size));
+          CeedCallBackend(CeedVectorGetArrayWrite(q_vecs_in[i], CEED_MEM_HOST, &q_array));
+          CeedPragmaSIMD for (CeedSize j = 0; j < q_size; j++) q_array[j] = (CeedScalar)e_array[j];
+          CeedCallBackend(CeedVectorRestoreArray(q_vecs_in[i], &q_array));
+        } else if (!is_block_input) {
+          CeedCallBackend(CeedVectorSetArray(q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data[i][(CeedSize)e * Q * fields_in[i].size]));
         }
         break;
       case CEED_EVAL_INTERP:
       case CEED_EVAL_GRAD:
       case CEED_EVAL_DIV:
       case CEED_EVAL_CURL:
-        CeedCallBackend(CeedOperatorFieldGetBasis(op_input_fields[i], &basis));
-        if (!is_active) {
-          CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
-          CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data[i][(CeedSize)e * elem_size * num_comp]));
+        if (!is_block_input) {
+          CeedCallBackend(CeedVectorSetArray(e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER,
+                                             &e_data[i][(CeedSize)e * fields_in[i].elem_size * fields_in[i].num_comp]));
         }
-        CeedCallBackend(CeedBasisApply(basis, block_size, CEED_NOTRANSPOSE, eval_mode, impl->e_vecs_in[i], impl->q_vecs_in[i]));
-        CeedCallBackend(CeedBasisDestroy(&basis));
+        CeedCallBackend(CeedBasisApply(fields_in[i].basis, block_size, CEED_NOTRANSPOSE, eval_mode, e_vecs_in[i], q_vecs_in[i]));
         break;
       case CEED_EVAL_WEIGHT:
         break;  // No action
     }
+    if (phase_times) CeedCallBackend(CeedOperatorProfileLap(time, &phase_times[CEED_OPERATOR_PHASE_INPUT_BASIS]));
   }
   return CEED_ERROR_SUCCESS;
 }
@@ -370,17 +626,13 @@ static inline int CeedOperatorInputBasis_Opt(CeedInt e, CeedInt Q, CeedQFunction
 //------------------------------------------------------------------------------
 // Output Basis Action
 //------------------------------------------------------------------------------
-static inline int CeedOperatorOutputBasis_Opt(CeedInt e, CeedInt Q, CeedQFunctionField *qf_output_fields, CeedOperatorField *op_output_fields,
-                                              CeedInt block_size, CeedInt num_input_fields, CeedInt num_output_fields, bool *apply_add_basis,
-                                              bool *skip_rstr, CeedOperator op, CeedVector out_vec, CeedOperator_Opt *impl, CeedRequest *request) {
-  for (CeedInt i = 0; i < num_output_fields; i++) {
-    bool         is_active;
-    CeedEvalMode eval_mode;
-    CeedVector   vec;
-    CeedBasis    basis;
+static inline int CeedOperatorOutputBasis_Opt(CeedInt e, CeedInt block_size, CeedOperator op, CeedVector *out_vecs, CeedScalar **e_data_shared,
+                                              CeedOperator_Opt *impl, CeedVector *e_vecs_out, CeedVector *q_vecs_out, double *time,
+                                              double *phase_times, CeedRequest *request) {
+  for (CeedInt i = 0; i < impl->num_outputs; i++) {
+    const CeedEvalMode eval_mode = impl->fields_out[i].eval_mode;
+    const bool         is_shared = e_data_shared && e_data_shared[impl->num_inputs + i];
 
-    // Get eval_mode
-    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
     // Basis action
     switch (eval_mode) {
       case CEED_EVAL_NONE:
@@ -389,13 +641,17 @@ static inline int CeedOperatorOutputBasis_Opt(CeedInt e, CeedInt Q, CeedQFunctio
       case CEED_EVAL_GRAD:
       case CEED_EVAL_DIV:
       case CEED_EVAL_CURL:
-        CeedCallBackend(CeedOperatorFieldGetBasis(op_output_fields[i], &basis));
-        if (apply_add_basis[i]) {
-          CeedCallBackend(CeedBasisApplyAdd(basis, block_size, CEED_TRANSPOSE, eval_mode, impl->q_vecs_out[i], impl->e_vecs_out[i]));
+        if (is_shared) {
+          // Add to the block of the E-vector summed by the composite operator
+          CeedCallBackend(CeedVectorSetArray(
+              e_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER,
+              &e_data_shared[impl->num_inputs + i][(CeedSize)e * impl->fields_out[i].elem_size * impl->fields_out[i].num_comp]));
+          CeedCallBackend(CeedBasisApplyAdd(impl->fields_out[i].basis, block_size, CEED_TRANSPOSE, eval_mode, q_vecs_out[i], e_vecs_out[i]));
+        } else if (impl->apply_add_basis_out[i]) {
+          CeedCallBackend(CeedBasisApplyAdd(impl->fields_out[i].basis, block_size, CEED_TRANSPOSE, eval_mode, q_vecs_out[i], e_vecs_out[i]));
         } else {
-          CeedCallBackend(CeedBasisApply(basis, block_size, CEED_TRANSPOSE, eval_mode, impl->q_vecs_out[i], impl->e_vecs_out[i]));
+          CeedCallBackend(CeedBasisApply(impl->fields_out[i].basis, block_size, CEED_TRANSPOSE, eval_mode, q_vecs_out[i], e_vecs_out[i]));
         }
-        CeedCallBackend(CeedBasisDestroy(&basis));
         break;
       // LCOV_EXCL_START
       case CEED_EVAL_WEIGHT: {
@@ -403,16 +659,12 @@ static inline int CeedOperatorOutputBasis_Opt(CeedInt e, CeedInt Q, CeedQFunctio
         // LCOV_EXCL_STOP
       }
     }
+    if (phase_times) CeedCallBackend(CeedOperatorProfileLap(time, &phase_times[CEED_OPERATOR_PHASE_OUTPUT_BASIS]));
     // Restrict output block
-    if (skip_rstr[i]) continue;
-    // Get output vector
-    CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[i], &vec));
-    is_active = vec == CEED_VECTOR_ACTIVE;
-    if (is_active) vec = out_vec;
-    // Restrict
+    if (impl->skip_rstr_out[i] || is_shared) continue;
     CeedCallBackend(
-        CeedElemRestrictionApplyBlock(impl->block_rstr[i + impl->num_inputs], e / block_size, CEED_TRANSPOSE, impl->e_vecs_out[i], vec, request));
-    if (!is_active) CeedCallBackend(CeedVectorDestroy(&vec));
+        CeedElemRestrictionApplyBlock(impl->block_rstr[i + impl->num_inputs], e / block_size, CEED_TRANSPOSE, e_vecs_out[i], out_vecs[i], request));
+    if (phase_times) CeedCallBackend(CeedOperatorProfileLap(time, &phase_times[CEED_OPERATOR_PHASE_OUTPUT_RESTRICTION]));
   }
   return CEED_ERROR_SUCCESS;
 }
@@ -420,137 +672,379 @@ static inline int CeedOperatorOutputBasis_Opt(CeedInt e, CeedInt Q, CeedQFunctio
 //------------------------------------------------------------------------------
 // Restore Input Vectors
 //------------------------------------------------------------------------------
-static inline int CeedOperatorRestoreInputs_Opt(CeedInt num_input_fields, CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
-                                                CeedScalar *e_data[2 * CEED_FIELD_MAX], CeedOperator_Opt *impl) {
+static inline int CeedOperatorRestoreInputs_Opt(CeedInt num_input_fields, CeedVector *in_vecs, CeedScalar *e_data[2 * CEED_FIELD_MAX],
+                                                CeedOperator_Opt *impl) {
   for (CeedInt i = 0; i < num_input_fields; i++) {
-    CeedEvalMode eval_mode;
-    CeedVector   vec;
+    const CeedOperatorFieldInfo_Opt *field = &impl->fields_in[i];
+
+    if (field->eval_mode == CEED_EVAL_WEIGHT || field->is_active || field->restrict_by_block || field->use_fp32) continue;
+    if (field->use_l_vec) CeedCallBackend(CeedVectorRestoreArrayRead(in_vecs[i], (const CeedScalar **)&e_data[i]));
+    else CeedCallBackend(CeedVectorRestoreArrayRead(impl->e_vecs_full[i], (const CeedScalar **)&e_data[i]));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Get Input L-Vectors
+//------------------------------------------------------------------------------
+static inline int CeedOperatorGetInputVectors_Opt(CeedOperatorField *op_input_fields, CeedInt num_input_fields, CeedVector in_vec,
+                                                  CeedVector *in_vecs) {
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &in_vecs[i]));
+    if (in_vecs[i] == CEED_VECTOR_ACTIVE) in_vecs[i] = in_vec;
+  }
+  return CEED_ERROR_SUCCESS;
+}
 
-    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
-    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
-    if (eval_mode != CEED_EVAL_WEIGHT && vec != CEED_VECTOR_ACTIVE) {
-      CeedCallBackend(CeedVectorRestoreArrayRead(impl->e_vecs_full[i], (const CeedScalar **)&e_data[i]));
+//------------------------------------------------------------------------------
+// Restore Input L-Vectors
+//------------------------------------------------------------------------------
+static inline int CeedOperatorRestoreInputVectors_Opt(CeedInt num_input_fields, CeedVector *in_vecs, CeedOperator_Opt *impl) {
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    if (!impl->fields_in[i].is_active) CeedCallBackend(CeedVectorDestroy(&in_vecs[i]));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// QFunction Apply on Thread-Local Q-Vectors
+//------------------------------------------------------------------------------
+static inline int CeedOperatorQFunctionApply_Opt(CeedQFunctionUser f, void *ctx_data, CeedInt Q, CeedOperator_Opt *impl, CeedVector *q_vecs_in,
+                                                 CeedVector *q_vecs_out) {
+  const CeedScalar *inputs[CEED_FIELD_MAX];
+  CeedScalar       *outputs[CEED_FIELD_MAX];
+
+  for (CeedInt i = 0; i < impl->num_inputs; i++) CeedCallBackend(CeedVectorGetArrayRead(q_vecs_in[i], CEED_MEM_HOST, &inputs[i]));
+  for (CeedInt i = 0; i < impl->num_outputs; i++) CeedCallBackend(CeedVectorGetArrayWrite(q_vecs_out[i], CEED_MEM_HOST, &outputs[i]));
+  CeedCallBackend(f(ctx_data, Q, inputs, outputs));
+  for (CeedInt i = 0; i < impl->num_inputs; i++) CeedCallBackend(CeedVectorRestoreArrayRead(q_vecs_in[i], &inputs[i]));
+  for (CeedInt i = 0; i < impl->num_outputs; i++) CeedCallBackend(CeedVectorRestoreArray(q_vecs_out[i], &outputs[i]));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Apply Operator to Element Block
+//------------------------------------------------------------------------------
+static inline int CeedOperatorApplyBlock_Opt(CeedOperator op, CeedQFunction qf, CeedQFunctionUser f, void *ctx_data, CeedInt e, CeedInt Q,
+                                             CeedInt block_size, CeedInt t, CeedVector *in_vecs, CeedVector *out_vecs,
+                                             CeedScalar *e_data[2 * CEED_FIELD_MAX], CeedScalar **e_data_shared, CeedOperator_Opt *impl,
+                                             double *phase_times, CeedRequest *request) {
+  double      time;
+  CeedVector *e_vecs_in = &impl->e_vecs_in[t * CEED_FIELD_MAX], *e_vecs_out = &impl->e_vecs_out[t * CEED_FIELD_MAX];
+  CeedVector *q_vecs_in = &impl->q_vecs_in[t * CEED_FIELD_MAX], *q_vecs_out = &impl->q_vecs_out[t * CEED_FIELD_MAX];
+  CeedVector  e_vecs_shared_in[CEED_FIELD_MAX], e_vecs_shared_out[CEED_FIELD_MAX];
+
+  // Fields shared by a composite operator use views of the shared E-vectors, keeping the owned block E-vectors intact
+  if (e_data_shared) {
+    CeedVector *e_vecs_shared = &impl->e_vecs_shared[t * 2 * CEED_FIELD_MAX];
+
+    for (CeedInt i = 0; i < impl->num_inputs; i++) e_vecs_shared_in[i] = e_data_shared[i] ? e_vecs_shared[i] : e_vecs_in[i];
+    for (CeedInt i = 0; i < impl->num_outputs; i++) {
+      e_vecs_shared_out[i] = e_data_shared[impl->num_inputs + i] ? e_vecs_shared[CEED_FIELD_MAX + i] : e_vecs_out[i];
     }
-    CeedCallBackend(CeedVectorDestroy(&vec));
+    e_vecs_in  = e_vecs_shared_in;
+    e_vecs_out = e_vecs_shared_out;
   }
+
+  // Input basis apply
+  if (phase_times) CeedCallBackend(CeedOperatorProfileLap(&time, NULL));
+  CeedCallBackend(CeedOperatorInputBasis_Opt(e, Q, impl->fields_in, impl->num_inputs, block_size, in_vecs, false, e_data, e_data_shared, impl,
+                                             e_vecs_in, q_vecs_in, &time, phase_times, request));
+
+  // Q function
+  if (!impl->is_identity_qf) {
+    if (f) CeedCallBackend(CeedOperatorQFunctionApply_Opt(f, ctx_data, Q * block_size, impl, q_vecs_in, q_vecs_out));
+    else CeedCallBackend(CeedQFunctionApply(qf, Q * block_size, q_vecs_in, q_vecs_out));
+  }
+  if (phase_times) CeedCallBackend(CeedOperatorProfileLap(&time, &phase_times[CEED_OPERATOR_PHASE_QFUNCTION]));
+
+  // Output basis apply and restriction
+  CeedCallBackend(
+      CeedOperatorOutputBasis_Opt(e, block_size, op, out_vecs, e_data_shared, impl, e_vecs_out, q_vecs_out, &time, phase_times, request));
   return CEED_ERROR_SUCCESS;
 }
 
 //------------------------------------------------------------------------------
-// Operator Apply
+// Threaded Element Block Loop
 //------------------------------------------------------------------------------
-static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
-  Ceed                ceed;
-  Ceed_Opt           *ceed_impl;
-  CeedInt             Q, num_input_fields, num_output_fields, num_elem;
-  CeedEvalMode        eval_mode;
-  CeedScalar         *e_data[2 * CEED_FIELD_MAX] = {0};
-  CeedQFunctionField *qf_input_fields, *qf_output_fields;
-  CeedQFunction       qf;
-  CeedOperatorField  *op_input_fields, *op_output_fields;
-  CeedOperator_Opt   *impl;
+static int CeedOperatorApplyAddThreaded_Opt(CeedOperator op, CeedQFunction qf, CeedInt Q, CeedInt block_size, CeedVector *in_vecs,
+                                            CeedVector *out_vecs, CeedScalar *e_data[2 * CEED_FIELD_MAX], CeedScalar **e_data_shared,
+                                            double *phase_times, CeedOperator_Opt *impl) {
+  int               ierr                       = CEED_ERROR_SUCCESS;
+  bool              is_owned[CEED_FIELD_MAX]   = {false};
+  void             *ctx_data                   = NULL;
+  const CeedScalar *in_arrays[CEED_FIELD_MAX]  = {NULL};
+  CeedScalar       *out_arrays[CEED_FIELD_MAX] = {NULL};
+  CeedQFunctionUser f                          = NULL;
+
+  // Share the L-vector arrays with the per-thread views
+  for (CeedInt i = 0; i < impl->num_inputs; i++) {
+    if (!impl->l_vecs_in[i]) continue;
+    CeedCallBackend(CeedVectorGetArrayRead(in_vecs[i], CEED_MEM_HOST, &in_arrays[i]));
+    for (CeedInt t = 0; t < impl->num_threads; t++) {
+      CeedCallBackend(CeedVectorSetArray(impl->l_vecs_in[t * CEED_FIELD_MAX + i], CEED_MEM_HOST, CEED_USE_POINTER, (CeedScalar *)in_arrays[i]));
+    }
+  }
+  for (CeedInt i = 0; i < impl->num_outputs; i++) {
+    if (impl->skip_rstr_out[i] || (e_data_shared && e_data_shared[impl->num_inputs + i])) continue;
+    // Fields restricted into the same vector share its array
+    for (CeedInt j = 0; j < i; j++) {
+      if (out_arrays[j] && out_vecs[j] == out_vecs[i]) out_arrays[i] = out_arrays[j];
+    }
+    if (!out_arrays[i]) {
+      CeedCallBackend(CeedVectorGetArray(out_vecs[i], CEED_MEM_HOST, &out_arrays[i]));
+      is_owned[i] = true;
+    }
+    for (CeedInt t = 0; t < impl->num_threads; t++) {
+      CeedCallBackend(CeedVectorSetArray(impl->l_vecs_out[t * CEED_FIELD_MAX + i], CEED_MEM_HOST, CEED_USE_POINTER, out_arrays[i]));
+    }
+  }
+  if (impl->jit_f) f = impl->jit_f;
+  else CeedCallBackend(CeedQFunctionGetUserFunction(qf, &f));
+  CeedCallBackend(CeedQFunctionGetContextData(qf, CEED_MEM_HOST, &ctx_data));
+  if (phase_times) {
+    if (!impl->thread_phase_times) CeedCallBackend(CeedCalloc(impl->num_threads * CEED_OPERATOR_NUM_PHASES, &impl->thread_phase_times));
+    for (CeedInt j = 0; j < impl->num_threads * CEED_OPERATOR_NUM_PHASES; j++) impl->thread_phase_times[j] = 0.0;
+  }
+
+  // Loop through element blocks, one color at a time
+  for (CeedInt c = 0; c < impl->num_colors && !ierr; c++) {
+    // The serial color, if present, is last
+    CeedPragmaOMP(parallel for num_threads(impl->num_threads) if (!impl->has_serial_color || c < impl->num_colors - 1) schedule(static))
+    for (CeedInt j = impl->color_offsets[c]; j < impl->color_offsets[c + 1]; j++) {
+#ifdef _OPENMP
+      const CeedInt t = omp_get_thread_num();
+#else
+      const CeedInt t = 0;
+#endif
+      const int ierr_block = CeedOperatorApplyBlock_Opt(
+          op, qf, f, ctx_data, impl->color_blocks[j] * block_size, Q, block_size, t, &impl->l_vecs_in[t * CEED_FIELD_MAX],
+          &impl->l_vecs_out[t * CEED_FIELD_MAX], e_data, e_data_shared, impl,
+          phase_times ? &impl->thread_phase_times[t * CEED_OPERATOR_NUM_PHASES] : NULL, CEED_REQUEST_IMMEDIATE);
+
+      if (ierr_block) {
+        CeedPragmaCritical(CeedOperatorApplyAddThreaded_Opt) ierr = ierr_block;
+      }
+    }
+  }
+
+  // Phase times, averaged over threads
+  if (phase_times) {
+    for (CeedInt t = 0; t < impl->num_threads; t++) {
+      for (CeedInt p = 0; p < CEED_OPERATOR_NUM_PHASES; p++) {
+        phase_times[p] += impl->thread_phase_times[t * CEED_OPERATOR_NUM_PHASES + p] / impl->num_threads;
+      }
+    }
+  }
+
+  // Return the L-vector arrays
+  CeedCallBackend(CeedQFunctionRestoreContextData(qf, &ctx_data));
+  for (CeedInt i = 0; i < impl->num_inputs; i++) {
+    if (!impl->l_vecs_in[i]) continue;
+    for (CeedInt t = 0; t < impl->num_threads; t++) {
+      CeedCallBackend(CeedVectorTakeArray(impl->l_vecs_in[t * CEED_FIELD_MAX + i], CEED_MEM_HOST, NULL));
+    }
+    CeedCallBackend(CeedVectorRestoreArrayRead(in_vecs[i], &in_arrays[i]));
+  }
+  for (CeedInt i = 0; i < impl->num_outputs; i++) {
+    if (impl->skip_rstr_out[i] || (e_data_shared && e_data_shared[impl->num_inputs + i])) continue;
+    for (CeedInt t = 0; t < impl->num_threads; t++) {
+      CeedCallBackend(CeedVectorTakeArray(impl->l_vecs_out[t * CEED_FIELD_MAX + i], CEED_MEM_HOST, NULL));
+    }
+    if (is_owned[i]) CeedCallBackend(CeedVectorRestoreArray(out_vecs[i], &out_arrays[i]));
+  }
+  return ierr;
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply Core, with active E-vector data optionally shared by a composite operator
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddCore_Opt(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedScalar **e_data_shared, CeedRequest *request) {
+  bool               is_profiling;
+  CeedInt            Q, num_input_fields, num_output_fields, num_elem;
+  double             time, phase_times[CEED_OPERATOR_NUM_PHASES] = {0.0};
+  CeedScalar        *e_data[2 * CEED_FIELD_MAX]                = {0};
+  CeedVector         in_vecs[CEED_FIELD_MAX]                   = {NULL};
+  CeedVector         out_vecs[CEED_FIELD_MAX]                  = {NULL};
+  CeedQFunction      qf;
+  CeedOperatorField *op_input_fields, *op_output_fields;
+  CeedOperator_Opt  *impl;
 
   // Setup
   CeedCallBackend(CeedOperatorSetup_Opt(op));
 
-  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
-  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
-  CeedCallBackend(CeedDestroy(&ceed));
   CeedCallBackend(CeedOperatorGetData(op, &impl));
   CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
-  const CeedInt block_size = ceed_impl->block_size;
+  const CeedInt block_size = impl->block_size;
   const CeedInt num_blocks = (num_elem / block_size) + !!(num_elem % block_size);
 
+  CeedCallBackend(CeedOperatorIsProfiling(op, &is_profiling));
+  if (is_profiling) CeedCallBackend(CeedOperatorProfileLap(&time, NULL));
+
   // Restriction only operator
   if (impl->is_identity_rstr_op) {
     for (CeedInt b = 0; b < num_blocks; b++) {
       CeedCallBackend(CeedElemRestrictionApplyBlock(impl->block_rstr[0], b, CEED_NOTRANSPOSE, in_vec, impl->e_vecs_in[0], request));
+      if (is_profiling) CeedCallBackend(CeedOperatorProfileLap(&time, &phase_times[CEED_OPERATOR_PHASE_INPUT_RESTRICTION]));
       CeedCallBackend(CeedElemRestrictionApplyBlock(impl->block_rstr[1], b, CEED_TRANSPOSE, impl->e_vecs_in[0], out_vec, request));
+      if (is_profiling) CeedCallBackend(CeedOperatorProfileLap(&time, &phase_times[CEED_OPERATOR_PHASE_OUTPUT_RESTRICTION]));
     }
+    if (is_profiling) CeedCallBackend(CeedOperatorAddProfile(op, phase_times));
     return CEED_ERROR_SUCCESS;
   }
 
   CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
   CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
   CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
-  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
+  if (impl->use_jit) CeedCallBackend(CeedOperatorSetupJit_Opt(qf, Q * block_size, impl));
 
   // Input Evecs and Restriction
-  CeedCallBackend(CeedOperatorSetupInputs_Opt(num_input_fields, qf_input_fields, op_input_fields, in_vec, e_data, impl, request));
+  CeedCallBackend(CeedOperatorGetInputVectors_Opt(op_input_fields, num_input_fields, in_vec, in_vecs));
+  CeedCallBackend(CeedOperatorSetupInputs_Opt(num_input_fields, in_vecs, e_data, e_data_shared, impl, request));
+  if (is_profiling) CeedCallBackend(CeedOperatorProfileLap(&time, &phase_times[CEED_OPERATOR_PHASE_INPUT_RESTRICTION]));
 
   // Output Lvecs, Evecs, and Qvecs
   for (CeedInt i = 0; i < num_output_fields; i++) {
+    // Get output vector
+    CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[i], &out_vecs[i]));
+    if (impl->fields_out[i].is_active) out_vecs[i] = out_vec;
     // Set Qvec if needed
-    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
-    if (eval_mode == CEED_EVAL_NONE) {
+    if (impl->fields_out[i].eval_mode == CEED_EVAL_NONE) {
       // Set qvec to single block evec
-      CeedCallBackend(CeedVectorGetArrayWrite(impl->e_vecs_out[i], CEED_MEM_HOST, &e_data[i + num_input_fields]));
-      CeedCallBackend(CeedVectorSetArray(impl->q_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER, e_data[i + num_input_fields]));
-      CeedCallBackend(CeedVectorRestoreArray(impl->e_vecs_out[i], &e_data[i + num_input_fields]));
+      for (CeedInt t = 0; t < impl->num_threads; t++) {
+        CeedVector e_vec = impl->e_vecs_out[t * CEED_FIELD_MAX + i], q_vec = impl->q_vecs_out[t * CEED_FIELD_MAX + i];
+
+        CeedCallBackend(CeedVectorGetArrayWrite(e_vec, CEED_MEM_HOST, &e_data[i + num_input_fields]));
+        CeedCallBackend(CeedVectorSetArray(q_vec, CEED_MEM_HOST, CEED_USE_POINTER, e_data[i + num_input_fields]));
+        CeedCallBackend(CeedVectorRestoreArray(e_vec, &e_data[i + num_input_fields]));
+      }
     }
   }
 
   // Loop through elements
-  for (CeedInt e = 0; e < num_blocks * block_size; e += block_size) {
-    // Input basis apply
+  if (impl->num_threads > 1) {
     CeedCallBackend(
-        CeedOperatorInputBasis_Opt(e, Q, qf_input_fields, op_input_fields, num_input_fields, block_size, in_vec, false, e_data, impl, request));
+        CeedOperatorApplyAddThreaded_Opt(op, qf, Q, block_size, in_vecs, out_vecs, e_data, e_data_shared, is_profiling ? phase_times : NULL, impl));
+  } else {
+    void *ctx_data = NULL;
 
-    // Q function
-    if (!impl->is_identity_qf) {
-      CeedCallBackend(CeedQFunctionApply(qf, Q * block_size, impl->q_vecs_in, impl->q_vecs_out));
+    // The JiT QFunction is called directly, otherwise the QFunction is applied through its backend
+    if (impl->jit_f) CeedCallBackend(CeedQFunctionGetContextData(qf, CEED_MEM_HOST, &ctx_data));
+    for (CeedInt e = 0; e < num_blocks * block_size; e += block_size) {
+      CeedCallBackend(CeedOperatorApplyBlock_Opt(op, qf, impl->jit_f, ctx_data, e, Q, block_size, 0, in_vecs, out_vecs, e_data, e_data_shared, impl,
+                                                 is_profiling ? phase_times : NULL, request));
     }
-
-    // Output basis apply and restriction
-    CeedCallBackend(CeedOperatorOutputBasis_Opt(e, Q, qf_output_fields, op_output_fields, block_size, num_input_fields, num_output_fields,
-                                                impl->apply_add_basis_out, impl->skip_rstr_out, op, out_vec, impl, request));
+    if (impl->jit_f) CeedCallBackend(CeedQFunctionRestoreContextData(qf, &ctx_data));
   }
 
   // Restore input arrays
-  CeedCallBackend(CeedOperatorRestoreInputs_Opt(num_input_fields, qf_input_fields, op_input_fields, e_data, impl));
+  CeedCallBackend(CeedOperatorRestoreInputs_Opt(num_input_fields, in_vecs, e_data, impl));
+  CeedCallBackend(CeedOperatorRestoreInputVectors_Opt(num_input_fields, in_vecs, impl));
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    if (!impl->fields_out[i].is_active) CeedCallBackend(CeedVectorDestroy(&out_vecs[i]));
+  }
   CeedCallBackend(CeedQFunctionDestroy(&qf));
+  if (is_profiling) CeedCallBackend(CeedOperatorAddProfile(op, phase_times));
   return CEED_ERROR_SUCCESS;
 }
 
 //------------------------------------------------------------------------------
-// Core code for linear QFunction assembly
+// Operator Apply
 //------------------------------------------------------------------------------
-static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op, bool build_objects, CeedVector *assembled, CeedElemRestriction *rstr,
-                                                              CeedRequest *request) {
+static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  return CeedOperatorApplyAddCore_Opt(op, in_vec, out_vec, NULL, request);
+}
+
+//------------------------------------------------------------------------------
+// Assemble QFunction for Element Block
+//------------------------------------------------------------------------------
+static inline int CeedOperatorLinearAssembleQFunctionBlock_Opt(CeedQFunction qf, CeedQFunctionUser f, void *ctx_data, CeedInt e, CeedInt Q,
+                                                               CeedInt e_start, CeedInt e_end, CeedInt block_size, CeedInt t, CeedVector *in_vecs,
+                                                               CeedScalar *e_data[2 * CEED_FIELD_MAX], CeedScalar *assembled_array,
+                                                               CeedOperator_Opt *impl, CeedRequest *request) {
+  const CeedInt qf_size_in = impl->qf_size_in, qf_size_out = impl->qf_size_out;
+  const CeedInt k_start = CeedIntMax(e_start - e, 0), k_end = CeedIntMin(block_size, e_end - e);
+  const CeedInt Q_block = Q * block_size, Q_batch = Q_block * qf_size_in;
+  CeedVector   *q_vecs_in = &impl->q_vecs_in[t * CEED_FIELD_MAX];
+  CeedVector   *batch_in = &impl->qf_batch_in[t * CEED_FIELD_MAX], *batch_out = &impl->qf_batch_out[t * CEED_FIELD_MAX];
+
+  // Input basis apply
+  CeedCallBackend(CeedOperatorInputBasis_Opt(e, Q, impl->fields_in, impl->num_inputs, block_size, in_vecs, true, e_data, NULL, impl,
+                                             &impl->e_vecs_in[t * CEED_FIELD_MAX], q_vecs_in, NULL, NULL, request));
+
+  // Replicate passive inputs across the active input directions
+  for (CeedInt i = 0; i < impl->num_inputs; i++) {
+    const CeedInt     size = impl->fields_in[i].size;
+    const CeedScalar *q_array;
+    CeedScalar       *batch_array;
+
+    if (impl->fields_in[i].is_active) continue;
+    CeedCallBackend(CeedVectorGetArrayRead(q_vecs_in[i], CEED_MEM_HOST, &q_array));
+    CeedCallBackend(CeedVectorGetArrayWrite(batch_in[i], CEED_MEM_HOST, &batch_array));
+    for (CeedInt c = 0; c < size; c++) {
+      for (CeedInt d = 0; d < qf_size_in; d++) {
+        CeedPragmaSIMD for (CeedInt j = 0; j < Q_block; j++) batch_array[c * Q_batch + d * Q_block + j] = q_array[c * Q_block + j];
+      }
+    }
+    CeedCallBackend(CeedVectorRestoreArray(batch_in[i], &batch_array));
+    CeedCallBackend(CeedVectorRestoreArrayRead(q_vecs_in[i], &q_array));
+  }
+
+  // Apply QFunction to all directions at once
+  if (f) CeedCallBackend(CeedOperatorQFunctionApply_Opt(f, ctx_data, Q_batch, impl, batch_in, batch_out));
+  else CeedCallBackend(CeedQFunctionApply(qf, Q_batch, batch_in, batch_out));
+
+  // Copy active outputs of the elements in the block and in [e_start, e_end), skipping padding, into the assembled array
+  for (CeedInt i = 0, out_offset = 0; i < impl->num_outputs; i++) {
+    const CeedInt     size = impl->fields_out[i].size;
+    const CeedScalar *batch_array;
+
+    if (!impl->fields_out[i].is_active) continue;
+    CeedCallBackend(CeedVectorGetArrayRead(batch_out[i], CEED_MEM_HOST, &batch_array));
+    for (CeedInt k = k_start; k < k_end; k++) {
+      for (CeedInt d = 0; d < qf_size_in; d++) {
+        for (CeedInt c = 0; c < size; c++) {
+          const CeedScalar *batch_q     = &batch_array[c * Q_batch + d * Q_block + k];
+          CeedScalar       *assembled_q = &assembled_array[(((CeedSize)(e + k - e_start) * qf_size_in + d) * qf_size_out + out_offset + c) * Q];
+
+          for (CeedInt j = 0; j < Q; j++) assembled_q[j] = batch_q[j * block_size];
+        }
+      }
+    }
+    CeedCallBackend(CeedVectorRestoreArrayRead(batch_out[i], &batch_array));
+    out_offset += size;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Setup for linear QFunction assembly
+//------------------------------------------------------------------------------
+static inline int CeedOperatorLinearAssembleQFunctionSetup_Opt(CeedOperator op) {
   Ceed                ceed;
-  Ceed_Opt           *ceed_impl;
-  CeedInt             qf_size_in, qf_size_out, Q, num_input_fields, num_output_fields, num_elem;
-  CeedScalar         *l_vec_array, *e_data[2 * CEED_FIELD_MAX] = {0};
+  CeedInt             qf_size_in, qf_size_out, Q, num_input_fields, num_output_fields;
   CeedQFunctionField *qf_input_fields, *qf_output_fields;
   CeedQFunction       qf;
   CeedOperatorField  *op_input_fields, *op_output_fields;
   CeedOperator_Opt   *impl;
 
+  // Setup
+  CeedCallBackend(CeedOperatorSetup_Opt(op));
+
   CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
-  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
   CeedCallBackend(CeedOperatorGetData(op, &impl));
   qf_size_in  = impl->qf_size_in;
   qf_size_out = impl->qf_size_out;
 
-  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
   CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
   CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
   CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
   CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
-  const CeedInt       block_size = ceed_impl->block_size;
-  const CeedInt       num_blocks = (num_elem / block_size) + !!(num_elem % block_size);
-  CeedVector          l_vec      = impl->qf_l_vec;
-  CeedElemRestriction block_rstr = impl->qf_block_rstr;
-
-  // Setup
-  CeedCallBackend(CeedOperatorSetup_Opt(op));
+  const CeedInt block_size = impl->block_size;
 
   // Check for restriction only operator
   CeedCheck(!impl->is_identity_rstr_op, ceed, CEED_ERROR_BACKEND, "Assembling restriction only operators is not supported");
 
-  // Input Evecs and Restriction
-  CeedCallBackend(CeedOperatorSetupInputs_Opt(num_input_fields, qf_input_fields, op_input_fields, NULL, e_data, impl, request));
-
   // Count number of active input fields
   if (qf_size_in == 0) {
     for (CeedInt i = 0; i < num_input_fields; i++) {
@@ -588,155 +1082,396 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op, b
     impl->qf_size_out = qf_size_out;
   }
 
-  // Setup l_vec
-  if (!l_vec) {
-    const CeedSize l_size = (CeedSize)block_size * Q * qf_size_in * qf_size_out;
+  // Q-vectors widened to one slice of Q points per active input direction, for each thread
+  const CeedInt Q_batch = Q * block_size * qf_size_in;
 
-    CeedCallBackend(CeedVectorCreate(ceed, l_size, &l_vec));
-    CeedCallBackend(CeedVectorSetValue(l_vec, 0.0));
-    impl->qf_l_vec = l_vec;
+  if (!impl->qf_batch_in) {
+    CeedCallBackend(CeedCalloc(impl->num_threads * CEED_FIELD_MAX, &impl->qf_batch_in));
+    CeedCallBackend(CeedCalloc(impl->num_threads * CEED_FIELD_MAX, &impl->qf_batch_out));
+    for (CeedInt t = 0; t < impl->num_threads; t++) {
+      for (CeedInt i = 0; i < num_input_fields; i++) {
+        CeedCallBackend(CeedVectorCreate(ceed, (CeedSize)Q_batch * impl->fields_in[i].size, &impl->qf_batch_in[t * CEED_FIELD_MAX + i]));
+      }
+      for (CeedInt i = 0; i < num_output_fields; i++) {
+        CeedCallBackend(CeedVectorCreate(ceed, (CeedSize)Q_batch * impl->fields_out[i].size, &impl->qf_batch_out[t * CEED_FIELD_MAX + i]));
+      }
+    }
   }
 
-  // Output blocked restriction
-  if (!block_rstr) {
-    CeedInt strides[3] = {1, Q, qf_size_in * qf_size_out * Q};
+  // Seed active inputs with the unit vector of each direction
+  for (CeedInt i = 0, d_offset = 0; i < num_input_fields; i++) {
+    if (!impl->fields_in[i].is_active) continue;
+    for (CeedInt t = 0; t < impl->num_threads; t++) {
+      CeedScalar *array;
+
+      CeedCallBackend(CeedVectorGetArrayWrite(impl->qf_batch_in[t * CEED_FIELD_MAX + i], CEED_MEM_HOST, &array));
+      for (CeedInt c = 0; c < impl->fields_in[i].size; c++) {
+        for (CeedInt d = 0; d < qf_size_in; d++) {
+          for (CeedInt j = 0; j < Q * block_size; j++) array[(c * qf_size_in + d) * Q * block_size + j] = d == d_offset + c ? 1.0 : 0.0;
+        }
+      }
+      CeedCallBackend(CeedVectorRestoreArray(impl->qf_batch_in[t * CEED_FIELD_MAX + i], &array));
+    }
+    d_offset += impl->fields_in[i].size;
+  }
+  CeedCallBackend(CeedDestroy(&ceed));
+  CeedCallBackend(CeedQFunctionDestroy(&qf));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Assemble linear QFunction for elements in [e_start, e_end)
+//------------------------------------------------------------------------------
+static inline int CeedOperatorLinearAssembleQFunctionRange_Opt(CeedOperator op, CeedInt e_start, CeedInt e_end, CeedScalar *assembled_array,
+                                                               CeedRequest *request) {
+  void              *ctx_data = NULL;
+  CeedInt            Q, num_input_fields, num_output_fields;
+  CeedScalar        *e_data[2 * CEED_FIELD_MAX] = {0};
+  CeedVector         in_vecs[CEED_FIELD_MAX]    = {NULL};
+  CeedQFunctionUser  f                          = NULL;
+  CeedQFunction      qf;
+  CeedOperatorField *op_input_fields, *op_output_fields;
+  CeedOperator_Opt  *impl;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+  const CeedInt block_size  = impl->block_size;
+  const CeedInt block_start = e_start / block_size, block_end = (e_end / block_size) + !!(e_end % block_size);
+
+  // Input Evecs and Restriction
+  CeedCallBackend(CeedOperatorGetInputVectors_Opt(op_input_fields, num_input_fields, NULL, in_vecs));
+  CeedCallBackend(CeedOperatorSetupInputs_Opt(num_input_fields, in_vecs, e_data, NULL, impl, request));
+
+  CeedCallBackend(CeedQFunctionGetUserFunction(qf, &f));
+  CeedCallBackend(CeedQFunctionGetContextData(qf, CEED_MEM_HOST, &ctx_data));
+
+  // Loop through element blocks
+  if (impl->num_threads > 1) {
+    int               ierr                      = CEED_ERROR_SUCCESS;
+    const CeedScalar *in_arrays[CEED_FIELD_MAX] = {NULL};
+
+    // Share the passive input L-vector arrays with the per-thread views
+    for (CeedInt i = 0; i < num_input_fields; i++) {
+      if (!impl->l_vecs_in[i] || impl->fields_in[i].is_active) continue;
+      CeedCallBackend(CeedVectorGetArrayRead(in_vecs[i], CEED_MEM_HOST, &in_arrays[i]));
+      for (CeedInt t = 0; t < impl->num_threads; t++) {
+        CeedCallBackend(CeedVectorSetArray(impl->l_vecs_in[t * CEED_FIELD_MAX + i], CEED_MEM_HOST, CEED_USE_POINTER, (CeedScalar *)in_arrays[i]));
+      }
+    }
+
+    // Element blocks write disjoint parts of the assembled array
+    CeedPragmaOMP(parallel for num_threads(impl->num_threads) schedule(static))
+    for (CeedInt b = block_start; b < block_end; b++) {
+#ifdef _OPENMP
+      const CeedInt t = omp_get_thread_num();
+#else
+      const CeedInt t = 0;
+#endif
+      const int ierr_block = CeedOperatorLinearAssembleQFunctionBlock_Opt(qf, f, ctx_data, b * block_size, Q, e_start, e_end, block_size, t,
+                                                                          &impl->l_vecs_in[t * CEED_FIELD_MAX], e_data, assembled_array, impl,
+                                                                          CEED_REQUEST_IMMEDIATE);
+
+      if (ierr_block) {
+        CeedPragmaCritical(CeedOperatorLinearAssembleQFunctionRange_Opt) ierr = ierr_block;
+      }
+    }
 
-    CeedCallBackend(CeedElemRestrictionCreateBlockedStrided(ceed, num_elem, Q, block_size, qf_size_in * qf_size_out,
-                                                            qf_size_in * qf_size_out * num_elem * Q, strides, &block_rstr));
-    impl->qf_block_rstr = block_rstr;
+    // Return the L-vector arrays
+    for (CeedInt i = 0; i < num_input_fields; i++) {
+      if (!in_arrays[i]) continue;
+      for (CeedInt t = 0; t < impl->num_threads; t++) {
+        CeedCallBackend(CeedVectorTakeArray(impl->l_vecs_in[t * CEED_FIELD_MAX + i], CEED_MEM_HOST, NULL));
+      }
+      CeedCallBackend(CeedVectorRestoreArrayRead(in_vecs[i], &in_arrays[i]));
+    }
+    CeedCallBackend(ierr);
+  } else {
+    for (CeedInt b = block_start; b < block_end; b++) {
+      CeedCallBackend(CeedOperatorLinearAssembleQFunctionBlock_Opt(qf, f, ctx_data, b * block_size, Q, e_start, e_end, block_size, 0, in_vecs, e_data,
+                                                                   assembled_array, impl, request));
+    }
   }
+  CeedCallBackend(CeedQFunctionRestoreContextData(qf, &ctx_data));
+
+  // Restore input arrays
+  CeedCallBackend(CeedOperatorRestoreInputs_Opt(num_input_fields, in_vecs, e_data, impl));
+  CeedCallBackend(CeedOperatorRestoreInputVectors_Opt(num_input_fields, in_vecs, impl));
+  CeedCallBackend(CeedQFunctionDestroy(&qf));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Core code for linear QFunction assembly
+//------------------------------------------------------------------------------
+static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op, bool build_objects, CeedVector *assembled, CeedElemRestriction *rstr,
+                                                              CeedRequest *request) {
+  CeedInt           Q, num_elem;
+  CeedScalar       *assembled_array;
+  CeedOperator_Opt *impl;
+
+  CeedCallBackend(CeedOperatorLinearAssembleQFunctionSetup_Opt(op));
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
+  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
 
   // Build objects if needed
   if (build_objects) {
+    const CeedInt  qf_size_in = impl->qf_size_in, qf_size_out = impl->qf_size_out;
     const CeedSize l_size     = (CeedSize)num_elem * Q * qf_size_in * qf_size_out;
     CeedInt        strides[3] = {1, Q, qf_size_in * qf_size_out * Q};
+    Ceed           ceed;
 
+    CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
     // Create output restriction
     CeedCallBackend(CeedElemRestrictionCreateStrided(ceed, num_elem, Q, qf_size_in * qf_size_out,
                                                      (CeedSize)qf_size_in * (CeedSize)qf_size_out * (CeedSize)num_elem * (CeedSize)Q, strides, rstr));
     // Create assembled vector
     CeedCallBackend(CeedVectorCreate(ceed, l_size, assembled));
+    CeedCallBackend(CeedDestroy(&ceed));
   }
+  CeedCallBackend(CeedVectorGetArrayWrite(*assembled, CEED_MEM_HOST, &assembled_array));
+  CeedCallBackend(CeedOperatorLinearAssembleQFunctionRange_Opt(op, 0, num_elem, assembled_array, request));
+  CeedCallBackend(CeedVectorRestoreArray(*assembled, &assembled_array));
+  return CEED_ERROR_SUCCESS;
+}
 
-  // Loop through elements
-  CeedCallBackend(CeedVectorSetValue(*assembled, 0.0));
-  for (CeedInt e = 0; e < num_blocks * block_size; e += block_size) {
-    CeedCallBackend(CeedVectorGetArray(l_vec, CEED_MEM_HOST, &l_vec_array));
+//------------------------------------------------------------------------------
+// Assemble Linear QFunction
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleQFunction_Opt(CeedOperator op, CeedVector *assembled, CeedElemRestriction *rstr, CeedRequest *request) {
+  return CeedOperatorLinearAssembleQFunctionCore_Opt(op, true, assembled, rstr, request);
+}
 
-    // Input basis apply
-    CeedCallBackend(
-        CeedOperatorInputBasis_Opt(e, Q, qf_input_fields, op_input_fields, num_input_fields, block_size, NULL, true, e_data, impl, request));
+//------------------------------------------------------------------------------
+// Update Assembled Linear QFunction
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleQFunctionUpdate_Opt(CeedOperator op, CeedVector assembled, CeedElemRestriction rstr, CeedRequest *request) {
+  return CeedOperatorLinearAssembleQFunctionCore_Opt(op, false, &assembled, &rstr, request);
+}
 
-    // Assemble QFunction
-    for (CeedInt i = 0; i < num_input_fields; i++) {
-      bool       is_active;
-      CeedInt    field_size;
-      CeedVector vec;
+//------------------------------------------------------------------------------
+// Assemble Linear QFunction for a Range of Elements
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleQFunctionElements_Opt(CeedOperator op, CeedInt e_start, CeedInt num_elem, CeedVector assembled,
+                                                           CeedRequest *request) {
+  CeedScalar *assembled_array;
+
+  CeedCallBackend(CeedOperatorLinearAssembleQFunctionSetup_Opt(op));
+  CeedCallBackend(CeedVectorGetArrayWrite(assembled, CEED_MEM_HOST, &assembled_array));
+  CeedCallBackend(CeedOperatorLinearAssembleQFunctionRange_Opt(op, e_start, e_start + num_elem, assembled_array, request));
+  CeedCallBackend(CeedVectorRestoreArray(assembled, &assembled_array));
+  return CEED_ERROR_SUCCESS;
+}
 
-      // Check if active input
-      CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
-      is_active = vec == CEED_VECTOR_ACTIVE;
-      CeedCallBackend(CeedVectorDestroy(&vec));
-      if (!is_active) continue;
-      CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &field_size));
-      for (CeedInt field = 0; field < field_size; field++) {
-        // Set current portion of input to 1.0
-        {
-          CeedScalar *array;
-
-          CeedCallBackend(CeedVectorGetArray(impl->q_vecs_in[i], CEED_MEM_HOST, &array));
-          for (CeedInt j = 0; j < Q * block_size; j++) array[field * Q * block_size + j] = 1.0;
-          CeedCallBackend(CeedVectorRestoreArray(impl->q_vecs_in[i], &array));
-        }
+//------------------------------------------------------------------------------
+// Setup Composite Operator
+//------------------------------------------------------------------------------
+static int CeedCompositeOperatorSetup_Opt(CeedOperator op) {
+  bool                       is_setup_done;
+  CeedInt                    num_sub, num_rstr = 0, *num_uses, *last_use, *block_sizes;
+  CeedElemRestriction       *rstrs, *block_rstrs;
+  bool                      *is_out;
+  CeedOperator              *sub_operators;
+  CeedCompositeOperator_Opt *impl;
 
-        if (!impl->is_identity_qf) {
-          // Set Outputs
-          for (CeedInt out = 0; out < num_output_fields; out++) {
-            CeedVector vec;
-
-            // Check if active output
-            CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[out], &vec));
-            if (vec == CEED_VECTOR_ACTIVE) {
-              CeedInt field_size;
-
-              CeedCallBackend(CeedVectorSetArray(impl->q_vecs_out[out], CEED_MEM_HOST, CEED_USE_POINTER, l_vec_array));
-              CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[out], &field_size));
-              l_vec_array += field_size * Q * block_size;  // Advance the pointer by the size of the output
-            }
-            CeedCallBackend(CeedVectorDestroy(&vec));
-          }
-          // Apply QFunction
-          CeedCallBackend(CeedQFunctionApply(qf, Q * block_size, impl->q_vecs_in, impl->q_vecs_out));
-        } else {
-          CeedInt           field_size;
-          const CeedScalar *array;
-
-          // Copy Identity Outputs
-          CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[0], &field_size));
-          CeedCallBackend(CeedVectorGetArrayRead(impl->q_vecs_out[0], CEED_MEM_HOST, &array));
-          for (CeedInt j = 0; j < field_size * Q * block_size; j++) l_vec_array[j] = array[j];
-          CeedCallBackend(CeedVectorRestoreArrayRead(impl->q_vecs_out[0], &array));
-          l_vec_array += field_size * Q * block_size;
-        }
-        // Reset input to 0.0
-        {
-          CeedScalar *array;
+  CeedCallBackend(CeedOperatorIsSetupDone(op, &is_setup_done));
+  if (is_setup_done) return CEED_ERROR_SUCCESS;
 
-          CeedCallBackend(CeedVectorGetArray(impl->q_vecs_in[i], CEED_MEM_HOST, &array));
-          for (CeedInt j = 0; j < Q * block_size; j++) array[field * Q * block_size + j] = 0.0;
-          CeedCallBackend(CeedVectorRestoreArray(impl->q_vecs_in[i], &array));
-        }
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedCompositeOperatorGetNumSub(op, &num_sub));
+  CeedCallBackend(CeedCompositeOperatorGetSubList(op, &sub_operators));
+  CeedCallBackend(CeedCalloc(num_sub, &impl->is_fused));
+  CeedCallBackend(CeedMalloc(num_sub * 2 * CEED_FIELD_MAX, &impl->shared_indices));
+  CeedCallBackend(CeedCalloc(num_sub * 2 * CEED_FIELD_MAX, &rstrs));
+  CeedCallBackend(CeedCalloc(num_sub * 2 * CEED_FIELD_MAX, &block_rstrs));
+  CeedCallBackend(CeedCalloc(num_sub * 2 * CEED_FIELD_MAX, &block_sizes));
+  CeedCallBackend(CeedCalloc(num_sub * 2 * CEED_FIELD_MAX, &is_out));
+  CeedCallBackend(CeedCalloc(num_sub * 2 * CEED_FIELD_MAX, &num_uses));
+  CeedCallBackend(CeedCalloc(num_sub * 2 * CEED_FIELD_MAX, &last_use));
+  for (CeedInt i = 0; i < num_sub * 2 * CEED_FIELD_MAX; i++) impl->shared_indices[i] = -1;
+
+  // Count the suboperators using each active restriction, separately for inputs and outputs
+  for (CeedInt s = 0; s < num_sub; s++) {
+    CeedInt            num_elem;
+    CeedOperatorField *op_input_fields, *op_output_fields;
+    CeedOperator_Opt  *sub_impl;
+
+    // Only operators of this backend read and write shared E-vectors
+    CeedCallBackend(CeedOperatorGetNumElements(sub_operators[s], &num_elem));
+    if (num_elem == 0 || CeedOperatorReturnCeed(sub_operators[s]) != CeedOperatorReturnCeed(op)) continue;
+    CeedCallBackend(CeedOperatorSetup_Opt(sub_operators[s]));
+    CeedCallBackend(CeedOperatorGetData(sub_operators[s], &sub_impl));
+    if (sub_impl->is_identity_rstr_op) continue;
+    impl->is_fused[s] = true;
+    CeedCallBackend(CeedOperatorGetFields(sub_operators[s], NULL, &op_input_fields, NULL, &op_output_fields));
+
+    for (CeedInt i = 0; i < sub_impl->num_inputs + sub_impl->num_outputs; i++) {
+      const bool                       is_output = i >= sub_impl->num_inputs;
+      const CeedOperatorFieldInfo_Opt *field     = is_output ? &sub_impl->fields_out[i - sub_impl->num_inputs] : &sub_impl->fields_in[i];
+      CeedInt                          r         = 0;
+      CeedElemRestriction              rstr;
+
+      // Outputs without basis action are written by the QFunction, so they cannot be summed
+      if (!field->is_active || field->eval_mode == CEED_EVAL_WEIGHT || (is_output && field->eval_mode == CEED_EVAL_NONE)) continue;
+      CeedCallBackend(
+          CeedOperatorFieldGetElemRestriction(is_output ? op_output_fields[i - sub_impl->num_inputs] : op_input_fields[i], &rstr));
+      while (r < num_rstr && (rstrs[r] != rstr || is_out[r] != is_output || block_sizes[r] != sub_impl->block_size)) r++;
+      if (r == num_rstr) {
+        rstrs[r]       = rstr;
+        block_rstrs[r] = sub_impl->block_rstr[i];
+        block_sizes[r] = sub_impl->block_size;
+        is_out[r]      = is_output;
+        last_use[r]    = -1;
+        num_rstr++;
       }
+      CeedCallBackend(CeedElemRestrictionDestroy(&rstr));
+      if (last_use[r] != s) num_uses[r]++;
+      last_use[r]                                      = s;
+      impl->shared_indices[s * 2 * CEED_FIELD_MAX + i] = r;
     }
+  }
 
-    // Un-set output Qvecs to prevent accidental overwrite of Assembled
-    if (!impl->is_identity_qf) {
-      for (CeedInt out = 0; out < num_output_fields; out++) {
-        CeedVector vec;
-
-        // Check if active output
-        CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[out], &vec));
-        if (vec == CEED_VECTOR_ACTIVE && num_elem > 0) {
-          CeedCallBackend(CeedVectorTakeArray(impl->q_vecs_out[out], CEED_MEM_HOST, NULL));
-        }
-        CeedCallBackend(CeedVectorDestroy(&vec));
+  // Share blocked E-vectors for restrictions used by more than one suboperator
+  CeedCallBackend(CeedCalloc(num_rstr, &impl->shared_rstrs));
+  CeedCallBackend(CeedCalloc(num_rstr, &impl->shared_e_vecs));
+  CeedCallBackend(CeedCalloc(num_rstr, &impl->is_shared_out));
+  for (CeedInt r = 0; r < num_rstr; r++) {
+    if (num_uses[r] < 2) continue;
+    CeedCallBackend(CeedElemRestrictionReferenceCopy(block_rstrs[r], &impl->shared_rstrs[r]));
+    CeedCallBackend(CeedElemRestrictionCreateVector(block_rstrs[r], NULL, &impl->shared_e_vecs[r]));
+    impl->is_shared_out[r] = is_out[r];
+  }
+  impl->num_shared = num_rstr;
+
+  // Element block views of the shared E-vectors for each thread of the suboperators
+  for (CeedInt s = 0; s < num_sub; s++) {
+    CeedOperator_Opt *sub_impl;
+
+    if (!impl->is_fused[s]) continue;
+    CeedCallBackend(CeedOperatorGetData(sub_operators[s], &sub_impl));
+    for (CeedInt i = 0; i < sub_impl->num_inputs + sub_impl->num_outputs; i++) {
+      const bool    is_output    = i >= sub_impl->num_inputs;
+      const CeedInt f            = is_output ? i - sub_impl->num_inputs : i;
+      CeedInt      *shared_index = &impl->shared_indices[s * 2 * CEED_FIELD_MAX + i];
+
+      if (*shared_index < 0) continue;
+      if (!impl->shared_e_vecs[*shared_index]) {
+        *shared_index = -1;
+        continue;
+      }
+      if (!sub_impl->e_vecs_shared) CeedCallBackend(CeedCalloc(sub_impl->num_threads * 2 * CEED_FIELD_MAX, &sub_impl->e_vecs_shared));
+      for (CeedInt t = 0; t < sub_impl->num_threads; t++) {
+        CeedVector  e_vec  = is_output ? sub_impl->e_vecs_out[t * CEED_FIELD_MAX + f] : sub_impl->e_vecs_in[t * CEED_FIELD_MAX + f];
+        CeedVector *e_view = &sub_impl->e_vecs_shared[t * 2 * CEED_FIELD_MAX + (is_output ? CEED_FIELD_MAX : 0) + f];
+        CeedSize    e_size;
+
+        if (*e_view) continue;
+        CeedCallBackend(CeedVectorGetLength(e_vec, &e_size));
+        CeedCallBackend(CeedVectorCreate(CeedVectorReturnCeed(e_vec), e_size, e_view));
       }
     }
+  }
 
-    // Assemble into assembled vector
-    CeedCallBackend(CeedVectorRestoreArray(l_vec, &l_vec_array));
-    CeedCallBackend(CeedElemRestrictionApplyBlock(block_rstr, e / block_size, CEED_TRANSPOSE, l_vec, *assembled, request));
+  CeedCallBackend(CeedFree(&rstrs));
+  CeedCallBackend(CeedFree(&block_rstrs));
+  CeedCallBackend(CeedFree(&block_sizes));
+  CeedCallBackend(CeedFree(&is_out));
+  CeedCallBackend(CeedFree(&num_uses));
+  CeedCallBackend(CeedFree(&last_use));
+  CeedCallBackend(CeedOperatorSetSetupDone(op));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Composite Operator Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddComposite_Opt(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  bool                       is_profiling;
+  CeedInt                    num_sub;
+  double                     time, phase_times[CEED_OPERATOR_NUM_PHASES] = {0.0};
+  CeedScalar               **shared_data;
+  CeedOperator              *sub_operators;
+  CeedCompositeOperator_Opt *impl;
+
+  // Setup
+  CeedCallBackend(CeedCompositeOperatorSetup_Opt(op));
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedCompositeOperatorGetNumSub(op, &num_sub));
+  CeedCallBackend(CeedCompositeOperatorGetSubList(op, &sub_operators));
+  CeedCallBackend(CeedOperatorIsProfiling(op, &is_profiling));
+  if (is_profiling) CeedCallBackend(CeedOperatorProfileLap(&time, NULL));
+
+  // Restrict active input once for each shared restriction, zero shared outputs
+  CeedCallBackend(CeedCalloc(impl->num_shared, &shared_data));
+  for (CeedInt r = 0; r < impl->num_shared; r++) {
+    if (!impl->shared_e_vecs[r]) continue;
+    if (impl->is_shared_out[r]) {
+      CeedCallBackend(CeedVectorSetValue(impl->shared_e_vecs[r], 0.0));
+      CeedCallBackend(CeedVectorGetArray(impl->shared_e_vecs[r], CEED_MEM_HOST, &shared_data[r]));
+    } else {
+      CeedCallBackend(CeedElemRestrictionApply(impl->shared_rstrs[r], CEED_NOTRANSPOSE, in_vec, impl->shared_e_vecs[r], request));
+      CeedCallBackend(CeedVectorGetArrayRead(impl->shared_e_vecs[r], CEED_MEM_HOST, (const CeedScalar **)&shared_data[r]));
+    }
   }
 
-  // Reset output Qvecs
-  for (CeedInt out = 0; out < num_output_fields; out++) {
-    CeedVector vec;
+  if (is_profiling) CeedCallBackend(CeedOperatorProfileLap(&time, &phase_times[CEED_OPERATOR_PHASE_INPUT_RESTRICTION]));
 
-    // Initialize array if active output
-    CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[out], &vec));
-    if (vec == CEED_VECTOR_ACTIVE) CeedCallBackend(CeedVectorSetValue(impl->q_vecs_out[out], 0.0));
-    CeedCallBackend(CeedVectorDestroy(&vec));
+  // Apply suboperators, which profile themselves
+  for (CeedInt s = 0; s < num_sub; s++) {
+    if (impl->is_fused[s]) {
+      const CeedInt *shared_indices                     = &impl->shared_indices[s * 2 * CEED_FIELD_MAX];
+      CeedScalar    *e_data_shared[2 * CEED_FIELD_MAX] = {NULL};
+
+      for (CeedInt i = 0; i < 2 * CEED_FIELD_MAX; i++) {
+        if (shared_indices[i] >= 0) e_data_shared[i] = shared_data[shared_indices[i]];
+      }
+      CeedCallBackend(CeedOperatorApplyAddCore_Opt(sub_operators[s], in_vec, out_vec, e_data_shared, request));
+    } else {
+      CeedCallBackend(CeedOperatorApplyAdd(sub_operators[s], in_vec, out_vec, request));
+    }
   }
 
-  // Restore input arrays
-  CeedCallBackend(CeedOperatorRestoreInputs_Opt(num_input_fields, qf_input_fields, op_input_fields, e_data, impl));
-  CeedCallBackend(CeedDestroy(&ceed));
-  CeedCallBackend(CeedQFunctionDestroy(&qf));
+  if (is_profiling) CeedCallBackend(CeedOperatorProfileLap(&time, NULL));
+
+  // Sum shared outputs into the active output with one transpose restriction each
+  for (CeedInt r = 0; r < impl->num_shared; r++) {
+    if (!impl->shared_e_vecs[r]) continue;
+    if (impl->is_shared_out[r]) {
+      CeedCallBackend(CeedVectorRestoreArray(impl->shared_e_vecs[r], &shared_data[r]));
+      CeedCallBackend(CeedElemRestrictionApply(impl->shared_rstrs[r], CEED_TRANSPOSE, impl->shared_e_vecs[r], out_vec, request));
+    } else {
+      CeedCallBackend(CeedVectorRestoreArrayRead(impl->shared_e_vecs[r], (const CeedScalar **)&shared_data[r]));
+    }
+  }
+  CeedCallBackend(CeedFree(&shared_data));
+  if (is_profiling) {
+    CeedCallBackend(CeedOperatorProfileLap(&time, &phase_times[CEED_OPERATOR_PHASE_OUTPUT_RESTRICTION]));
+    CeedCallBackend(CeedOperatorAddProfile(op, phase_times));
+  }
   return CEED_ERROR_SUCCESS;
 }
 
 //------------------------------------------------------------------------------
-// Assemble Linear QFunction
+// Composite Operator Destroy
 //------------------------------------------------------------------------------
-static int CeedOperatorLinearAssembleQFunction_Opt(CeedOperator op, CeedVector *assembled, CeedElemRestriction *rstr, CeedRequest *request) {
-  return CeedOperatorLinearAssembleQFunctionCore_Opt(op, true, assembled, rstr, request);
-}
+static int CeedCompositeOperatorDestroy_Opt(CeedOperator op) {
+  CeedCompositeOperator_Opt *impl;
 
-//------------------------------------------------------------------------------
-// Update Assembled Linear QFunction
-//------------------------------------------------------------------------------
-static int CeedOperatorLinearAssembleQFunctionUpdate_Opt(CeedOperator op, CeedVector assembled, CeedElemRestriction rstr, CeedRequest *request) {
-  return CeedOperatorLinearAssembleQFunctionCore_Opt(op, false, &assembled, &rstr, request);
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  for (CeedInt r = 0; r < impl->num_shared; r++) {
+    CeedCallBackend(CeedElemRestrictionDestroy(&impl->shared_rstrs[r]));
+    CeedCallBackend(CeedVectorDestroy(&impl->shared_e_vecs[r]));
+  }
+  CeedCallBackend(CeedFree(&impl->shared_rstrs));
+  CeedCallBackend(CeedFree(&impl->shared_e_vecs));
+  CeedCallBackend(CeedFree(&impl->is_shared_out));
+  CeedCallBackend(CeedFree(&impl->shared_indices));
+  CeedCallBackend(CeedFree(&impl->is_fused));
+  CeedCallBackend(CeedFree(&impl));
+  return CEED_ERROR_SUCCESS;
 }
 
 //------------------------------------------------------------------------------
@@ -753,27 +1488,64 @@ static int CeedOperatorDestroy_Opt(CeedOperator op) {
   CeedCallBackend(CeedFree(&impl->block_rstr));
   CeedCallBackend(CeedFree(&impl->e_vecs_full));
   CeedCallBackend(CeedFree(&impl->input_states));
+  for (CeedInt i = 0; i < impl->num_inputs; i++) CeedCallBackend(CeedFree(&impl->e_data_fp32[i]));
+  CeedCallBackend(CeedFree(&impl->e_data_fp32));
   CeedCallBackend(CeedFree(&impl->skip_rstr_in));
   CeedCallBackend(CeedFree(&impl->skip_rstr_out));
   CeedCallBackend(CeedFree(&impl->apply_add_basis_out));
 
-  for (CeedInt i = 0; i < impl->num_inputs; i++) {
-    CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_in[i]));
-    CeedCallBackend(CeedVectorDestroy(&impl->q_vecs_in[i]));
+  for (CeedInt i = 0; i < impl->num_inputs; i++) CeedCallBackend(CeedBasisDestroy(&impl->fields_in[i].basis));
+  for (CeedInt i = 0; i < impl->num_outputs; i++) CeedCallBackend(CeedBasisDestroy(&impl->fields_out[i].basis));
+  CeedCallBackend(CeedFree(&impl->fields_in));
+  CeedCallBackend(CeedFree(&impl->fields_out));
+
+  for (CeedInt t = 0; t < impl->num_threads; t++) {
+    for (CeedInt i = 0; i < impl->num_inputs; i++) {
+      CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_in[t * CEED_FIELD_MAX + i]));
+      CeedCallBackend(CeedVectorDestroy(&impl->q_vecs_in[t * CEED_FIELD_MAX + i]));
+    }
   }
   CeedCallBackend(CeedFree(&impl->e_vecs_in));
   CeedCallBackend(CeedFree(&impl->q_vecs_in));
 
-  for (CeedInt i = 0; i < impl->num_outputs; i++) {
-    CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_out[i]));
-    CeedCallBackend(CeedVectorDestroy(&impl->q_vecs_out[i]));
+  for (CeedInt t = 0; t < impl->num_threads; t++) {
+    for (CeedInt i = 0; i < impl->num_outputs; i++) {
+      CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_out[t * CEED_FIELD_MAX + i]));
+      CeedCallBackend(CeedVectorDestroy(&impl->q_vecs_out[t * CEED_FIELD_MAX + i]));
+    }
   }
   CeedCallBackend(CeedFree(&impl->e_vecs_out));
   CeedCallBackend(CeedFree(&impl->q_vecs_out));
 
+  // Views of E-vectors shared by composite operators
+  if (impl->e_vecs_shared) {
+    for (CeedInt i = 0; i < impl->num_threads * 2 * CEED_FIELD_MAX; i++) CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_shared[i]));
+  }
+  CeedCallBackend(CeedFree(&impl->e_vecs_shared));
+  CeedCallBackend(CeedFree(&impl->thread_phase_times));
+
+  // Threaded element loop data
+  if (impl->l_vecs_in) {
+    for (CeedInt t = 0; t < impl->num_threads; t++) {
+      for (CeedInt i = 0; i < impl->num_inputs; i++) CeedCallBackend(CeedVectorDestroy(&impl->l_vecs_in[t * CEED_FIELD_MAX + i]));
+      for (CeedInt i = 0; i < impl->num_outputs; i++) CeedCallBackend(CeedVectorDestroy(&impl->l_vecs_out[t * CEED_FIELD_MAX + i]));
+    }
+  }
+  CeedCallBackend(CeedFree(&impl->l_vecs_in));
+  CeedCallBackend(CeedFree(&impl->l_vecs_out));
+  CeedCallBackend(CeedFree(&impl->color_offsets));
+  CeedCallBackend(CeedFree(&impl->color_blocks));
+
   // QFunction assembly data
-  CeedCallBackend(CeedVectorDestroy(&impl->qf_l_vec));
-  CeedCallBackend(CeedElemRestrictionDestroy(&impl->qf_block_rstr));
+  if (impl->qf_batch_in) {
+    for (CeedInt t = 0; t < impl->num_threads; t++) {
+      for (CeedInt i = 0; i < impl->num_inputs; i++) CeedCallBackend(CeedVectorDestroy(&impl->qf_batch_in[t * CEED_FIELD_MAX + i]));
+      for (CeedInt i = 0; i < impl->num_outputs; i++) CeedCallBackend(CeedVectorDestroy(&impl->qf_batch_out[t * CEED_FIELD_MAX + i]));
+    }
+  }
+  CeedCallBackend(CeedFree(&impl->qf_batch_in));
+  CeedCallBackend(CeedFree(&impl->qf_batch_out));
+  CeedCallBackend(CeedQFunctionJitDestroy_Opt(&impl->jit_module));
 
   CeedCallBackend(CeedFree(&impl));
   return CEED_ERROR_SUCCESS;
@@ -794,9 +1566,11 @@ int CeedOperatorCreate_Opt(CeedOperator op) {
   CeedCallBackend(CeedCalloc(1, &impl));
   CeedCallBackend(CeedOperatorSetData(op, impl));
 
-  CeedCheck(block_size == 1 || block_size == 8, ceed, CEED_ERROR_BACKEND, "Opt backend cannot use blocksize: %" CeedInt_FMT, block_size);
+  CeedCheck(block_size == 1 || block_size == 4 || block_size == 8 || block_size == 16 || block_size == 32, ceed, CEED_ERROR_BACKEND,
+            "Opt backend cannot use blocksize: %" CeedInt_FMT, block_size);
 
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunction", CeedOperatorLinearAssembleQFunction_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunctionElements", CeedOperatorLinearAssembleQFunctionElements_Opt));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunctionUpdate", CeedOperatorLinearAssembleQFunctionUpdate_Opt));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd", CeedOperatorApplyAdd_Opt));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "Destroy", CeedOperatorDestroy_Opt));
@@ -805,3 +1579,19 @@ int CeedOperatorCreate_Opt(CeedOperator op) {
 }
 
 //------------------------------------------------------------------------------
+// Composite Operator Create
+//------------------------------------------------------------------------------
+int CeedCompositeOperatorCreate_Opt(CeedOperator op) {
+  Ceed                       ceed;
+  CeedCompositeOperator_Opt *impl;
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedCalloc(1, &impl));
+  CeedCallBackend(CeedOperatorSetData(op, impl));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddComposite", CeedOperatorApplyAddComposite_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "Destroy", CeedCompositeOperatorDestroy_Opt));
+  CeedCallBackend(CeedDestroy(&ceed));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,280 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#define _DEFAULT_SOURCE
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <dirent.h>
+#include <dlfcn.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <spawn.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "ceed-opt.h"
+
+extern char **environ;
+
+// Compiler flags for JiT QFunctions, the compiler is taken from CEED_OPT_JIT_CC, then CC, then cc
+#define CEED_OPT_JIT_CFLAGS "-O3 -march=native -ffp-contract=fast -fPIC -shared -w"
+#define CEED_OPT_JIT_ENTRY "CeedJitQFunction_Opt"
+// Number of compiled QFunctions kept in the cache, least recently used libraries are removed past this
+#define CEED_OPT_JIT_CACHE_MAX 64
+
+//------------------------------------------------------------------------------
+// FNV-1a hash of a string, continuing from a previous hash
+//------------------------------------------------------------------------------
+static uint64_t CeedJitHash_Opt(uint64_t hash, const char *str) {
+  for (const unsigned char *c = (const unsigned char *)str; *c; c++) hash = (hash ^ *c) * 1099511628211ULL;
+  return hash;
+}
+
+//------------------------------------------------------------------------------
+// Write the JiT source, with Q and, for read-only contexts if allowed, the context data as compile time constants
+//------------------------------------------------------------------------------
+static int CeedQFunctionJitSource_Opt(CeedQFunction qf, CeedInt Q, bool allow_ctx_constant, const char *source_buffer, char **source,
+                                      bool *is_ctx_constant) {
+  const char          *kernel_name;
+  size_t               source_len;
+  FILE                *stream;
+  CeedQFunctionContext ctx;
+
+  CeedCallBackend(CeedQFunctionGetKernelName(qf, &kernel_name));
+  CeedCallBackend(CeedQFunctionGetContext(qf, &ctx));
+  *is_ctx_constant = false;
+  if (ctx && allow_ctx_constant) {
+    bool is_writable;
+
+    CeedCallBackend(CeedQFunctionIsContextWritable(qf, &is_writable));
+    *is_ctx_constant = !is_writable;
+  }
+
+  stream = open_memstream(source, &source_len);
+  CeedCheck(stream, CeedQFunctionReturnCeed(qf), CEED_ERROR_BACKEND, "Could not create JiT source stream");
+  fprintf(stream, "#include <math.h>\n#include <stdbool.h>\n#include <stddef.h>\n#include <stdint.h>\n\n");
+  fprintf(stream, "#define CEED_Q_VLA %" CeedInt_FMT "\n\n%s\n\n", Q, source_buffer);
+  if (*is_ctx_constant) {
+    size_t               ctx_size;
+    const unsigned char *ctx_data;
+
+    // Context data, so loads of context fields fold into constants
+    CeedCallBackend(CeedQFunctionContextGetContextSize(ctx, &ctx_size));
+    CeedCallBackend(CeedQFunctionContextGetDataRead(ctx, CEED_MEM_HOST, &ctx_data));
+    fprintf(stream, "static const unsigned char ceed_jit_ctx[%zu] __attribute__((aligned(64))) = {", ctx_size ? ctx_size : 1);
+    for (size_t i = 0; i < ctx_size; i++) fprintf(stream, "%s%u", i ? "," : "", ctx_data[i]);
+    fprintf(stream, "};\n\n");
+    CeedCallBackend(CeedQFunctionContextRestoreDataRead(ctx, &ctx_data));
+  }
+  fprintf(stream, "int " CEED_OPT_JIT_ENTRY "(void *ctx, const CeedInt Q, const CeedScalar *const *in, CeedScalar *const *out) {\n");
+  fprintf(stream, "  return %s(%s, %" CeedInt_FMT ", in, out);\n}\n", kernel_name, *is_ctx_constant ? "(void *)ceed_jit_ctx" : "ctx", Q);
+  fclose(stream);
+  CeedCallBackend(CeedQFunctionContextDestroy(&ctx));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Libraries in the cache are loaded, so the cache must be a directory, not a link, that only the user can access
+//------------------------------------------------------------------------------
+static bool CeedJitIsCacheDirSafe_Opt(const char *cache_dir) {
+  struct stat dir_stat;
+
+  return !lstat(cache_dir, &dir_stat) && S_ISDIR(dir_stat.st_mode) && dir_stat.st_uid == getuid() && (dir_stat.st_mode & 0777) == 0700;
+}
+
+//------------------------------------------------------------------------------
+// Run the compiler, without a shell, so paths and defines are passed verbatim
+//------------------------------------------------------------------------------
+static bool CeedJitRun_Opt(char **args) {
+  int   status;
+  pid_t pid;
+
+  if (posix_spawnp(&pid, args[0], NULL, NULL, args, environ)) return false;
+  while (waitpid(pid, &status, 0) < 0) {
+    if (errno != EINTR) return false;
+  }
+  return WIFEXITED(status) && !WEXITSTATUS(status);
+}
+
+//------------------------------------------------------------------------------
+// Compile to a process specific name and rename, so concurrent processes never load a partial library
+//------------------------------------------------------------------------------
+static bool CeedJitCompile_Opt(Ceed ceed, const char *cache_dir, uint64_t hash, const char *source, char **args, CeedInt num_args,
+                               const char *library_path) {
+  bool  is_built;
+  char  source_path[FILENAME_MAX], temp_path[FILENAME_MAX];
+  FILE *source_file;
+
+  if (snprintf(source_path, sizeof(source_path), "%s/ceed-opt-jit-%016" PRIx64 "-%ld.c", cache_dir, hash, (long)getpid()) >= FILENAME_MAX ||
+      snprintf(temp_path, sizeof(temp_path), "%s/ceed-opt-jit-%016" PRIx64 "-%ld.so", cache_dir, hash, (long)getpid()) >= FILENAME_MAX) {
+    return false;
+  }
+  source_file = fopen(source_path, "w");
+  if (!source_file) return false;
+  fputs(source, source_file);
+  fclose(source_file);
+
+  args[num_args++] = "-o";
+  args[num_args++] = temp_path;
+  args[num_args++] = source_path;
+  args[num_args++] = "-lm";
+  CeedDebug256(ceed, CEED_DEBUG_COLOR_SUCCESS, "---------- Compiling JiT QFunction ----------\n");
+  CeedDebug(ceed, "%s -o %s %s\n", args[0], temp_path, source_path);
+  is_built = CeedJitRun_Opt(args) && !rename(temp_path, library_path);
+  remove(source_path);
+  if (!is_built) remove(temp_path);
+  return is_built;
+}
+
+//------------------------------------------------------------------------------
+// Remove the least recently used libraries past the cache limit, other than the library about to be loaded
+//   Libraries already loaded stay mapped in the processes using them
+//------------------------------------------------------------------------------
+static void CeedJitEvictCache_Opt(Ceed ceed, const char *cache_dir, const char *library_path) {
+  char           path[FILENAME_MAX];
+  struct dirent *entry;
+  DIR           *dir;
+
+  while ((dir = opendir(cache_dir))) {
+    char    oldest[FILENAME_MAX] = "";
+    time_t  oldest_time          = 0;
+    CeedInt num_libraries        = 0;
+
+    while ((entry = readdir(dir))) {
+      struct stat lib_stat;
+      size_t      name_len = strlen(entry->d_name);
+
+      // Only complete libraries, ceed-opt-jit-<hash>.so, not the process specific files of a compile in progress
+      if (name_len != strlen("ceed-opt-jit-") + 16 + strlen(".so") || strncmp(entry->d_name, "ceed-opt-jit-", 13) ||
+          strcmp(entry->d_name + name_len - 3, ".so")) {
+        continue;
+      }
+      if (snprintf(path, sizeof(path), "%s/%s", cache_dir, entry->d_name) >= FILENAME_MAX || !strcmp(path, library_path) || lstat(path, &lib_stat)) {
+        continue;
+      }
+      num_libraries++;
+      if (!oldest[0] || lib_stat.st_mtime < oldest_time) {
+        snprintf(oldest, sizeof(oldest), "%s", path);
+        oldest_time = lib_stat.st_mtime;
+      }
+    }
+    closedir(dir);
+    // The library about to be loaded is one of the libraries kept
+    if (num_libraries < CEED_OPT_JIT_CACHE_MAX || remove(oldest)) break;
+    CeedDebug(ceed, "Removed JiT QFunction from cache: %s\n", oldest);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Compile the source to a shared library in the cache, unless it is already there
+//------------------------------------------------------------------------------
+static int CeedQFunctionJitBuild_Opt(Ceed ceed, const char *source, char *library_path, size_t max_path_len, bool *is_built) {
+  char         cache_dir[FILENAME_MAX], cc[FILENAME_MAX], cflags[] = CEED_OPT_JIT_CFLAGS;
+  char       **args, *token;
+  const char  *cc_env = getenv("CEED_OPT_JIT_CC"), *dir = getenv("CEED_OPT_JIT_CACHE_DIR"), **jit_defines;
+  uint64_t     hash = 14695981039346656037ULL;
+  int          len;
+  CeedInt      num_args = 0, num_jit_defines;
+
+  *is_built = false;
+  if (!cc_env) cc_env = getenv("CC");
+  if (!cc_env) cc_env = "cc";
+  if (dir) {
+    len = snprintf(cache_dir, sizeof(cache_dir), "%s", dir);
+  } else {
+    const char *tmp_dir = getenv("TMPDIR");
+
+    len = snprintf(cache_dir, sizeof(cache_dir), "%s/libceed-jit-%u", tmp_dir ? tmp_dir : "/tmp", (unsigned)getuid());
+  }
+  if (len < 0 || (size_t)len >= sizeof(cache_dir)) return CEED_ERROR_SUCCESS;
+  if (mkdir(cache_dir, 0700) && errno != EEXIST) return CEED_ERROR_SUCCESS;
+  if (!CeedJitIsCacheDirSafe_Opt(cache_dir)) {
+    CeedDebug256(ceed, CEED_DEBUG_COLOR_WARNING, "JiT cache %s is not a directory with mode 0700 owned by the user\n", cache_dir);
+    return CEED_ERROR_SUCCESS;
+  }
+  len = snprintf(cc, sizeof(cc), "%s", cc_env);
+  if (len < 0 || (size_t)len >= sizeof(cc) || !cc[strspn(cc, " ")]) return CEED_ERROR_SUCCESS;
+
+  // Compiler arguments, with user JiT defines, keyed into the hash along with the source
+  CeedCallBackend(CeedGetJitDefines(ceed, &num_jit_defines, &jit_defines));
+  CeedCallBackend(CeedCalloc(strlen(cc) + sizeof(cflags) + 2 * num_jit_defines + 6, &args));
+  for (char *arg = strtok_r(cc, " ", &token); arg; arg = strtok_r(NULL, " ", &token)) args[num_args++] = arg;
+  for (char *arg = strtok_r(cflags, " ", &token); arg; arg = strtok_r(NULL, " ", &token)) args[num_args++] = arg;
+  for (CeedInt i = 0; i < num_jit_defines; i++) {
+    args[num_args++] = "-D";
+    args[num_args++] = (char *)jit_defines[i];
+  }
+  for (CeedInt i = 0; i < num_args; i++) hash = CeedJitHash_Opt(CeedJitHash_Opt(hash, args[i]), " ");
+  hash = CeedJitHash_Opt(hash, source);
+  len  = snprintf(library_path, max_path_len, "%s/ceed-opt-jit-%016" PRIx64 ".so", cache_dir, hash);
+  if (len >= 0 && (size_t)len < max_path_len) {
+    if (!access(library_path, R_OK)) {
+      CeedDebug(ceed, "Using cached JiT QFunction: %s\n", library_path);
+      // Mark as recently used, so eviction removes the libraries not used for longest
+      utimensat(AT_FDCWD, library_path, NULL, 0);
+      *is_built = true;
+    } else {
+      *is_built = CeedJitCompile_Opt(ceed, cache_dir, hash, source, args, num_args, library_path);
+      if (*is_built) CeedJitEvictCache_Opt(ceed, cache_dir, library_path);
+    }
+  }
+  CeedCallBackend(CeedFree(&args));
+  CeedCallBackend(CeedRestoreJitDefines(ceed, &jit_defines));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// JiT compile a QFunction from its source for a fixed number of quadrature points
+//------------------------------------------------------------------------------
+int CeedQFunctionJitCompile_Opt(CeedQFunction qf, CeedInt Q, bool allow_ctx_constant, void **module, CeedQFunctionUser *f, bool *is_ctx_constant) {
+  bool        is_built, is_fortran;
+  char        library_path[FILENAME_MAX];
+  char       *source;
+  const char *source_buffer;
+  Ceed        ceed;
+
+  *module          = NULL;
+  *f               = NULL;
+  *is_ctx_constant = false;
+  // Fortran QFunctions are called through a C stub with a wrapping context, so the named C source is not the user function
+  CeedCallBackend(CeedQFunctionGetFortranStatus(qf, &is_fortran));
+  if (is_fortran) return CEED_ERROR_SUCCESS;
+  CeedCallBackend(CeedQFunctionLoadSourceToBuffer(qf, &source_buffer));
+  if (!source_buffer) return CEED_ERROR_SUCCESS;
+  CeedCallBackend(CeedQFunctionJitSource_Opt(qf, Q, allow_ctx_constant, source_buffer, &source, is_ctx_constant));
+  CeedCallBackend(CeedFree(&source_buffer));
+
+  CeedCallBackend(CeedQFunctionGetCeed(qf, &ceed));
+  CeedCallBackend(CeedQFunctionJitBuild_Opt(ceed, source, library_path, sizeof(library_path), &is_built));
+  free(source);
+  if (is_built) *module = dlopen(library_path, RTLD_NOW | RTLD_LOCAL);
+  if (*module) *(void **)f = dlsym(*module, CEED_OPT_JIT_ENTRY);
+  if (!*f) {
+    // Fall back to the user function
+    CeedDebug256(ceed, CEED_DEBUG_COLOR_WARNING, "JiT QFunction unavailable, using the user function\n");
+    CeedCallBackend(CeedQFunctionJitDestroy_Opt(module));
+  }
+  CeedCallBackend(CeedDestroy(&ceed));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// JiT Destroy
+//------------------------------------------------------------------------------
+int CeedQFunctionJitDestroy_Opt(void **module) {
+  if (*module) dlclose(*module);
+  *module = NULL;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
@@ -8,6 +8,7 @@
 #include <ceed.h>
 #include <ceed/backend.h>
 #include <stdbool.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "ceed-opt.h"
@@ -29,9 +30,12 @@ static int CeedDestroy_Opt(Ceed ceed) {
 static int CeedInit_Opt_Serial(const char *resource, Ceed ceed) {
   Ceed      ceed_ref;
   Ceed_Opt *data;
+  char     *resource_root;
 
-  CeedCheck(!strcmp(resource, "/cpu/self") || !strcmp(resource, "/cpu/self/opt/serial"), ceed, CEED_ERROR_BACKEND,
+  CeedCallBackend(CeedGetResourceRoot(ceed, resource, ":", &resource_root));
+  CeedCheck(!strcmp(resource_root, "/cpu/self") || !strcmp(resource_root, "/cpu/self/opt/serial"), ceed, CEED_ERROR_BACKEND,
             "Opt backend cannot use resource: %s", resource);
+  CeedCallBackend(CeedFree(&resource_root));
   CeedCallBackend(CeedSetDeterministic(ceed, true));
 
   // Create reference Ceed that implementation will be dispatched through unless overridden
@@ -40,12 +44,36 @@ static int CeedInit_Opt_Serial(const char *resource, Ceed ceed) {
   CeedCallBackend(CeedDestroy(&ceed_ref));
 
   CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "Destroy", CeedDestroy_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "VectorCreate", CeedVectorCreate_Opt));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "TensorContractCreate", CeedTensorContractCreate_Opt));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "OperatorCreate", CeedOperatorCreate_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "CompositeOperatorCreate", CeedCompositeOperatorCreate_Opt));
 
-  // Set block size
+  // Set block size, number of threads, huge page use, mixed precision, and QFunction JiT
   CeedCallBackend(CeedCalloc(1, &data));
-  data->block_size = 1;
+  data->block_size  = 1;
+  data->num_threads = 1;
+  {
+    const char *threads_spec = strstr(resource, ":threads=");
+
+    if (threads_spec) data->num_threads = atoi(threads_spec + strlen(":threads="));
+  }
+  CeedCheck(data->num_threads > 0, ceed, CEED_ERROR_BACKEND, "Opt backend cannot use %" CeedInt_FMT " threads", data->num_threads);
+  {
+    const char *huge_pages_spec = strstr(resource, ":huge_pages=");
+
+    if (huge_pages_spec) data->use_huge_pages = atoi(huge_pages_spec + strlen(":huge_pages="));
+  }
+  {
+    const char *mixed_precision_spec = strstr(resource, ":mixed_precision=");
+
+    if (mixed_precision_spec) data->use_mixed_precision = atoi(mixed_precision_spec + strlen(":mixed_precision="));
+  }
+  {
+    const char *jit_spec = strstr(resource, ":jit=");
+
+    if (jit_spec) data->use_jit = atoi(jit_spec + strlen(":jit="));
+  }
   CeedCallBackend(CeedSetData(ceed, data));
   return CEED_ERROR_SUCCESS;
 }
@@ -34,6 +34,73 @@ static inline int CeedTensorContractApply_Core_Opt(CeedTensorContract contract,
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Tensor Contract with element block widths as a fixed trip count on the innermost loop
+//------------------------------------------------------------------------------
+#define CEED_OPT_TENSOR_APPLY_WIDTH(contract, A, B, C, J, t, t_mode, add, u, v)             \
+  switch (C) {                                                                              \
+    case 1:                                                                                 \
+      return CeedTensorContractApply_Core_Opt(contract, A, B, 1, J, t, t_mode, add, u, v);  \
+    case 4:                                                                                 \
+      return CeedTensorContractApply_Core_Opt(contract, A, B, 4, J, t, t_mode, add, u, v);  \
+    case 8:                                                                                 \
+      return CeedTensorContractApply_Core_Opt(contract, A, B, 8, J, t, t_mode, add, u, v);  \
+    case 16:                                                                                \
+      return CeedTensorContractApply_Core_Opt(contract, A, B, 16, J, t, t_mode, add, u, v); \
+    case 32:                                                                                \
+      return CeedTensorContractApply_Core_Opt(contract, A, B, 32, J, t, t_mode, add, u, v); \
+    default:                                                                                \
+      return CeedTensorContractApply_Core_Opt(contract, A, B, C, J, t, t_mode, add, u, v);  \
+  }
+
+//------------------------------------------------------------------------------
+// Tensor Contract kernels with contracted and output sizes, and block widths, fixed at compile time
+//------------------------------------------------------------------------------
+#define CEED_OPT_TENSOR_FIXED_MIN 2
+#define CEED_OPT_TENSOR_FIXED_MAX 10
+#define CEED_OPT_TENSOR_FIXED_NUM (CEED_OPT_TENSOR_FIXED_MAX - CEED_OPT_TENSOR_FIXED_MIN + 1)
+
+typedef int (*CeedTensorContractApplyFixed_Opt)(CeedInt A, CeedInt C, const CeedScalar *restrict t, CeedTransposeMode t_mode, const CeedInt add,
+                                                const CeedScalar *restrict u, CeedScalar *restrict v);
+
+// Flattened, so the core loop is inlined for each block width
+#define CEED_OPT_TENSOR_FIXED_KERNEL(B, J)                                                                                       \
+  CEED_QFUNCTION_ATTR static int CeedTensorContractApply_##B##_##J##_Opt(CeedInt A, CeedInt C, const CeedScalar *restrict t,     \
+                                                                         CeedTransposeMode t_mode, const CeedInt add,            \
+                                                                         const CeedScalar *restrict u, CeedScalar *restrict v) { \
+    CEED_OPT_TENSOR_APPLY_WIDTH(NULL, A, B, C, J, t, t_mode, add, u, v)                                                          \
+  }
+#define CEED_OPT_TENSOR_FIXED_KERNELS(B) \
+  CEED_OPT_TENSOR_FIXED_KERNEL(B, 2)     \
+  CEED_OPT_TENSOR_FIXED_KERNEL(B, 3)     \
+  CEED_OPT_TENSOR_FIXED_KERNEL(B, 4)     \
+  CEED_OPT_TENSOR_FIXED_KERNEL(B, 5)     \
+  CEED_OPT_TENSOR_FIXED_KERNEL(B, 6)     \
+  CEED_OPT_TENSOR_FIXED_KERNEL(B, 7)     \
+  CEED_OPT_TENSOR_FIXED_KERNEL(B, 8)     \
+  CEED_OPT_TENSOR_FIXED_KERNEL(B, 9)     \
+  CEED_OPT_TENSOR_FIXED_KERNEL(B, 10)
+#define CEED_OPT_TENSOR_FIXED_ROW(B)                                                                               \
+  {CeedTensorContractApply_##B##_2_Opt, CeedTensorContractApply_##B##_3_Opt, CeedTensorContractApply_##B##_4_Opt,  \
+   CeedTensorContractApply_##B##_5_Opt, CeedTensorContractApply_##B##_6_Opt, CeedTensorContractApply_##B##_7_Opt,  \
+   CeedTensorContractApply_##B##_8_Opt, CeedTensorContractApply_##B##_9_Opt, CeedTensorContractApply_##B##_10_Opt}
+
+CEED_OPT_TENSOR_FIXED_KERNELS(2)
+CEED_OPT_TENSOR_FIXED_KERNELS(3)
+CEED_OPT_TENSOR_FIXED_KERNELS(4)
+CEED_OPT_TENSOR_FIXED_KERNELS(5)
+CEED_OPT_TENSOR_FIXED_KERNELS(6)
+CEED_OPT_TENSOR_FIXED_KERNELS(7)
+CEED_OPT_TENSOR_FIXED_KERNELS(8)
+CEED_OPT_TENSOR_FIXED_KERNELS(9)
+CEED_OPT_TENSOR_FIXED_KERNELS(10)
+
+// Indexed by [B - CEED_OPT_TENSOR_FIXED_MIN][J - CEED_OPT_TENSOR_FIXED_MIN]
+static const CeedTensorContractApplyFixed_Opt fixed_kernels[CEED_OPT_TENSOR_FIXED_NUM][CEED_OPT_TENSOR_FIXED_NUM] = {
+    CEED_OPT_TENSOR_FIXED_ROW(2), CEED_OPT_TENSOR_FIXED_ROW(3), CEED_OPT_TENSOR_FIXED_ROW(4), CEED_OPT_TENSOR_FIXED_ROW(5),
+    CEED_OPT_TENSOR_FIXED_ROW(6), CEED_OPT_TENSOR_FIXED_ROW(7), CEED_OPT_TENSOR_FIXED_ROW(8), CEED_OPT_TENSOR_FIXED_ROW(9),
+    CEED_OPT_TENSOR_FIXED_ROW(10)};
+
 //------------------------------------------------------------------------------
 // Tensor Contract Apply
 //------------------------------------------------------------------------------
@@ -43,9 +110,12 @@ static int CeedTensorContractApply_Opt(CeedTensorContract contract, CeedInt A, C
     for (CeedInt q = 0; q < A * J * C; q++) v[q] = (CeedScalar)0.0;
   }
 
-  if (C == 1) return CeedTensorContractApply_Core_Opt(contract, A, B, 1, J, t, t_mode, add, u, v);
-  else return CeedTensorContractApply_Core_Opt(contract, A, B, C, J, t, t_mode, add, u, v);
-  return CEED_ERROR_SUCCESS;
+  // Specialized kernels for common 1D basis sizes, with unrolled loops over the contracted and output directions
+  if (B >= CEED_OPT_TENSOR_FIXED_MIN && B <= CEED_OPT_TENSOR_FIXED_MAX && J >= CEED_OPT_TENSOR_FIXED_MIN && J <= CEED_OPT_TENSOR_FIXED_MAX) {
+    return fixed_kernels[B - CEED_OPT_TENSOR_FIXED_MIN][J - CEED_OPT_TENSOR_FIXED_MIN](A, C, t, t_mode, add, u, v);
+  }
+
+  CEED_OPT_TENSOR_APPLY_WIDTH(contract, A, B, C, J, t, t_mode, add, u, v)
 }
 
 //------------------------------------------------------------------------------
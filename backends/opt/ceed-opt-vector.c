@@ -0,0 +1,434 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+// Expose posix_memalign and madvise
+#define _DEFAULT_SOURCE
+
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "../ref/ceed-ref.h"
+#include "ceed-opt.h"
+
+// Vector entries are processed in fixed size chunks so reductions are summed in the same order for any number of threads
+#define CEED_OPT_VECTOR_CHUNK_SIZE 4096
+
+//------------------------------------------------------------------------------
+// Get number of threads for vector operations
+//------------------------------------------------------------------------------
+static int CeedVectorGetNumThreads_Opt(CeedVector vec, CeedSize length, CeedInt *num_threads) {
+  Ceed      ceed;
+  Ceed_Opt *ceed_impl;
+
+  CeedCallBackend(CeedVectorGetCeed(vec, &ceed));
+  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
+  CeedCallBackend(CeedDestroy(&ceed));
+  // Small vectors are not worth waking the thread team
+  *num_threads = length > CEED_OPT_VECTOR_CHUNK_SIZE ? ceed_impl->num_threads : 1;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// End of chunk starting at start
+//------------------------------------------------------------------------------
+static inline CeedSize CeedVectorChunkStop_Opt(CeedSize start, CeedSize length) {
+  return start + CEED_OPT_VECTOR_CHUNK_SIZE < length ? start + CEED_OPT_VECTOR_CHUNK_SIZE : length;
+}
+
+//------------------------------------------------------------------------------
+// Reduce chunk norms
+//------------------------------------------------------------------------------
+static inline CeedScalar CeedVectorNormChunk_Opt(const CeedScalar *array, CeedSize start, CeedSize stop, CeedNormType norm_type) {
+  CeedScalar norm = 0.0;
+
+  switch (norm_type) {
+    case CEED_NORM_1:
+      CeedPragmaSIMD for (CeedSize i = start; i < stop; i++) norm += fabs(array[i]);
+      break;
+    case CEED_NORM_2:
+      CeedPragmaSIMD for (CeedSize i = start; i < stop; i++) norm += array[i] * array[i];
+      break;
+    case CEED_NORM_MAX:
+      for (CeedSize i = start; i < stop; i++) norm = fmax(norm, fabs(array[i]));
+      break;
+  }
+  return norm;
+}
+
+static inline CeedScalar CeedVectorNormReduce_Opt(const CeedScalar *chunk_norms, CeedSize num_chunks, CeedNormType norm_type) {
+  CeedScalar norm = 0.0;
+
+  for (CeedSize c = 0; c < num_chunks; c++) norm = norm_type == CEED_NORM_MAX ? fmax(norm, chunk_norms[c]) : norm + chunk_norms[c];
+  return norm_type == CEED_NORM_2 ? sqrt(norm) : norm;
+}
+
+//------------------------------------------------------------------------------
+// Allocate array, without touching the pages
+//------------------------------------------------------------------------------
+static int CeedVectorAllocateArray_Opt(CeedVector vec, CeedSize length, CeedScalar **array) {
+  const size_t bytes = (size_t)length * sizeof(CeedScalar);
+  Ceed         ceed = CeedVectorReturnCeed(vec);
+  Ceed_Opt    *ceed_impl;
+
+  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
+  if (ceed_impl->use_huge_pages && bytes >= CEED_OPT_HUGE_PAGE_SIZE) {
+    // Aligned to the huge page size so the kernel can back the whole array with huge pages
+    int ierr = posix_memalign((void **)array, CEED_OPT_HUGE_PAGE_SIZE, bytes);
+
+    CeedCheck(ierr == 0, ceed, CEED_ERROR_MAJOR, "posix_memalign failed to allocate %zd bytes aligned to huge pages", bytes);
+#ifdef MADV_HUGEPAGE
+    // Advisory only, allocation stays valid with regular pages if this fails
+    madvise(*array, bytes, MADV_HUGEPAGE);
+#endif
+  } else {
+    CeedCallBackend(CeedMalloc(length, array));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Copy or zero array with the threads and chunks of the vector operations, so new pages are first touched on the NUMA node that uses them
+//------------------------------------------------------------------------------
+static int CeedVectorCopyArray_Opt(CeedVector vec, CeedSize length, const CeedScalar *source, CeedScalar *target) {
+  CeedSize num_chunks;
+  CeedInt  num_threads;
+
+  CeedCallBackend(CeedVectorGetNumThreads_Opt(vec, length, &num_threads));
+  num_chunks = (length + CEED_OPT_VECTOR_CHUNK_SIZE - 1) / CEED_OPT_VECTOR_CHUNK_SIZE;
+  CeedPragmaOMP(parallel for num_threads(num_threads) schedule(static))
+  for (CeedSize c = 0; c < num_chunks; c++) {
+    const CeedSize start = c * CEED_OPT_VECTOR_CHUNK_SIZE, stop = CeedVectorChunkStop_Opt(start, length);
+
+    if (source) memcpy(&target[start], &source[start], (stop - start) * sizeof(CeedScalar));
+    else memset(&target[start], 0, (stop - start) * sizeof(CeedScalar));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Vector Set Array
+//------------------------------------------------------------------------------
+static int CeedVectorSetArray_Opt(CeedVector vec, CeedMemType mem_type, CeedCopyMode copy_mode, CeedScalar *array) {
+  bool            is_new_array;
+  CeedSize        length;
+  CeedVector_Ref *impl;
+
+  CeedCallBackend(CeedVectorGetData(vec, &impl));
+  CeedCallBackend(CeedVectorGetLength(vec, &length));
+
+  CeedCheck(mem_type == CEED_MEM_HOST, CeedVectorReturnCeed(vec), CEED_ERROR_BACKEND, "Can only set HOST memory for this backend");
+
+  // Owned arrays are allocated here rather than zeroed by calloc, then filled in parallel below
+  is_new_array = copy_mode == CEED_COPY_VALUES && !impl->array && !impl->array_borrowed && !impl->array_owned;
+  if (is_new_array) CeedCallBackend(CeedVectorAllocateArray_Opt(vec, length, &impl->array_owned));
+  CeedCallBackend(CeedSetHostCeedScalarArray(copy_mode == CEED_COPY_VALUES ? NULL : array, copy_mode, length,
+                                             (const CeedScalar **)&impl->array_owned, (const CeedScalar **)&impl->array_borrowed,
+                                             (const CeedScalar **)&impl->array));
+  if (copy_mode == CEED_COPY_VALUES && (array || is_new_array)) CeedCallBackend(CeedVectorCopyArray_Opt(vec, length, array, impl->array));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Vector Set Value
+//------------------------------------------------------------------------------
+static int CeedVectorSetValue_Opt(CeedVector vec, CeedScalar value) {
+  CeedSize    length, num_chunks;
+  CeedInt     num_threads;
+  CeedScalar *array;
+
+  CeedCallBackend(CeedVectorGetLength(vec, &length));
+  CeedCallBackend(CeedVectorGetNumThreads_Opt(vec, length, &num_threads));
+  CeedCallBackend(CeedVectorGetArrayWrite(vec, CEED_MEM_HOST, &array));
+  num_chunks = (length + CEED_OPT_VECTOR_CHUNK_SIZE - 1) / CEED_OPT_VECTOR_CHUNK_SIZE;
+  CeedPragmaOMP(parallel for num_threads(num_threads) schedule(static))
+  for (CeedSize c = 0; c < num_chunks; c++) {
+    const CeedSize start = c * CEED_OPT_VECTOR_CHUNK_SIZE, stop = CeedVectorChunkStop_Opt(start, length);
+
+    CeedPragmaSIMD for (CeedSize i = start; i < stop; i++) array[i] = value;
+  }
+  CeedCallBackend(CeedVectorRestoreArray(vec, &array));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Vector Norm
+//------------------------------------------------------------------------------
+static int CeedVectorNorm_Opt(CeedVector vec, CeedNormType norm_type, CeedScalar *norm) {
+  CeedSize          length, num_chunks;
+  CeedInt           num_threads;
+  CeedScalar       *chunk_norms;
+  const CeedScalar *array;
+
+  CeedCallBackend(CeedVectorGetLength(vec, &length));
+  CeedCallBackend(CeedVectorGetNumThreads_Opt(vec, length, &num_threads));
+  CeedCallBackend(CeedVectorGetArrayRead(vec, CEED_MEM_HOST, &array));
+  num_chunks = (length + CEED_OPT_VECTOR_CHUNK_SIZE - 1) / CEED_OPT_VECTOR_CHUNK_SIZE;
+  CeedCallBackend(CeedMalloc(num_chunks, &chunk_norms));
+  CeedPragmaOMP(parallel for num_threads(num_threads) schedule(static))
+  for (CeedSize c = 0; c < num_chunks; c++) {
+    const CeedSize start = c * CEED_OPT_VECTOR_CHUNK_SIZE, stop = CeedVectorChunkStop_Opt(start, length);
+
+    chunk_norms[c] = CeedVectorNormChunk_Opt(array, start, stop, norm_type);
+  }
+  *norm = CeedVectorNormReduce_Opt(chunk_norms, num_chunks, norm_type);
+  CeedCallBackend(CeedFree(&chunk_norms));
+  CeedCallBackend(CeedVectorRestoreArrayRead(vec, &array));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Vector Scale
+//------------------------------------------------------------------------------
+static int CeedVectorScale_Opt(CeedVector x, CeedScalar alpha) {
+  CeedSize    length, num_chunks;
+  CeedInt     num_threads;
+  CeedScalar *x_array;
+
+  CeedCallBackend(CeedVectorGetLength(x, &length));
+  CeedCallBackend(CeedVectorGetNumThreads_Opt(x, length, &num_threads));
+  CeedCallBackend(CeedVectorGetArray(x, CEED_MEM_HOST, &x_array));
+  num_chunks = (length + CEED_OPT_VECTOR_CHUNK_SIZE - 1) / CEED_OPT_VECTOR_CHUNK_SIZE;
+  CeedPragmaOMP(parallel for num_threads(num_threads) schedule(static))
+  for (CeedSize c = 0; c < num_chunks; c++) {
+    const CeedSize start = c * CEED_OPT_VECTOR_CHUNK_SIZE, stop = CeedVectorChunkStop_Opt(start, length);
+
+    CeedPragmaSIMD for (CeedSize i = start; i < stop; i++) x_array[i] *= alpha;
+  }
+  CeedCallBackend(CeedVectorRestoreArray(x, &x_array));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Vector AXPY
+//------------------------------------------------------------------------------
+static int CeedVectorAXPY_Opt(CeedVector y, CeedScalar alpha, CeedVector x) {
+  CeedSize          length, num_chunks;
+  CeedInt           num_threads;
+  CeedScalar       *y_array;
+  const CeedScalar *x_array;
+
+  CeedCallBackend(CeedVectorGetLength(y, &length));
+  CeedCallBackend(CeedVectorGetNumThreads_Opt(y, length, &num_threads));
+  CeedCallBackend(CeedVectorGetArray(y, CEED_MEM_HOST, &y_array));
+  CeedCallBackend(CeedVectorGetArrayRead(x, CEED_MEM_HOST, &x_array));
+  num_chunks = (length + CEED_OPT_VECTOR_CHUNK_SIZE - 1) / CEED_OPT_VECTOR_CHUNK_SIZE;
+  CeedPragmaOMP(parallel for num_threads(num_threads) schedule(static))
+  for (CeedSize c = 0; c < num_chunks; c++) {
+    const CeedSize start = c * CEED_OPT_VECTOR_CHUNK_SIZE, stop = CeedVectorChunkStop_Opt(start, length);
+
+    CeedPragmaSIMD for (CeedSize i = start; i < stop; i++) y_array[i] += alpha * x_array[i];
+  }
+  CeedCallBackend(CeedVectorRestoreArray(y, &y_array));
+  CeedCallBackend(CeedVectorRestoreArrayRead(x, &x_array));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Vector AXPBY
+//------------------------------------------------------------------------------
+static int CeedVectorAXPBY_Opt(CeedVector y, CeedScalar alpha, CeedScalar beta, CeedVector x) {
+  CeedSize          length, num_chunks;
+  CeedInt           num_threads;
+  CeedScalar       *y_array;
+  const CeedScalar *x_array;
+
+  CeedCallBackend(CeedVectorGetLength(y, &length));
+  CeedCallBackend(CeedVectorGetNumThreads_Opt(y, length, &num_threads));
+  CeedCallBackend(CeedVectorGetArray(y, CEED_MEM_HOST, &y_array));
+  CeedCallBackend(CeedVectorGetArrayRead(x, CEED_MEM_HOST, &x_array));
+  num_chunks = (length + CEED_OPT_VECTOR_CHUNK_SIZE - 1) / CEED_OPT_VECTOR_CHUNK_SIZE;
+  CeedPragmaOMP(parallel for num_threads(num_threads) schedule(static))
+  for (CeedSize c = 0; c < num_chunks; c++) {
+    const CeedSize start = c * CEED_OPT_VECTOR_CHUNK_SIZE, stop = CeedVectorChunkStop_Opt(start, length);
+
+    CeedPragmaSIMD for (CeedSize i = start; i < stop; i++) y_array[i] = alpha * x_array[i] + beta * y_array[i];
+  }
+  CeedCallBackend(CeedVectorRestoreArray(y, &y_array));
+  CeedCallBackend(CeedVectorRestoreArrayRead(x, &x_array));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Vector AXPBY fused with norm of the result
+//------------------------------------------------------------------------------
+static int CeedVectorAXPBYNorm_Opt(CeedVector y, CeedScalar alpha, CeedScalar beta, CeedVector x, CeedNormType norm_type, CeedScalar *norm) {
+  CeedSize          length, num_chunks;
+  CeedInt           num_threads;
+  CeedScalar       *y_array, *chunk_norms;
+  const CeedScalar *x_array;
+
+  CeedCallBackend(CeedVectorGetLength(y, &length));
+  CeedCallBackend(CeedVectorGetNumThreads_Opt(y, length, &num_threads));
+  CeedCallBackend(CeedVectorGetArray(y, CEED_MEM_HOST, &y_array));
+  CeedCallBackend(CeedVectorGetArrayRead(x, CEED_MEM_HOST, &x_array));
+  num_chunks = (length + CEED_OPT_VECTOR_CHUNK_SIZE - 1) / CEED_OPT_VECTOR_CHUNK_SIZE;
+  CeedCallBackend(CeedMalloc(num_chunks, &chunk_norms));
+  CeedPragmaOMP(parallel for num_threads(num_threads) schedule(static))
+  for (CeedSize c = 0; c < num_chunks; c++) {
+    const CeedSize start = c * CEED_OPT_VECTOR_CHUNK_SIZE, stop = CeedVectorChunkStop_Opt(start, length);
+
+    // Chunk is still in cache for the norm
+    CeedPragmaSIMD for (CeedSize i = start; i < stop; i++) y_array[i] = alpha * x_array[i] + beta * y_array[i];
+    chunk_norms[c] = CeedVectorNormChunk_Opt(y_array, start, stop, norm_type);
+  }
+  *norm = CeedVectorNormReduce_Opt(chunk_norms, num_chunks, norm_type);
+  CeedCallBackend(CeedFree(&chunk_norms));
+  CeedCallBackend(CeedVectorRestoreArray(y, &y_array));
+  CeedCallBackend(CeedVectorRestoreArrayRead(x, &x_array));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Vector multiple dot products
+//------------------------------------------------------------------------------
+static int CeedVectorMDot_Opt(CeedVector x, CeedInt num_vecs, CeedVector *vecs, CeedScalar *dots) {
+  CeedSize           length, num_chunks;
+  CeedInt            num_threads;
+  CeedScalar        *chunk_dots;
+  const CeedScalar  *x_array;
+  const CeedScalar **v_arrays;
+
+  CeedCallBackend(CeedVectorGetLength(x, &length));
+  CeedCallBackend(CeedVectorGetNumThreads_Opt(x, length, &num_threads));
+  CeedCallBackend(CeedVectorGetArrayRead(x, CEED_MEM_HOST, &x_array));
+  CeedCallBackend(CeedCalloc(num_vecs, &v_arrays));
+  for (CeedInt v = 0; v < num_vecs; v++) CeedCallBackend(CeedVectorGetArrayRead(vecs[v], CEED_MEM_HOST, &v_arrays[v]));
+  num_chunks = (length + CEED_OPT_VECTOR_CHUNK_SIZE - 1) / CEED_OPT_VECTOR_CHUNK_SIZE;
+  CeedCallBackend(CeedMalloc(num_chunks * num_vecs, &chunk_dots));
+  CeedPragmaOMP(parallel for num_threads(num_threads) schedule(static))
+  for (CeedSize c = 0; c < num_chunks; c++) {
+    const CeedSize start = c * CEED_OPT_VECTOR_CHUNK_SIZE, stop = CeedVectorChunkStop_Opt(start, length);
+
+    // Chunk of x is read from memory once for all dot products
+    for (CeedInt v = 0; v < num_vecs; v++) {
+      const CeedScalar *v_array = v_arrays[v];
+      CeedScalar        dot     = 0.0;
+
+      CeedPragmaSIMD for (CeedSize i = start; i < stop; i++) dot += x_array[i] * v_array[i];
+      chunk_dots[c * num_vecs + v] = dot;
+    }
+  }
+  for (CeedSize c = 0; c < num_chunks; c++) {
+    for (CeedInt v = 0; v < num_vecs; v++) dots[v] += chunk_dots[c * num_vecs + v];
+  }
+  CeedCallBackend(CeedFree(&chunk_dots));
+  for (CeedInt v = 0; v < num_vecs; v++) CeedCallBackend(CeedVectorRestoreArrayRead(vecs[v], &v_arrays[v]));
+  CeedCallBackend(CeedFree(&v_arrays));
+  CeedCallBackend(CeedVectorRestoreArrayRead(x, &x_array));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Vector Pointwise Multiplication
+//------------------------------------------------------------------------------
+static int CeedVectorPointwiseMult_Opt(CeedVector w, CeedVector x, CeedVector y) {
+  CeedSize          length, num_chunks;
+  CeedInt           num_threads;
+  CeedScalar       *w_array;
+  const CeedScalar *x_array, *y_array;
+
+  CeedCallBackend(CeedVectorGetLength(w, &length));
+  CeedCallBackend(CeedVectorGetNumThreads_Opt(w, length, &num_threads));
+  if (x == w || y == w) {
+    CeedCallBackend(CeedVectorGetArray(w, CEED_MEM_HOST, &w_array));
+  } else {
+    CeedCallBackend(CeedVectorGetArrayWrite(w, CEED_MEM_HOST, &w_array));
+  }
+  if (x != w) CeedCallBackend(CeedVectorGetArrayRead(x, CEED_MEM_HOST, &x_array));
+  else x_array = w_array;
+  if (y != w && y != x) CeedCallBackend(CeedVectorGetArrayRead(y, CEED_MEM_HOST, &y_array));
+  else y_array = y == x ? x_array : w_array;
+  num_chunks = (length + CEED_OPT_VECTOR_CHUNK_SIZE - 1) / CEED_OPT_VECTOR_CHUNK_SIZE;
+  CeedPragmaOMP(parallel for num_threads(num_threads) schedule(static))
+  for (CeedSize c = 0; c < num_chunks; c++) {
+    const CeedSize start = c * CEED_OPT_VECTOR_CHUNK_SIZE, stop = CeedVectorChunkStop_Opt(start, length);
+
+    CeedPragmaSIMD for (CeedSize i = start; i < stop; i++) w_array[i] = x_array[i] * y_array[i];
+  }
+  if (y != w && y != x) CeedCallBackend(CeedVectorRestoreArrayRead(y, &y_array));
+  if (x != w) CeedCallBackend(CeedVectorRestoreArrayRead(x, &x_array));
+  CeedCallBackend(CeedVectorRestoreArray(w, &w_array));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Vector Reciprocal
+//------------------------------------------------------------------------------
+static int CeedVectorReciprocal_Opt(CeedVector vec) {
+  CeedSize    length, num_chunks;
+  CeedInt     num_threads;
+  CeedScalar *array;
+
+  CeedCallBackend(CeedVectorGetLength(vec, &length));
+  CeedCallBackend(CeedVectorGetNumThreads_Opt(vec, length, &num_threads));
+  CeedCallBackend(CeedVectorGetArray(vec, CEED_MEM_HOST, &array));
+  num_chunks = (length + CEED_OPT_VECTOR_CHUNK_SIZE - 1) / CEED_OPT_VECTOR_CHUNK_SIZE;
+  CeedPragmaOMP(parallel for num_threads(num_threads) schedule(static))
+  for (CeedSize c = 0; c < num_chunks; c++) {
+    const CeedSize start = c * CEED_OPT_VECTOR_CHUNK_SIZE, stop = CeedVectorChunkStop_Opt(start, length);
+
+    CeedPragmaSIMD for (CeedSize i = start; i < stop; i++) {
+      if (fabs(array[i]) > CEED_EPSILON) array[i] = 1. / array[i];
+    }
+  }
+  CeedCallBackend(CeedVectorRestoreArray(vec, &array));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Move the array of a vector to pages first touched by the calling thread
+//------------------------------------------------------------------------------
+int CeedVectorFirstTouch_Opt(CeedVector vec) {
+  bool              has_valid_array, has_borrowed_array;
+  CeedSize          length;
+  CeedScalar       *new_array;
+  const CeedScalar *array;
+
+  CeedCallBackend(CeedVectorHasValidArray(vec, &has_valid_array));
+  CeedCallBackend(CeedVectorHasBorrowedArrayOfType(vec, CEED_MEM_HOST, &has_borrowed_array));
+  if (!has_valid_array || has_borrowed_array) return CEED_ERROR_SUCCESS;
+  CeedCallBackend(CeedVectorGetLength(vec, &length));
+  if (length == 0) return CEED_ERROR_SUCCESS;
+  CeedCallBackend(CeedVectorAllocateArray_Opt(vec, length, &new_array));
+  CeedCallBackend(CeedVectorGetArrayRead(vec, CEED_MEM_HOST, &array));
+  memcpy(new_array, array, length * sizeof(CeedScalar));
+  CeedCallBackend(CeedVectorRestoreArrayRead(vec, &array));
+  CeedCallBackend(CeedVectorSetArray(vec, CEED_MEM_HOST, CEED_OWN_POINTER, new_array));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Vector Create
+//------------------------------------------------------------------------------
+int CeedVectorCreate_Opt(CeedSize n, CeedVector vec) {
+  Ceed ceed;
+
+  // Array storage and access from the ref backend
+  CeedCallBackend(CeedVectorCreate_Ref(n, vec));
+
+  // NUMA aware allocation and threaded BLAS-1 operations
+  CeedCallBackend(CeedVectorGetCeed(vec, &ceed));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Vector", vec, "SetArray", CeedVectorSetArray_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Vector", vec, "SetValue", CeedVectorSetValue_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Vector", vec, "Norm", CeedVectorNorm_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Vector", vec, "Scale", CeedVectorScale_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Vector", vec, "AXPY", CeedVectorAXPY_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Vector", vec, "AXPBY", CeedVectorAXPBY_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Vector", vec, "AXPBYNorm", CeedVectorAXPBYNorm_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Vector", vec, "MDot", CeedVectorMDot_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Vector", vec, "PointwiseMult", CeedVectorPointwiseMult_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Vector", vec, "Reciprocal", CeedVectorReciprocal_Opt));
+  CeedCallBackend(CeedDestroy(&ceed));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
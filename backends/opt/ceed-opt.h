@@ -11,8 +11,24 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+// Default element block size for the blocked backend, one SIMD register of CeedScalar where the host ISA is known
+#if defined(__AVX512F__)
+#define CEED_OPT_DEFAULT_BLOCK_SIZE (64 / (CeedInt)sizeof(CeedScalar))
+#elif defined(__ARM_NEON) && !defined(__ARM_FEATURE_SVE)
+#define CEED_OPT_DEFAULT_BLOCK_SIZE 4
+#else
+#define CEED_OPT_DEFAULT_BLOCK_SIZE 8
+#endif
+
+// Alignment and minimum size of vector arrays backed by transparent huge pages
+#define CEED_OPT_HUGE_PAGE_SIZE (2 << 20)
+
 typedef struct {
+  bool    use_huge_pages;
+  bool    use_mixed_precision;
+  bool    use_jit;
   CeedInt block_size;
+  CeedInt num_threads;
 } Ceed_Opt;
 
 typedef struct {
@@ -20,21 +36,64 @@ typedef struct {
 } CeedBasis_Opt;
 
 typedef struct {
-  bool                 is_identity_qf, is_identity_rstr_op;
-  bool                *skip_rstr_in, *skip_rstr_out, *apply_add_basis_out;
-  CeedElemRestriction *block_rstr;   /* Blocked versions of restrictions */
-  CeedVector          *e_vecs_full;  /* Full E-vectors, inputs followed by outputs */
-  uint64_t            *input_states; /* State counter of inputs */
-  CeedVector          *e_vecs_in;    /* Element block input E-vectors  */
-  CeedVector          *e_vecs_out;   /* Element block output E-vectors */
-  CeedVector          *q_vecs_in;    /* Element block input Q-vectors  */
-  CeedVector          *q_vecs_out;   /* Element block output Q-vectors */
-  CeedInt              num_inputs, num_outputs;
-  CeedInt              qf_size_in, qf_size_out;
-  CeedVector           qf_l_vec;
-  CeedElemRestriction  qf_block_rstr;
+  bool         is_active;
+  bool         restrict_by_block; /* Passive input restricted block by block in the element loop */
+  bool         use_l_vec;         /* Passive input with E-vector layout matching its L-vector, read in place */
+  bool         use_fp32;          /* Passive CEED_EVAL_NONE input stored in single precision, mixed precision only */
+  CeedEvalMode eval_mode;
+  CeedInt      size, elem_size, num_comp;
+  CeedBasis    basis;
+} CeedOperatorFieldInfo_Opt;
+
+typedef struct {
+  bool                       is_identity_qf, is_identity_rstr_op;
+  bool                      *skip_rstr_in, *skip_rstr_out, *apply_add_basis_out;
+  CeedOperatorFieldInfo_Opt *fields_in, *fields_out; /* Field data cached at setup */
+  CeedElemRestriction       *block_rstr;             /* Blocked versions of restrictions */
+  CeedVector                *e_vecs_full;            /* Full E-vectors, inputs followed by outputs */
+  uint64_t                  *input_states;           /* State counter of inputs */
+  float                    **e_data_fp32;            /* Single precision copies of passive CEED_EVAL_NONE input E-vectors */
+  CeedVector                *e_vecs_in;              /* Element block input E-vectors, CEED_FIELD_MAX per thread */
+  CeedVector                *e_vecs_out;             /* Element block output E-vectors, CEED_FIELD_MAX per thread */
+  CeedVector                *q_vecs_in;              /* Element block input Q-vectors, CEED_FIELD_MAX per thread */
+  CeedVector                *q_vecs_out;             /* Element block output Q-vectors, CEED_FIELD_MAX per thread */
+  CeedVector                *l_vecs_in;              /* Per-thread views of the input L-vectors, CEED_FIELD_MAX per thread */
+  CeedVector                *l_vecs_out;             /* Per-thread views of the output L-vectors, CEED_FIELD_MAX per thread */
+  CeedInt                    block_size;             /* Element block size, at most the number of elements rounded up */
+  CeedInt                    num_threads, num_colors;
+  CeedInt                   *color_offsets;          /* Start of each color in color_blocks */
+  CeedInt                   *color_blocks;           /* Element blocks sorted by color; blocks of one color share no output nodes */
+  bool                       has_serial_color;       /* Last color holds blocks that could not be colored and must run serially */
+  CeedInt                    num_inputs, num_outputs;
+  CeedInt                    qf_size_in, qf_size_out;
+  CeedVector                *qf_batch_in;  /* Input Q-vectors widened by the active input directions, CEED_FIELD_MAX per thread */
+  CeedVector                *qf_batch_out; /* Output Q-vectors widened by the active input directions, CEED_FIELD_MAX per thread */
+  bool                       use_jit, is_jit_setup;
+  bool                       is_jit_ctx_constant; /* JiT QFunction has the context data compiled in */
+  uint64_t                   jit_ctx_state;       /* Context state when the JiT QFunction was compiled */
+  void                      *jit_module;          /* Shared library holding the JiT QFunction */
+  CeedQFunctionUser          jit_f;               /* JiT QFunction for Q times the block size points, NULL if unavailable */
+  CeedVector                *e_vecs_shared;       /* Element block views of E-vectors shared by a composite operator, 2 * CEED_FIELD_MAX per thread */
+  double                    *thread_phase_times;  /* Phase times of each thread while profiling, CEED_OPERATOR_NUM_PHASES per thread */
 } CeedOperator_Opt;
 
+typedef struct {
+  bool                *is_fused;       /* Suboperators applied with the shared E-vectors */
+  bool                *is_shared_out;  /* Shared E-vector sums active outputs, otherwise holds the restricted active input */
+  CeedInt              num_shared;
+  CeedInt             *shared_indices; /* Shared E-vector of each suboperator field, inputs followed by outputs, -1 if not shared */
+  CeedElemRestriction *shared_rstrs;   /* Blocked active restrictions used by more than one suboperator */
+  CeedVector          *shared_e_vecs;
+} CeedCompositeOperator_Opt;
+
+CEED_INTERN int CeedVectorCreate_Opt(CeedSize n, CeedVector vec);
+CEED_INTERN int CeedVectorFirstTouch_Opt(CeedVector vec);
+
 CEED_INTERN int CeedTensorContractCreate_Opt(CeedTensorContract contract);
 
+CEED_INTERN int CeedQFunctionJitCompile_Opt(CeedQFunction qf, CeedInt Q, bool allow_ctx_constant, void **module, CeedQFunctionUser *f,
+                                            bool *is_ctx_constant);
+CEED_INTERN int CeedQFunctionJitDestroy_Opt(void **module);
+
 CEED_INTERN int CeedOperatorCreate_Opt(CeedOperator op);
+CEED_INTERN int CeedCompositeOperatorCreate_Opt(CeedOperator op);
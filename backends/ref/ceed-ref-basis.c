@@ -260,6 +260,222 @@ static int CeedBasisApplyAdd_Ref(CeedBasis basis, CeedInt num_elem, CeedTranspos
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Basis Apply At Points
+//------------------------------------------------------------------------------
+#define CEED_REF_POINTS_BLOCK 32
+
+// Chebyshev polynomial values and, optionally, derivatives for a block of points, stored as [k][p] so the point loops vectorize
+static inline void CeedChebyshevAtPoints_Ref(CeedInt num_points, CeedInt Q_1d, const CeedScalar *restrict x, CeedScalar *restrict chebyshev_x,
+                                             CeedScalar *restrict chebyshev_dx) {
+  const CeedInt B = CEED_REF_POINTS_BLOCK;
+
+  for (CeedInt p = 0; p < num_points; p++) chebyshev_x[p] = 1.0;
+  if (Q_1d > 1) {
+    CeedPragmaSIMD for (CeedInt p = 0; p < num_points; p++) chebyshev_x[B + p] = 2 * x[p];
+  }
+  for (CeedInt k = 2; k < Q_1d; k++) {
+    CeedPragmaSIMD for (CeedInt p = 0; p < num_points; p++) {
+      chebyshev_x[k * B + p] = 2 * x[p] * chebyshev_x[(k - 1) * B + p] - chebyshev_x[(k - 2) * B + p];
+    }
+  }
+  if (!chebyshev_dx) return;
+  for (CeedInt p = 0; p < num_points; p++) chebyshev_dx[p] = 0.0;
+  if (Q_1d > 1) {
+    for (CeedInt p = 0; p < num_points; p++) chebyshev_dx[B + p] = 2.0;
+  }
+  for (CeedInt k = 2; k < Q_1d; k++) {
+    CeedPragmaSIMD for (CeedInt p = 0; p < num_points; p++) {
+      chebyshev_dx[k * B + p] = 2 * x[p] * chebyshev_dx[(k - 1) * B + p] + 2 * chebyshev_x[(k - 1) * B + p] - chebyshev_dx[(k - 2) * B + p];
+    }
+  }
+}
+
+// Contract the Chebyshev coefficients of one component with the 1D polynomial values at a block of points, one dimension at a time
+static inline void CeedBasisEvalAtPoints_Ref(CeedInt dim, CeedInt Q_1d, CeedInt num_points, const CeedScalar *coeffs,
+                                             const CeedScalar *const *chebyshev, CeedScalar *tmp[2], CeedScalar *v) {
+  const CeedInt B         = CEED_REF_POINTS_BLOCK;
+  CeedInt       num_outer = CeedIntPow(Q_1d, dim - 1);
+
+  // -- Fastest index, coefficients are shared by all points
+  for (CeedInt o = 0; o < num_outer; o++) {
+    CeedScalar *out = &tmp[0][o * B];
+
+    for (CeedInt p = 0; p < num_points; p++) out[p] = 0.0;
+    for (CeedInt k = 0; k < Q_1d; k++) {
+      const CeedScalar  coeff = coeffs[o * Q_1d + k];
+      const CeedScalar *b     = &chebyshev[0][k * B];
+
+      CeedPragmaSIMD for (CeedInt p = 0; p < num_points; p++) out[p] += coeff * b[p];
+    }
+  }
+  // -- Remaining dimensions, pointwise products
+  for (CeedInt d = 1; d < dim; d++) {
+    num_outer /= Q_1d;
+    for (CeedInt o = 0; o < num_outer; o++) {
+      CeedScalar *out = &tmp[d % 2][o * B];
+
+      for (CeedInt p = 0; p < num_points; p++) out[p] = 0.0;
+      for (CeedInt k = 0; k < Q_1d; k++) {
+        const CeedScalar *in = &tmp[(d - 1) % 2][(o * Q_1d + k) * B], *b = &chebyshev[d][k * B];
+
+        CeedPragmaSIMD for (CeedInt p = 0; p < num_points; p++) out[p] += in[p] * b[p];
+      }
+    }
+  }
+  for (CeedInt p = 0; p < num_points; p++) v[p] = tmp[(dim - 1) % 2][p];
+}
+
+// Transpose of CeedBasisEvalAtPoints_Ref, summing into the Chebyshev coefficients of one component
+static inline void CeedBasisEvalTransposeAtPoints_Ref(CeedInt dim, CeedInt Q_1d, CeedInt num_points, const CeedScalar *u,
+                                                      const CeedScalar *const *chebyshev, CeedScalar *tmp[2], CeedScalar *coeffs) {
+  const CeedInt B         = CEED_REF_POINTS_BLOCK;
+  CeedInt       num_outer = 1;
+
+  // -- Slowest dimensions, pointwise products
+  for (CeedInt p = 0; p < num_points; p++) tmp[(dim - 1) % 2][p] = u[p];
+  for (CeedInt d = dim - 1; d > 0; d--) {
+    for (CeedInt o = 0; o < num_outer; o++) {
+      const CeedScalar *in = &tmp[d % 2][o * B];
+
+      for (CeedInt k = 0; k < Q_1d; k++) {
+        const CeedScalar *b   = &chebyshev[d][k * B];
+        CeedScalar       *out = &tmp[(d - 1) % 2][(o * Q_1d + k) * B];
+
+        CeedPragmaSIMD for (CeedInt p = 0; p < num_points; p++) out[p] = in[p] * b[p];
+      }
+    }
+    num_outer *= Q_1d;
+  }
+  // -- Fastest index, reduce over points
+  for (CeedInt o = 0; o < num_outer; o++) {
+    const CeedScalar *in = &tmp[0][o * B];
+
+    for (CeedInt k = 0; k < Q_1d; k++) {
+      const CeedScalar *b   = &chebyshev[0][k * B];
+      CeedScalar        sum = 0.0;
+
+      for (CeedInt p = 0; p < num_points; p++) sum += in[p] * b[p];
+      coeffs[o * Q_1d + k] += sum;
+    }
+  }
+}
+
+// Nodes are ordered [comp][elem][node] and points [comp][elem][point], with num_points[e] points in element e
+static int CeedBasisApplyAtPointsCore_Ref(CeedBasis basis, bool apply_add, CeedInt num_elem, const CeedInt *num_points, CeedTransposeMode t_mode,
+                                          CeedEvalMode eval_mode, CeedVector x_ref, CeedVector u, CeedVector v) {
+  const CeedInt      B = CEED_REF_POINTS_BLOCK;
+  CeedInt            dim, num_comp, P_1d, Q_1d, num_coeffs, num_passes, total_num_points = 0;
+  CeedScalar        *chebyshev_coeffs, *work;
+  CeedTensorContract contract;
+  CeedBasis_Ref     *impl;
+
+  CeedCallBackend(CeedBasisGetData(basis, &impl));
+  CeedCallBackend(CeedBasisGetDimension(basis, &dim));
+  CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
+  CeedCallBackend(CeedBasisGetNumNodes1D(basis, &P_1d));
+  CeedCallBackend(CeedBasisGetNumQuadraturePoints1D(basis, &Q_1d));
+  CeedCallBackend(CeedBasisGetTensorContract(basis, &contract));
+  for (CeedInt e = 0; e < num_elem; e++) total_num_points += num_points[e];
+  num_coeffs = CeedIntPow(Q_1d, dim);
+  num_passes = eval_mode == CEED_EVAL_GRAD ? dim : 1;
+
+  if (eval_mode == CEED_EVAL_WEIGHT) {
+    CeedCallBackend(CeedVectorSetValue(v, 1.0));
+    return CEED_ERROR_SUCCESS;
+  }
+  CeedCheck(eval_mode == CEED_EVAL_INTERP || eval_mode == CEED_EVAL_GRAD, CeedBasisReturnCeed(basis), CEED_ERROR_BACKEND,
+            "Evaluation at arbitrary points not supported for %s", CeedEvalModes[eval_mode]);
+
+  // Map from nodes to Chebyshev coefficients
+  if (!impl->chebyshev_interp_1d) {
+    CeedCallBackend(CeedMalloc(P_1d * Q_1d, &impl->chebyshev_interp_1d));
+    CeedCallBackend(CeedBasisGetChebyshevInterp1D(basis, impl->chebyshev_interp_1d));
+  }
+  CeedCallBackend(CeedCalloc(num_comp * num_elem * num_coeffs, &chebyshev_coeffs));
+  CeedCallBackend(CeedMalloc(2 * num_comp * num_elem * Q_1d * CeedIntPow(CeedIntMax(P_1d, Q_1d), dim - 1), &work));
+  {
+    const CeedInt      work_size = num_comp * num_elem * Q_1d * CeedIntPow(CeedIntMax(P_1d, Q_1d), dim - 1);
+    CeedScalar        *tmp[2]    = {work, &work[work_size]}, *v_array;
+    CeedScalar         chebyshev_x[dim][Q_1d * B], chebyshev_dx[dim][Q_1d * B], points_tmp[2][CeedIntPow(Q_1d, dim - 1) * B];
+    CeedScalar        *points_work[2] = {points_tmp[0], points_tmp[1]};
+    const CeedScalar  *chebyshev[dim], *x_array, *u_array;
+
+    CeedCallBackend(CeedVectorGetArrayRead(x_ref, CEED_MEM_HOST, &x_array));
+    CeedCallBackend(CeedVectorGetArrayRead(u, CEED_MEM_HOST, &u_array));
+    if (t_mode == CEED_TRANSPOSE && apply_add) CeedCallBackend(CeedVectorGetArray(v, CEED_MEM_HOST, &v_array));
+    else CeedCallBackend(CeedVectorGetArrayWrite(v, CEED_MEM_HOST, &v_array));
+
+    // -- Interpolate nodes to Chebyshev coefficients for all elements and components at once
+    if (t_mode == CEED_NOTRANSPOSE) {
+      CeedInt pre = num_comp * num_elem * CeedIntPow(P_1d, dim - 1), post = 1;
+
+      for (CeedInt d = 0; d < dim; d++) {
+        CeedCallBackend(CeedTensorContractApply(contract, pre, P_1d, post, Q_1d, impl->chebyshev_interp_1d, CEED_NOTRANSPOSE, false,
+                                                d == 0 ? u_array : tmp[d % 2], d == dim - 1 ? chebyshev_coeffs : tmp[(d + 1) % 2]));
+        pre /= P_1d;
+        post *= Q_1d;
+      }
+    }
+
+    // -- Evaluate Chebyshev expansions at blocks of points in each element
+    for (CeedInt e = 0, points_offset = 0; e < num_elem; points_offset += num_points[e], e++) {
+      for (CeedInt p_start = 0; p_start < num_points[e]; p_start += B) {
+        const CeedInt block_num_points = CeedIntMin(B, num_points[e] - p_start), p_offset = points_offset + p_start;
+
+        for (CeedInt d = 0; d < dim; d++) {
+          CeedChebyshevAtPoints_Ref(block_num_points, Q_1d, &x_array[d * total_num_points + p_offset], chebyshev_x[d],
+                                    eval_mode == CEED_EVAL_GRAD ? chebyshev_dx[d] : NULL);
+        }
+        for (CeedInt pass = 0; pass < num_passes; pass++) {
+          for (CeedInt d = 0; d < dim; d++) chebyshev[d] = (eval_mode == CEED_EVAL_GRAD && d == pass) ? chebyshev_dx[d] : chebyshev_x[d];
+          for (CeedInt c = 0; c < num_comp; c++) {
+            const CeedInt points_index = (pass * num_comp + c) * total_num_points + p_offset;
+            CeedScalar   *coeffs       = &chebyshev_coeffs[(c * num_elem + e) * num_coeffs];
+
+            if (t_mode == CEED_NOTRANSPOSE) {
+              CeedBasisEvalAtPoints_Ref(dim, Q_1d, block_num_points, coeffs, chebyshev, points_work, &v_array[points_index]);
+            } else {
+              CeedBasisEvalTransposeAtPoints_Ref(dim, Q_1d, block_num_points, &u_array[points_index], chebyshev, points_work, coeffs);
+            }
+          }
+        }
+      }
+    }
+
+    // -- Interpolate transpose from Chebyshev coefficients to nodes for all elements and components at once
+    if (t_mode == CEED_TRANSPOSE) {
+      CeedInt pre = num_comp * num_elem * CeedIntPow(Q_1d, dim - 1), post = 1;
+
+      for (CeedInt d = 0; d < dim; d++) {
+        CeedCallBackend(CeedTensorContractApply(contract, pre, Q_1d, post, P_1d, impl->chebyshev_interp_1d, CEED_TRANSPOSE,
+                                                apply_add && (d == dim - 1), d == 0 ? chebyshev_coeffs : tmp[d % 2],
+                                                d == dim - 1 ? v_array : tmp[(d + 1) % 2]));
+        pre /= Q_1d;
+        post *= P_1d;
+      }
+    }
+    CeedCallBackend(CeedVectorRestoreArrayRead(x_ref, &x_array));
+    CeedCallBackend(CeedVectorRestoreArrayRead(u, &u_array));
+    CeedCallBackend(CeedVectorRestoreArray(v, &v_array));
+  }
+  CeedCallBackend(CeedFree(&chebyshev_coeffs));
+  CeedCallBackend(CeedFree(&work));
+  return CEED_ERROR_SUCCESS;
+}
+
+static int CeedBasisApplyAtPoints_Ref(CeedBasis basis, CeedInt num_elem, const CeedInt *num_points, CeedTransposeMode t_mode, CeedEvalMode eval_mode,
+                                      CeedVector x_ref, CeedVector u, CeedVector v) {
+  CeedCallBackend(CeedBasisApplyAtPointsCore_Ref(basis, false, num_elem, num_points, t_mode, eval_mode, x_ref, u, v));
+  return CEED_ERROR_SUCCESS;
+}
+
+static int CeedBasisApplyAddAtPoints_Ref(CeedBasis basis, CeedInt num_elem, const CeedInt *num_points, CeedTransposeMode t_mode,
+                                         CeedEvalMode eval_mode, CeedVector x_ref, CeedVector u, CeedVector v) {
+  CeedCallBackend(CeedBasisApplyAtPointsCore_Ref(basis, true, num_elem, num_points, t_mode, eval_mode, x_ref, u, v));
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Basis Destroy Tensor
 //------------------------------------------------------------------------------
@@ -268,6 +484,7 @@ static int CeedBasisDestroyTensor_Ref(CeedBasis basis) {
 
   CeedCallBackend(CeedBasisGetData(basis, &impl));
   CeedCallBackend(CeedFree(&impl->collo_grad_1d));
+  CeedCallBackend(CeedFree(&impl->chebyshev_interp_1d));
   CeedCallBackend(CeedFree(&impl));
   return CEED_ERROR_SUCCESS;
 }
@@ -309,6 +526,8 @@ int CeedBasisCreateTensorH1_Ref(CeedInt dim, CeedInt P_1d, CeedInt Q_1d, const C
 
   CeedCallBackend(CeedSetBackendFunction(ceed, "Basis", basis, "Apply", CeedBasisApply_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Basis", basis, "ApplyAdd", CeedBasisApplyAdd_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Basis", basis, "ApplyAtPoints", CeedBasisApplyAtPoints_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Basis", basis, "ApplyAddAtPoints", CeedBasisApplyAddAtPoints_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Basis", basis, "Destroy", CeedBasisDestroyTensor_Ref));
   CeedCallBackend(CeedDestroy(&ceed));
   CeedCallBackend(CeedDestroy(&ceed_parent));
@@ -139,6 +139,26 @@ static int CeedOperatorSetupFields_Ref(CeedQFunction qf, CeedOperator op, bool i
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Cache Field Data
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupFieldInfo_Ref(CeedQFunctionField *qf_fields, CeedOperatorField *op_fields, CeedInt num_fields,
+                                          CeedOperatorFieldInfo_Ref *fields) {
+  for (CeedInt i = 0; i < num_fields; i++) {
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_fields[i], &fields[i].eval_mode));
+    CeedCallBackend(CeedQFunctionFieldGetSize(qf_fields[i], &fields[i].size));
+    CeedCallBackend(CeedOperatorFieldGetVector(op_fields[i], &fields[i].vec));
+    fields[i].is_active = fields[i].vec == CEED_VECTOR_ACTIVE;
+    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_fields[i], &fields[i].elem_rstr));
+    if (fields[i].elem_rstr != CEED_ELEMRESTRICTION_NONE) {
+      CeedCallBackend(CeedElemRestrictionGetElementSize(fields[i].elem_rstr, &fields[i].elem_size));
+    }
+    CeedCallBackend(CeedOperatorFieldGetBasis(op_fields[i], &fields[i].basis));
+    if (fields[i].basis != CEED_BASIS_NONE) CeedCallBackend(CeedBasisGetNumComponents(fields[i].basis, &fields[i].num_comp));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Setup Operator
 //------------------------------------------------------------------------------/*
@@ -162,6 +182,8 @@ static int CeedOperatorSetup_Ref(CeedOperator op) {
 
   // Allocate
   CeedCallBackend(CeedCalloc(num_input_fields + num_output_fields, &impl->e_vecs_full));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->fields_in));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->fields_out));
 
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->skip_rstr_in));
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->skip_rstr_out));
@@ -175,6 +197,15 @@ static int CeedOperatorSetup_Ref(CeedOperator op) {
 
   impl->num_inputs  = num_input_fields;
   impl->num_outputs = num_output_fields;
+  impl->Q           = Q;
+  CeedCallBackend(CeedOperatorGetNumElements(op, &impl->num_elem));
+  CeedCallBackend(CeedQFunctionReferenceCopy(qf, &impl->qf));
+  // Call the user function directly unless the QFunction belongs to a delegating backend, such as memcheck, with its own apply
+  if (CeedQFunctionReturnCeed(qf) == CeedOperatorReturnCeed(op)) CeedCallBackend(CeedQFunctionGetUserFunction(qf, &impl->qf_function));
+
+  // Cache field data for the element loop
+  CeedCallBackend(CeedOperatorSetupFieldInfo_Ref(qf_input_fields, op_input_fields, num_input_fields, impl->fields_in));
+  CeedCallBackend(CeedOperatorSetupFieldInfo_Ref(qf_output_fields, op_output_fields, num_output_fields, impl->fields_out));
 
   // Set up infield and outfield e_vecs and q_vecs
   // Infields
@@ -208,42 +239,30 @@ static int CeedOperatorSetup_Ref(CeedOperator op) {
 //------------------------------------------------------------------------------
 // Setup Operator Inputs
 //------------------------------------------------------------------------------
-static inline int CeedOperatorSetupInputs_Ref(CeedInt num_input_fields, CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
-                                              CeedVector in_vec, const bool skip_active, CeedScalar *e_data_full[2 * CEED_FIELD_MAX],
-                                              CeedOperator_Ref *impl, CeedRequest *request) {
+static inline int CeedOperatorSetupInputs_Ref(CeedInt num_input_fields, CeedVector in_vec, const bool skip_active,
+                                              CeedScalar *e_data_full[2 * CEED_FIELD_MAX], CeedScalar **e_data_shared, CeedOperator_Ref *impl,
+                                              CeedRequest *request) {
   for (CeedInt i = 0; i < num_input_fields; i++) {
-    bool         is_active;
-    uint64_t     state;
-    CeedEvalMode eval_mode;
-    CeedVector   vec;
-
-    // Get input vector
-    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
-    is_active = vec == CEED_VECTOR_ACTIVE;
-    if (is_active) {
-      if (skip_active) continue;
-      else vec = in_vec;
+    const CeedOperatorFieldInfo_Ref *field = &impl->fields_in[i];
+    uint64_t                         state;
+    CeedVector                       vec = field->is_active ? in_vec : field->vec;
+
+    // Skip active input and weights
+    if ((field->is_active && skip_active) || field->eval_mode == CEED_EVAL_WEIGHT) continue;
+    // Active input restricted by the composite operator
+    if (e_data_shared && e_data_shared[i]) {
+      e_data_full[i] = e_data_shared[i];
+      continue;
     }
-
-    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
-    // Restrict and Evec
-    if (eval_mode == CEED_EVAL_WEIGHT) {  // Skip
-    } else {
-      // Restrict
-      CeedCallBackend(CeedVectorGetState(vec, &state));
-      // Skip restriction if input is unchanged
-      if ((state != impl->input_states[i] || vec == in_vec) && !impl->skip_rstr_in[i]) {
-        CeedElemRestriction elem_rstr;
-
-        CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[i], &elem_rstr));
-        CeedCallBackend(CeedElemRestrictionApply(elem_rstr, CEED_NOTRANSPOSE, vec, impl->e_vecs_full[i], request));
-        CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
-      }
-      impl->input_states[i] = state;
-      // Get evec
-      CeedCallBackend(CeedVectorGetArrayRead(impl->e_vecs_full[i], CEED_MEM_HOST, (const CeedScalar **)&e_data_full[i]));
+    // Restrict
+    CeedCallBackend(CeedVectorGetState(vec, &state));
+    // Skip restriction if input is unchanged
+    if ((state != impl->input_states[i] || vec == in_vec) && !impl->skip_rstr_in[i]) {
+      CeedCallBackend(CeedElemRestrictionApply(field->elem_rstr, CEED_NOTRANSPOSE, vec, impl->e_vecs_full[i], request));
     }
-    if (!is_active) CeedCallBackend(CeedVectorDestroy(&vec));
+    impl->input_states[i] = state;
+    // Get evec
+    CeedCallBackend(CeedVectorGetArrayRead(impl->e_vecs_full[i], CEED_MEM_HOST, (const CeedScalar **)&e_data_full[i]));
   }
   return CEED_ERROR_SUCCESS;
 }
@@ -251,45 +270,25 @@ static inline int CeedOperatorSetupInputs_Ref(CeedInt num_input_fields, CeedQFun
 //------------------------------------------------------------------------------
 // Input Basis Action
 //------------------------------------------------------------------------------
-static inline int CeedOperatorInputBasis_Ref(CeedInt e, CeedInt Q, CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
-                                             CeedInt num_input_fields, const bool skip_active, CeedScalar *e_data_full[2 * CEED_FIELD_MAX],
-                                             CeedOperator_Ref *impl) {
+static inline int CeedOperatorInputBasis_Ref(CeedInt e, CeedInt Q, CeedInt num_input_fields, const bool skip_active,
+                                             CeedScalar *e_data_full[2 * CEED_FIELD_MAX], CeedOperator_Ref *impl) {
   for (CeedInt i = 0; i < num_input_fields; i++) {
-    CeedInt             elem_size, size, num_comp;
-    CeedEvalMode        eval_mode;
-    CeedElemRestriction elem_rstr;
-    CeedBasis           basis;
+    const CeedOperatorFieldInfo_Ref *field = &impl->fields_in[i];
 
     // Skip active input
-    if (skip_active) {
-      bool       is_active;
-      CeedVector vec;
-
-      CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
-      is_active = vec == CEED_VECTOR_ACTIVE;
-      CeedCallBackend(CeedVectorDestroy(&vec));
-      if (is_active) continue;
-    }
-    // Get elem_size, eval_mode, size
-    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[i], &elem_rstr));
-    CeedCallBackend(CeedElemRestrictionGetElementSize(elem_rstr, &elem_size));
-    CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
-    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
-    CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &size));
+    if (skip_active && field->is_active) continue;
     // Basis action
-    switch (eval_mode) {
+    switch (field->eval_mode) {
       case CEED_EVAL_NONE:
-        CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][(CeedSize)e * Q * size]));
+        CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][(CeedSize)e * Q * field->size]));
         break;
       case CEED_EVAL_INTERP:
       case CEED_EVAL_GRAD:
       case CEED_EVAL_DIV:
       case CEED_EVAL_CURL:
-        CeedCallBackend(CeedOperatorFieldGetBasis(op_input_fields[i], &basis));
-        CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
-        CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][(CeedSize)e * elem_size * num_comp]));
-        CeedCallBackend(CeedBasisApply(basis, 1, CEED_NOTRANSPOSE, eval_mode, impl->e_vecs_in[i], impl->q_vecs_in[i]));
-        CeedCallBackend(CeedBasisDestroy(&basis));
+        CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER,
+                                           &e_data_full[i][(CeedSize)e * field->elem_size * field->num_comp]));
+        CeedCallBackend(CeedBasisApply(field->basis, 1, CEED_NOTRANSPOSE, field->eval_mode, impl->e_vecs_in[i], impl->q_vecs_in[i]));
         break;
       case CEED_EVAL_WEIGHT:
         break;  // No action
@@ -301,38 +300,27 @@ static inline int CeedOperatorInputBasis_Ref(CeedInt e, CeedInt Q, CeedQFunction
 //------------------------------------------------------------------------------
 // Output Basis Action
 //------------------------------------------------------------------------------
-static inline int CeedOperatorOutputBasis_Ref(CeedInt e, CeedInt Q, CeedQFunctionField *qf_output_fields, CeedOperatorField *op_output_fields,
-                                              CeedInt num_input_fields, CeedInt num_output_fields, bool *apply_add_basis, CeedOperator op,
-                                              CeedScalar *e_data_full[2 * CEED_FIELD_MAX], CeedOperator_Ref *impl) {
+static inline int CeedOperatorOutputBasis_Ref(CeedInt e, CeedInt num_input_fields, CeedInt num_output_fields, CeedOperator op,
+                                              CeedScalar *e_data_full[2 * CEED_FIELD_MAX], CeedScalar **e_data_shared, CeedOperator_Ref *impl) {
   for (CeedInt i = 0; i < num_output_fields; i++) {
-    CeedInt             elem_size, num_comp;
-    CeedEvalMode        eval_mode;
-    CeedElemRestriction elem_rstr;
-    CeedBasis           basis;
+    const CeedOperatorFieldInfo_Ref *field = &impl->fields_out[i];
 
-    // Get elem_size, eval_mode
-    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_output_fields[i], &elem_rstr));
-    CeedCallBackend(CeedElemRestrictionGetElementSize(elem_rstr, &elem_size));
-    CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
-    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
     // Basis action
-    switch (eval_mode) {
+    switch (field->eval_mode) {
       case CEED_EVAL_NONE:
         break;  // No action
       case CEED_EVAL_INTERP:
       case CEED_EVAL_GRAD:
       case CEED_EVAL_DIV:
       case CEED_EVAL_CURL:
-        CeedCallBackend(CeedOperatorFieldGetBasis(op_output_fields[i], &basis));
-        CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
         CeedCallBackend(CeedVectorSetArray(impl->e_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER,
-                                           &e_data_full[i + num_input_fields][(CeedSize)e * elem_size * num_comp]));
-        if (apply_add_basis[i]) {
-          CeedCallBackend(CeedBasisApplyAdd(basis, 1, CEED_TRANSPOSE, eval_mode, impl->q_vecs_out[i], impl->e_vecs_out[i]));
+                                           &e_data_full[i + num_input_fields][(CeedSize)e * field->elem_size * field->num_comp]));
+        // Outputs summed by the composite operator are added to the shared E-vector
+        if (impl->apply_add_basis_out[i] || (e_data_shared && e_data_shared[i + num_input_fields])) {
+          CeedCallBackend(CeedBasisApplyAdd(field->basis, 1, CEED_TRANSPOSE, field->eval_mode, impl->q_vecs_out[i], impl->e_vecs_out[i]));
         } else {
-          CeedCallBackend(CeedBasisApply(basis, 1, CEED_TRANSPOSE, eval_mode, impl->q_vecs_out[i], impl->e_vecs_out[i]));
+          CeedCallBackend(CeedBasisApply(field->basis, 1, CEED_TRANSPOSE, field->eval_mode, impl->q_vecs_out[i], impl->e_vecs_out[i]));
         }
-        CeedCallBackend(CeedBasisDestroy(&basis));
         break;
       // LCOV_EXCL_START
       case CEED_EVAL_WEIGHT: {
@@ -344,134 +332,155 @@ static inline int CeedOperatorOutputBasis_Ref(CeedInt e, CeedInt Q, CeedQFunctio
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// QFunction Apply on Element
+//------------------------------------------------------------------------------
+static inline int CeedOperatorQFunctionApply_Ref(CeedQFunctionUser f, void *ctx_data, CeedInt e, CeedInt Q,
+                                                 CeedScalar *e_data_full[2 * CEED_FIELD_MAX], CeedOperator_Ref *impl) {
+  const CeedScalar *inputs[CEED_FIELD_MAX];
+  CeedScalar       *outputs[CEED_FIELD_MAX];
+
+  // Fields without basis action read and write the full E-vectors directly
+  for (CeedInt i = 0; i < impl->num_inputs; i++) {
+    if (impl->fields_in[i].eval_mode == CEED_EVAL_NONE) inputs[i] = &e_data_full[i][(CeedSize)e * Q * impl->fields_in[i].size];
+    else CeedCallBackend(CeedVectorGetArrayRead(impl->q_vecs_in[i], CEED_MEM_HOST, &inputs[i]));
+  }
+  for (CeedInt i = 0; i < impl->num_outputs; i++) {
+    if (impl->fields_out[i].eval_mode == CEED_EVAL_NONE) {
+      outputs[i] = &e_data_full[i + impl->num_inputs][(CeedSize)e * Q * impl->fields_out[i].size];
+    } else {
+      CeedCallBackend(CeedVectorGetArrayWrite(impl->q_vecs_out[i], CEED_MEM_HOST, &outputs[i]));
+    }
+  }
+  CeedCallBackend(f(ctx_data, Q, inputs, outputs));
+  for (CeedInt i = 0; i < impl->num_inputs; i++) {
+    if (impl->fields_in[i].eval_mode != CEED_EVAL_NONE) CeedCallBackend(CeedVectorRestoreArrayRead(impl->q_vecs_in[i], &inputs[i]));
+  }
+  for (CeedInt i = 0; i < impl->num_outputs; i++) {
+    if (impl->fields_out[i].eval_mode != CEED_EVAL_NONE) CeedCallBackend(CeedVectorRestoreArray(impl->q_vecs_out[i], &outputs[i]));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Restore Input Vectors
 //------------------------------------------------------------------------------
-static inline int CeedOperatorRestoreInputs_Ref(CeedInt num_input_fields, CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
-                                                const bool skip_active, CeedScalar *e_data_full[2 * CEED_FIELD_MAX], CeedOperator_Ref *impl) {
+static inline int CeedOperatorRestoreInputs_Ref(CeedInt num_input_fields, const bool skip_active, CeedScalar *e_data_full[2 * CEED_FIELD_MAX],
+                                                CeedScalar **e_data_shared, CeedOperator_Ref *impl) {
   for (CeedInt i = 0; i < num_input_fields; i++) {
-    CeedEvalMode eval_mode;
+    const CeedOperatorFieldInfo_Ref *field = &impl->fields_in[i];
 
-    // Skip active inputs
-    if (skip_active) {
-      bool       is_active;
-      CeedVector vec;
-
-      CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
-      is_active = vec == CEED_VECTOR_ACTIVE;
-      CeedCallBackend(CeedVectorDestroy(&vec));
-      if (is_active) continue;
-    }
+    // Skip active inputs and weights, and inputs restricted by the composite operator
+    if ((field->is_active && skip_active) || field->eval_mode == CEED_EVAL_WEIGHT || (e_data_shared && e_data_shared[i])) continue;
     // Restore input
-    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
-    if (eval_mode == CEED_EVAL_WEIGHT) {  // Skip
-    } else {
-      CeedCallBackend(CeedVectorRestoreArrayRead(impl->e_vecs_full[i], (const CeedScalar **)&e_data_full[i]));
-    }
+    CeedCallBackend(CeedVectorRestoreArrayRead(impl->e_vecs_full[i], (const CeedScalar **)&e_data_full[i]));
   }
   return CEED_ERROR_SUCCESS;
 }
 
 //------------------------------------------------------------------------------
-// Operator Apply
+// Operator Apply Core, with active E-vector data optionally shared by a composite operator
 //------------------------------------------------------------------------------
-static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
-  CeedInt             Q, num_elem, num_input_fields, num_output_fields, size;
-  CeedEvalMode        eval_mode;
-  CeedScalar         *e_data_full[2 * CEED_FIELD_MAX] = {NULL};
-  CeedQFunctionField *qf_input_fields, *qf_output_fields;
-  CeedQFunction       qf;
-  CeedOperatorField  *op_input_fields, *op_output_fields;
-  CeedOperator_Ref   *impl;
+static int CeedOperatorApplyAddCore_Ref(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedScalar **e_data_shared, CeedRequest *request) {
+  bool              is_profiling;
+  void             *ctx_data                                    = NULL;
+  double            time, phase_times[CEED_OPERATOR_NUM_PHASES] = {0.0};
+  CeedScalar       *e_data_full[2 * CEED_FIELD_MAX]             = {NULL};
+  CeedQFunctionUser f                                           = NULL;
+  CeedOperator_Ref *impl;
 
   // Setup
   CeedCallBackend(CeedOperatorSetup_Ref(op));
+  CeedCallBackend(CeedOperatorIsProfiling(op, &is_profiling));
+  if (is_profiling) CeedCallBackend(CeedOperatorProfileLap(&time, NULL));
 
   CeedCallBackend(CeedOperatorGetData(op, &impl));
-  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+  const CeedInt Q = impl->Q, num_elem = impl->num_elem, num_input_fields = impl->num_inputs, num_output_fields = impl->num_outputs;
 
   // Restriction only operator
   if (impl->is_identity_rstr_op) {
-    CeedElemRestriction elem_rstr;
-
-    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[0], &elem_rstr));
-    CeedCallBackend(CeedElemRestrictionApply(elem_rstr, CEED_NOTRANSPOSE, in_vec, impl->e_vecs_full[0], request));
-    CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
-    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_output_fields[0], &elem_rstr));
-    CeedCallBackend(CeedElemRestrictionApply(elem_rstr, CEED_TRANSPOSE, impl->e_vecs_full[0], out_vec, request));
-    CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
+    CeedCallBackend(CeedElemRestrictionApply(impl->fields_in[0].elem_rstr, CEED_NOTRANSPOSE, in_vec, impl->e_vecs_full[0], request));
+    if (is_profiling) CeedCallBackend(CeedOperatorProfileLap(&time, &phase_times[CEED_OPERATOR_PHASE_INPUT_RESTRICTION]));
+    CeedCallBackend(CeedElemRestrictionApply(impl->fields_out[0].elem_rstr, CEED_TRANSPOSE, impl->e_vecs_full[0], out_vec, request));
+    if (is_profiling) {
+      CeedCallBackend(CeedOperatorProfileLap(&time, &phase_times[CEED_OPERATOR_PHASE_OUTPUT_RESTRICTION]));
+      CeedCallBackend(CeedOperatorAddProfile(op, phase_times));
+    }
     return CEED_ERROR_SUCCESS;
   }
 
-  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
-  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
-  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
-  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
-
   // Input Evecs and Restriction
-  CeedCallBackend(CeedOperatorSetupInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, in_vec, false, e_data_full, impl, request));
+  CeedCallBackend(CeedOperatorSetupInputs_Ref(num_input_fields, in_vec, false, e_data_full, e_data_shared, impl, request));
+  if (is_profiling) CeedCallBackend(CeedOperatorProfileLap(&time, &phase_times[CEED_OPERATOR_PHASE_INPUT_RESTRICTION]));
 
   // Output Evecs
   for (CeedInt i = num_output_fields - 1; i >= 0; i--) {
-    if (impl->skip_rstr_out[i]) {
+    if (e_data_shared && e_data_shared[i + num_input_fields]) {
+      e_data_full[i + num_input_fields] = e_data_shared[i + num_input_fields];
+    } else if (impl->skip_rstr_out[i]) {
       e_data_full[i + num_input_fields] = e_data_full[impl->e_data_out_indices[i] + num_input_fields];
     } else {
-      CeedCallBackend(CeedVectorGetArrayWrite(impl->e_vecs_full[i + impl->num_inputs], CEED_MEM_HOST, &e_data_full[i + num_input_fields]));
+      CeedCallBackend(CeedVectorGetArrayWrite(impl->e_vecs_full[i + num_input_fields], CEED_MEM_HOST, &e_data_full[i + num_input_fields]));
     }
   }
 
+  // QFunction user function and context
+  if (!impl->is_identity_qf) f = impl->qf_function;
+  if (f) CeedCallBackend(CeedQFunctionGetContextData(impl->qf, CEED_MEM_HOST, &ctx_data));
+
   // Loop through elements
   for (CeedInt e = 0; e < num_elem; e++) {
-    // Output pointers
-    for (CeedInt i = 0; i < num_output_fields; i++) {
-      CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
-      if (eval_mode == CEED_EVAL_NONE) {
-        CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[i], &size));
-        CeedCallBackend(
-            CeedVectorSetArray(impl->q_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i + num_input_fields][(CeedSize)e * Q * size]));
+    // Output pointers, only needed when Q-vectors are passed to the QFunction
+    if (!f) {
+      for (CeedInt i = 0; i < num_output_fields; i++) {
+        if (impl->fields_out[i].eval_mode != CEED_EVAL_NONE) continue;
+        CeedCallBackend(CeedVectorSetArray(impl->q_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER,
+                                           &e_data_full[i + num_input_fields][(CeedSize)e * Q * impl->fields_out[i].size]));
       }
     }
 
     // Input basis apply
-    CeedCallBackend(CeedOperatorInputBasis_Ref(e, Q, qf_input_fields, op_input_fields, num_input_fields, false, e_data_full, impl));
+    CeedCallBackend(CeedOperatorInputBasis_Ref(e, Q, num_input_fields, false, e_data_full, impl));
+    if (is_profiling) CeedCallBackend(CeedOperatorProfileLap(&time, &phase_times[CEED_OPERATOR_PHASE_INPUT_BASIS]));
 
     // Q function
-    if (!impl->is_identity_qf) {
-      CeedCallBackend(CeedQFunctionApply(qf, Q, impl->q_vecs_in, impl->q_vecs_out));
-    }
+    if (f) CeedCallBackend(CeedOperatorQFunctionApply_Ref(f, ctx_data, e, Q, e_data_full, impl));
+    else if (!impl->is_identity_qf) CeedCallBackend(CeedQFunctionApply(impl->qf, Q, impl->q_vecs_in, impl->q_vecs_out));
+    if (is_profiling) CeedCallBackend(CeedOperatorProfileLap(&time, &phase_times[CEED_OPERATOR_PHASE_QFUNCTION]));
 
     // Output basis apply
-    CeedCallBackend(CeedOperatorOutputBasis_Ref(e, Q, qf_output_fields, op_output_fields, num_input_fields, num_output_fields,
-                                                impl->apply_add_basis_out, op, e_data_full, impl));
+    CeedCallBackend(CeedOperatorOutputBasis_Ref(e, num_input_fields, num_output_fields, op, e_data_full, e_data_shared, impl));
+    if (is_profiling) CeedCallBackend(CeedOperatorProfileLap(&time, &phase_times[CEED_OPERATOR_PHASE_OUTPUT_BASIS]));
   }
+  if (f) CeedCallBackend(CeedQFunctionRestoreContextData(impl->qf, &ctx_data));
 
   // Output restriction
   for (CeedInt i = 0; i < num_output_fields; i++) {
-    bool                is_active;
-    CeedVector          vec;
-    CeedElemRestriction elem_rstr;
+    const CeedOperatorFieldInfo_Ref *field = &impl->fields_out[i];
 
-    if (impl->skip_rstr_out[i]) continue;
+    if (impl->skip_rstr_out[i] || (e_data_shared && e_data_shared[i + num_input_fields])) continue;
     // Restore Evec
-    CeedCallBackend(CeedVectorRestoreArray(impl->e_vecs_full[i + impl->num_inputs], &e_data_full[i + num_input_fields]));
-    // Get output vector
-    CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[i], &vec));
-    // Active
-    is_active = vec == CEED_VECTOR_ACTIVE;
-    if (is_active) vec = out_vec;
+    CeedCallBackend(CeedVectorRestoreArray(impl->e_vecs_full[i + num_input_fields], &e_data_full[i + num_input_fields]));
     // Restrict
-    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_output_fields[i], &elem_rstr));
-    CeedCallBackend(CeedElemRestrictionApply(elem_rstr, CEED_TRANSPOSE, impl->e_vecs_full[i + impl->num_inputs], vec, request));
-    if (!is_active) CeedCallBackend(CeedVectorDestroy(&vec));
-    CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
+    CeedCallBackend(CeedElemRestrictionApply(field->elem_rstr, CEED_TRANSPOSE, impl->e_vecs_full[i + num_input_fields],
+                                             field->is_active ? out_vec : field->vec, request));
   }
 
+  if (is_profiling) CeedCallBackend(CeedOperatorProfileLap(&time, &phase_times[CEED_OPERATOR_PHASE_OUTPUT_RESTRICTION]));
+
   // Restore input arrays
-  CeedCallBackend(CeedOperatorRestoreInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, false, e_data_full, impl));
-  CeedCallBackend(CeedQFunctionDestroy(&qf));
+  CeedCallBackend(CeedOperatorRestoreInputs_Ref(num_input_fields, false, e_data_full, e_data_shared, impl));
+  if (is_profiling) CeedCallBackend(CeedOperatorAddProfile(op, phase_times));
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Operator Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  return CeedOperatorApplyAddCore_Ref(op, in_vec, out_vec, NULL, request);
+}
+
 //------------------------------------------------------------------------------
 // Core code for assembling linear QFunction
 //------------------------------------------------------------------------------
@@ -502,7 +511,7 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Ref(CeedOperator op, b
   CeedCheck(!impl->is_identity_rstr_op, CeedOperatorReturnCeed(op), CEED_ERROR_BACKEND, "Assembling restriction only operators is not supported");
 
   // Input Evecs and Restriction
-  CeedCallBackend(CeedOperatorSetupInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, NULL, true, e_data_full, impl, request));
+  CeedCallBackend(CeedOperatorSetupInputs_Ref(num_input_fields, NULL, true, e_data_full, NULL, impl, request));
 
   // Count number of active input fields
   if (qf_size_in == 0) {
@@ -554,97 +563,82 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Ref(CeedOperator op, b
     // Create assembled vector
     CeedCallBackend(CeedVectorCreate(ceed_parent, l_size, assembled));
   }
-  // Clear output vector
-  CeedCallBackend(CeedVectorSetValue(*assembled, 0.0));
-  CeedCallBackend(CeedVectorGetArray(*assembled, CEED_MEM_HOST, &assembled_array));
-
-  // Loop through elements
-  for (CeedInt e = 0; e < num_elem; e++) {
-    // Input basis apply
-    CeedCallBackend(CeedOperatorInputBasis_Ref(e, Q, qf_input_fields, op_input_fields, num_input_fields, true, e_data_full, impl));
+  CeedCallBackend(CeedVectorGetArrayWrite(*assembled, CEED_MEM_HOST, &assembled_array));
 
-    // Assemble QFunction
+  // Q-vectors widened to one slice of Q points per active input direction
+  const CeedInt Q_batch = Q * qf_size_in;
 
+  if (!impl->qf_batch_in) {
+    CeedCallBackend(CeedCalloc(num_input_fields, &impl->qf_batch_in));
+    CeedCallBackend(CeedCalloc(num_output_fields, &impl->qf_batch_out));
     for (CeedInt i = 0; i < num_input_fields; i++) {
-      bool       is_active;
-      CeedInt    field_size;
-      CeedVector vec;
-
-      // Set Inputs
-      CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
-      is_active = vec == CEED_VECTOR_ACTIVE;
-      CeedCallBackend(CeedVectorDestroy(&vec));
-      if (!is_active) continue;
-      CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &field_size));
-      for (CeedInt field = 0; field < field_size; field++) {
-        // Set current portion of input to 1.0
-        {
-          CeedScalar *array;
-
-          CeedCallBackend(CeedVectorGetArray(impl->q_vecs_in[i], CEED_MEM_HOST, &array));
-          for (CeedInt j = 0; j < Q; j++) array[field * Q + j] = 1.0;
-          CeedCallBackend(CeedVectorRestoreArray(impl->q_vecs_in[i], &array));
-        }
-
-        if (!impl->is_identity_qf) {
-          // Set Outputs
-          for (CeedInt out = 0; out < num_output_fields; out++) {
-            CeedVector vec;
+      CeedCallBackend(CeedVectorCreate(CeedOperatorReturnCeed(op), (CeedSize)Q_batch * impl->fields_in[i].size, &impl->qf_batch_in[i]));
+    }
+    for (CeedInt i = 0; i < num_output_fields; i++) {
+      CeedCallBackend(CeedVectorCreate(CeedOperatorReturnCeed(op), (CeedSize)Q_batch * impl->fields_out[i].size, &impl->qf_batch_out[i]));
+    }
+  }
 
-            // Get output vector
-            CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[out], &vec));
-            // Check if active output
-            if (vec == CEED_VECTOR_ACTIVE) {
-              CeedInt field_size;
+  // Seed active inputs with the unit vector of each direction
+  for (CeedInt i = 0, d_offset = 0; i < num_input_fields; i++) {
+    CeedScalar *array;
 
-              CeedCallBackend(CeedVectorSetArray(impl->q_vecs_out[out], CEED_MEM_HOST, CEED_USE_POINTER, assembled_array));
-              CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[out], &field_size));
-              assembled_array += field_size * Q;  // Advance the pointer by the size of the output
-            }
-            CeedCallBackend(CeedVectorDestroy(&vec));
-          }
-          // Apply QFunction
-          CeedCallBackend(CeedQFunctionApply(qf, Q, impl->q_vecs_in, impl->q_vecs_out));
-        } else {
-          CeedInt           field_size;
-          const CeedScalar *array;
+    if (!impl->fields_in[i].is_active) continue;
+    CeedCallBackend(CeedVectorGetArrayWrite(impl->qf_batch_in[i], CEED_MEM_HOST, &array));
+    for (CeedInt c = 0; c < impl->fields_in[i].size; c++) {
+      for (CeedInt d = 0; d < qf_size_in; d++) {
+        for (CeedInt j = 0; j < Q; j++) array[c * Q_batch + d * Q + j] = d == d_offset + c ? 1.0 : 0.0;
+      }
+    }
+    CeedCallBackend(CeedVectorRestoreArray(impl->qf_batch_in[i], &array));
+    d_offset += impl->fields_in[i].size;
+  }
 
-          // Copy Identity Outputs
-          CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[0], &field_size));
-          CeedCallBackend(CeedVectorGetArrayRead(impl->q_vecs_out[0], CEED_MEM_HOST, &array));
-          for (CeedInt j = 0; j < field_size * Q; j++) assembled_array[j] = array[j];
-          CeedCallBackend(CeedVectorRestoreArrayRead(impl->q_vecs_out[0], &array));
-          assembled_array += field_size * Q;
-        }
-        // Reset input to 0.0
-        {
-          CeedScalar *array;
+  // Loop through elements
+  for (CeedInt e = 0; e < num_elem; e++) {
+    // Input basis apply
+    CeedCallBackend(CeedOperatorInputBasis_Ref(e, Q, num_input_fields, true, e_data_full, impl));
 
-          CeedCallBackend(CeedVectorGetArray(impl->q_vecs_in[i], CEED_MEM_HOST, &array));
-          for (CeedInt j = 0; j < Q; j++) array[field * Q + j] = 0.0;
-          CeedCallBackend(CeedVectorRestoreArray(impl->q_vecs_in[i], &array));
+    // Replicate passive inputs across the active input directions
+    for (CeedInt i = 0; i < num_input_fields; i++) {
+      const CeedScalar *q_array;
+      CeedScalar       *batch_array;
+
+      if (impl->fields_in[i].is_active) continue;
+      CeedCallBackend(CeedVectorGetArrayRead(impl->q_vecs_in[i], CEED_MEM_HOST, &q_array));
+      CeedCallBackend(CeedVectorGetArrayWrite(impl->qf_batch_in[i], CEED_MEM_HOST, &batch_array));
+      for (CeedInt c = 0; c < impl->fields_in[i].size; c++) {
+        for (CeedInt d = 0; d < qf_size_in; d++) {
+          for (CeedInt j = 0; j < Q; j++) batch_array[c * Q_batch + d * Q + j] = q_array[c * Q + j];
         }
       }
+      CeedCallBackend(CeedVectorRestoreArray(impl->qf_batch_in[i], &batch_array));
+      CeedCallBackend(CeedVectorRestoreArrayRead(impl->q_vecs_in[i], &q_array));
     }
-  }
 
-  // Un-set output Qvecs to prevent accidental overwrite of Assembled
-  if (!impl->is_identity_qf) {
-    for (CeedInt out = 0; out < num_output_fields; out++) {
-      CeedVector vec;
+    // Apply QFunction to all directions at once
+    CeedCallBackend(CeedQFunctionApply(qf, Q_batch, impl->qf_batch_in, impl->qf_batch_out));
 
-      // Get output vector
-      CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[out], &vec));
-      // Check if active output
-      if (vec == CEED_VECTOR_ACTIVE && num_elem > 0) {
-        CeedCallBackend(CeedVectorTakeArray(impl->q_vecs_out[out], CEED_MEM_HOST, NULL));
+    // Copy active outputs into the element block of the assembled vector, ordered by direction
+    for (CeedInt i = 0, out_offset = 0; i < num_output_fields; i++) {
+      const CeedScalar *batch_array;
+
+      if (!impl->fields_out[i].is_active) continue;
+      CeedCallBackend(CeedVectorGetArrayRead(impl->qf_batch_out[i], CEED_MEM_HOST, &batch_array));
+      for (CeedInt d = 0; d < qf_size_in; d++) {
+        for (CeedInt c = 0; c < impl->fields_out[i].size; c++) {
+          CeedScalar *assembled_q = &assembled_array[(((CeedSize)e * qf_size_in + d) * qf_size_out + out_offset + c) * Q];
+
+          for (CeedInt j = 0; j < Q; j++) assembled_q[j] = batch_array[c * Q_batch + d * Q + j];
+        }
       }
-      CeedCallBackend(CeedVectorDestroy(&vec));
+      CeedCallBackend(CeedVectorRestoreArrayRead(impl->qf_batch_out[i], &batch_array));
+      out_offset += impl->fields_out[i].size;
     }
   }
 
   // Restore input arrays
-  CeedCallBackend(CeedOperatorRestoreInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, true, e_data_full, impl));
+  CeedCallBackend(CeedOperatorRestoreInputs_Ref(num_input_fields, true, e_data_full, NULL, impl));
 
   // Restore output
   CeedCallBackend(CeedVectorRestoreArray(*assembled, &assembled_array));
@@ -849,6 +843,8 @@ static int CeedOperatorSetupAtPoints_Ref(CeedOperator op) {
 
   // Allocate
   CeedCallBackend(CeedCalloc(num_input_fields + num_output_fields, &impl->e_vecs_full));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->fields_in));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->fields_out));
 
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->skip_rstr_in));
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->skip_rstr_out));
@@ -862,6 +858,10 @@ static int CeedOperatorSetupAtPoints_Ref(CeedOperator op) {
   impl->num_inputs  = num_input_fields;
   impl->num_outputs = num_output_fields;
 
+  // Cache field data
+  CeedCallBackend(CeedOperatorSetupFieldInfo_Ref(qf_input_fields, op_input_fields, num_input_fields, impl->fields_in));
+  CeedCallBackend(CeedOperatorSetupFieldInfo_Ref(qf_output_fields, op_output_fields, num_output_fields, impl->fields_out));
+
   // Set up infield and outfield pointer arrays
   // Infields
   CeedCallBackend(CeedOperatorSetupFieldsAtPoints_Ref(qf, op, true, impl->skip_rstr_in, NULL, impl->e_vecs_full, impl->e_vecs_in, impl->q_vecs_in, 0,
@@ -1045,7 +1045,7 @@ static int CeedOperatorApplyAddAtPoints_Ref(CeedOperator op, CeedVector in_vec,
   CeedCallBackend(CeedOperatorAtPointsGetPoints(op, &rstr_points, &point_coords));
 
   // Input Evecs and Restriction
-  CeedCallBackend(CeedOperatorSetupInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, NULL, true, e_data, impl, request));
+  CeedCallBackend(CeedOperatorSetupInputs_Ref(num_input_fields, NULL, true, e_data, NULL, impl, request));
 
   // Loop through elements
   for (CeedInt e = 0; e < num_elem; e++) {
@@ -1073,7 +1073,7 @@ static int CeedOperatorApplyAddAtPoints_Ref(CeedOperator op, CeedVector in_vec,
   }
 
   // Restore input arrays
-  CeedCallBackend(CeedOperatorRestoreInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, true, e_data, impl));
+  CeedCallBackend(CeedOperatorRestoreInputs_Ref(num_input_fields, true, e_data, NULL, impl));
 
   // Cleanup point coordinates
   CeedCallBackend(CeedVectorDestroy(&point_coords));
@@ -1117,7 +1117,7 @@ static inline int CeedOperatorLinearAssembleQFunctionAtPointsCore_Ref(CeedOperat
   CeedCallBackend(CeedElemRestrictionGetMaxPointsInElement(rstr_points, &max_num_points));
 
   // Input Evecs and Restriction
-  CeedCallBackend(CeedOperatorSetupInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, NULL, true, e_data_full, impl, request));
+  CeedCallBackend(CeedOperatorSetupInputs_Ref(num_input_fields, NULL, true, e_data_full, NULL, impl, request));
 
   // Count number of active input fields
   if (qf_size_in == 0) {
@@ -1294,7 +1294,7 @@ static inline int CeedOperatorLinearAssembleQFunctionAtPointsCore_Ref(CeedOperat
   }
 
   // Restore input arrays
-  CeedCallBackend(CeedOperatorRestoreInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, true, e_data_full, impl));
+  CeedCallBackend(CeedOperatorRestoreInputs_Ref(num_input_fields, true, e_data_full, NULL, impl));
 
   // Restore output
   CeedCallBackend(CeedVectorRestoreArray(*assembled, &assembled_array));
@@ -1381,7 +1381,7 @@ static int CeedOperatorLinearAssembleAddDiagonalAtPoints_Ref(CeedOperator op, Ce
   }
 
   // Input Evecs and Restriction
-  CeedCallBackend(CeedOperatorSetupInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, NULL, true, e_data, impl, request));
+  CeedCallBackend(CeedOperatorSetupInputs_Ref(num_input_fields, NULL, true, e_data, NULL, impl, request));
 
   // Loop through elements
   for (CeedInt e = 0; e < num_elem; e++) {
@@ -1512,7 +1512,7 @@ static int CeedOperatorLinearAssembleAddDiagonalAtPoints_Ref(CeedOperator op, Ce
   }
 
   // Restore input arrays
-  CeedCallBackend(CeedOperatorRestoreInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, true, e_data, impl));
+  CeedCallBackend(CeedOperatorRestoreInputs_Ref(num_input_fields, true, e_data, NULL, impl));
 
   // Cleanup
   CeedCallBackend(CeedDestroy(&ceed));
@@ -1586,7 +1586,7 @@ static int CeedSingleOperatorAssembleAtPoints_Ref(CeedOperator op, CeedInt offse
   }
 
   // Input Evecs and Restriction
-  CeedCallBackend(CeedOperatorSetupInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, NULL, true, e_data, impl, CEED_REQUEST_IMMEDIATE));
+  CeedCallBackend(CeedOperatorSetupInputs_Ref(num_input_fields, NULL, true, e_data, NULL, impl, CEED_REQUEST_IMMEDIATE));
 
   // Loop through elements
   for (CeedInt e = 0; e < num_elem; e++) {
@@ -1715,7 +1715,7 @@ static int CeedSingleOperatorAssembleAtPoints_Ref(CeedOperator op, CeedInt offse
   }
 
   // Restore input arrays
-  CeedCallBackend(CeedOperatorRestoreInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, true, e_data, impl));
+  CeedCallBackend(CeedOperatorRestoreInputs_Ref(num_input_fields, true, e_data, NULL, impl));
 
   // Restore assembled values
   CeedCallBackend(CeedVectorRestoreArray(values, &assembled));
@@ -1730,6 +1730,179 @@ static int CeedSingleOperatorAssembleAtPoints_Ref(CeedOperator op, CeedInt offse
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Setup Composite Operator
+//------------------------------------------------------------------------------
+static int CeedCompositeOperatorSetup_Ref(CeedOperator op) {
+  bool                       is_setup_done;
+  CeedInt                    num_sub, num_rstr = 0, *num_uses, *last_use;
+  CeedElemRestriction       *rstrs;
+  bool                      *is_out;
+  CeedOperator              *sub_operators;
+  CeedCompositeOperator_Ref *impl;
+
+  CeedCallBackend(CeedOperatorIsSetupDone(op, &is_setup_done));
+  if (is_setup_done) return CEED_ERROR_SUCCESS;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedCompositeOperatorGetNumSub(op, &num_sub));
+  CeedCallBackend(CeedCompositeOperatorGetSubList(op, &sub_operators));
+  CeedCallBackend(CeedCalloc(num_sub, &impl->is_fused));
+  CeedCallBackend(CeedMalloc(num_sub * 2 * CEED_FIELD_MAX, &impl->shared_indices));
+  CeedCallBackend(CeedCalloc(num_sub * 2 * CEED_FIELD_MAX, &rstrs));
+  CeedCallBackend(CeedCalloc(num_sub * 2 * CEED_FIELD_MAX, &is_out));
+  CeedCallBackend(CeedCalloc(num_sub * 2 * CEED_FIELD_MAX, &num_uses));
+  CeedCallBackend(CeedCalloc(num_sub * 2 * CEED_FIELD_MAX, &last_use));
+  for (CeedInt i = 0; i < num_sub * 2 * CEED_FIELD_MAX; i++) impl->shared_indices[i] = -1;
+
+  // Count the suboperators using each active restriction, separately for inputs and outputs
+  for (CeedInt s = 0; s < num_sub; s++) {
+    bool              is_at_points;
+    CeedInt           num_elem;
+    CeedOperator_Ref *sub_impl;
+
+    // Only standard operators of this backend read and write shared E-vectors
+    CeedCallBackend(CeedOperatorIsAtPoints(sub_operators[s], &is_at_points));
+    CeedCallBackend(CeedOperatorGetNumElements(sub_operators[s], &num_elem));
+    if (is_at_points || num_elem == 0 || CeedOperatorReturnCeed(sub_operators[s]) != CeedOperatorReturnCeed(op)) continue;
+    CeedCallBackend(CeedOperatorSetup_Ref(sub_operators[s]));
+    CeedCallBackend(CeedOperatorGetData(sub_operators[s], &sub_impl));
+    if (sub_impl->is_identity_rstr_op) continue;
+    impl->is_fused[s] = true;
+
+    for (CeedInt i = 0; i < sub_impl->num_inputs + sub_impl->num_outputs; i++) {
+      const bool                       is_output = i >= sub_impl->num_inputs;
+      const CeedOperatorFieldInfo_Ref *field     = is_output ? &sub_impl->fields_out[i - sub_impl->num_inputs] : &sub_impl->fields_in[i];
+      CeedInt                          r         = 0;
+
+      // Outputs without basis action are written by the QFunction, so they cannot be summed
+      if (!field->is_active || field->eval_mode == CEED_EVAL_WEIGHT || (is_output && field->eval_mode == CEED_EVAL_NONE)) continue;
+      while (r < num_rstr && (rstrs[r] != field->elem_rstr || is_out[r] != is_output)) r++;
+      if (r == num_rstr) {
+        rstrs[r]    = field->elem_rstr;
+        is_out[r]   = is_output;
+        last_use[r] = -1;
+        num_rstr++;
+      }
+      if (last_use[r] != s) num_uses[r]++;
+      last_use[r]                                      = s;
+      impl->shared_indices[s * 2 * CEED_FIELD_MAX + i] = r;
+    }
+  }
+
+  // Share E-vectors for restrictions used by more than one suboperator
+  CeedCallBackend(CeedCalloc(num_rstr, &impl->shared_rstrs));
+  CeedCallBackend(CeedCalloc(num_rstr, &impl->shared_e_vecs));
+  CeedCallBackend(CeedCalloc(num_rstr, &impl->is_shared_out));
+  for (CeedInt r = 0; r < num_rstr; r++) {
+    if (num_uses[r] < 2) continue;
+    CeedCallBackend(CeedElemRestrictionReferenceCopy(rstrs[r], &impl->shared_rstrs[r]));
+    CeedCallBackend(CeedElemRestrictionCreateVector(rstrs[r], NULL, &impl->shared_e_vecs[r]));
+    impl->is_shared_out[r] = is_out[r];
+  }
+  for (CeedInt i = 0; i < num_sub * 2 * CEED_FIELD_MAX; i++) {
+    if (impl->shared_indices[i] >= 0 && !impl->shared_e_vecs[impl->shared_indices[i]]) impl->shared_indices[i] = -1;
+  }
+  impl->num_shared = num_rstr;
+
+  CeedCallBackend(CeedFree(&rstrs));
+  CeedCallBackend(CeedFree(&is_out));
+  CeedCallBackend(CeedFree(&num_uses));
+  CeedCallBackend(CeedFree(&last_use));
+  CeedCallBackend(CeedOperatorSetSetupDone(op));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Composite Operator Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddComposite_Ref(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  bool                       is_profiling;
+  CeedInt                    num_sub;
+  double                     time, phase_times[CEED_OPERATOR_NUM_PHASES] = {0.0};
+  CeedScalar               **shared_data;
+  CeedOperator              *sub_operators;
+  CeedCompositeOperator_Ref *impl;
+
+  // Setup
+  CeedCallBackend(CeedCompositeOperatorSetup_Ref(op));
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedCompositeOperatorGetNumSub(op, &num_sub));
+  CeedCallBackend(CeedCompositeOperatorGetSubList(op, &sub_operators));
+  CeedCallBackend(CeedOperatorIsProfiling(op, &is_profiling));
+  if (is_profiling) CeedCallBackend(CeedOperatorProfileLap(&time, NULL));
+
+  // Restrict active input once for each shared restriction, zero shared outputs
+  CeedCallBackend(CeedCalloc(impl->num_shared, &shared_data));
+  for (CeedInt r = 0; r < impl->num_shared; r++) {
+    if (!impl->shared_e_vecs[r]) continue;
+    if (impl->is_shared_out[r]) {
+      CeedCallBackend(CeedVectorSetValue(impl->shared_e_vecs[r], 0.0));
+      CeedCallBackend(CeedVectorGetArray(impl->shared_e_vecs[r], CEED_MEM_HOST, &shared_data[r]));
+    } else {
+      CeedCallBackend(CeedElemRestrictionApply(impl->shared_rstrs[r], CEED_NOTRANSPOSE, in_vec, impl->shared_e_vecs[r], request));
+      CeedCallBackend(CeedVectorGetArrayRead(impl->shared_e_vecs[r], CEED_MEM_HOST, (const CeedScalar **)&shared_data[r]));
+    }
+  }
+
+  if (is_profiling) CeedCallBackend(CeedOperatorProfileLap(&time, &phase_times[CEED_OPERATOR_PHASE_INPUT_RESTRICTION]));
+
+  // Apply suboperators, which profile themselves
+  for (CeedInt s = 0; s < num_sub; s++) {
+    if (impl->is_fused[s]) {
+      const CeedInt *shared_indices                     = &impl->shared_indices[s * 2 * CEED_FIELD_MAX];
+      CeedScalar    *e_data_shared[2 * CEED_FIELD_MAX] = {NULL};
+
+      for (CeedInt i = 0; i < 2 * CEED_FIELD_MAX; i++) {
+        if (shared_indices[i] >= 0) e_data_shared[i] = shared_data[shared_indices[i]];
+      }
+      CeedCallBackend(CeedOperatorApplyAddCore_Ref(sub_operators[s], in_vec, out_vec, e_data_shared, request));
+    } else {
+      CeedCallBackend(CeedOperatorApplyAdd(sub_operators[s], in_vec, out_vec, request));
+    }
+  }
+
+  if (is_profiling) CeedCallBackend(CeedOperatorProfileLap(&time, NULL));
+
+  // Sum shared outputs into the active output with one transpose restriction each
+  for (CeedInt r = 0; r < impl->num_shared; r++) {
+    if (!impl->shared_e_vecs[r]) continue;
+    if (impl->is_shared_out[r]) {
+      CeedCallBackend(CeedVectorRestoreArray(impl->shared_e_vecs[r], &shared_data[r]));
+      CeedCallBackend(CeedElemRestrictionApply(impl->shared_rstrs[r], CEED_TRANSPOSE, impl->shared_e_vecs[r], out_vec, request));
+    } else {
+      CeedCallBackend(CeedVectorRestoreArrayRead(impl->shared_e_vecs[r], (const CeedScalar **)&shared_data[r]));
+    }
+  }
+  CeedCallBackend(CeedFree(&shared_data));
+  if (is_profiling) {
+    CeedCallBackend(CeedOperatorProfileLap(&time, &phase_times[CEED_OPERATOR_PHASE_OUTPUT_RESTRICTION]));
+    CeedCallBackend(CeedOperatorAddProfile(op, phase_times));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Composite Operator Destroy
+//------------------------------------------------------------------------------
+static int CeedCompositeOperatorDestroy_Ref(CeedOperator op) {
+  CeedCompositeOperator_Ref *impl;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  for (CeedInt r = 0; r < impl->num_shared; r++) {
+    CeedCallBackend(CeedElemRestrictionDestroy(&impl->shared_rstrs[r]));
+    CeedCallBackend(CeedVectorDestroy(&impl->shared_e_vecs[r]));
+  }
+  CeedCallBackend(CeedFree(&impl->shared_rstrs));
+  CeedCallBackend(CeedFree(&impl->shared_e_vecs));
+  CeedCallBackend(CeedFree(&impl->is_shared_out));
+  CeedCallBackend(CeedFree(&impl->shared_indices));
+  CeedCallBackend(CeedFree(&impl->is_fused));
+  CeedCallBackend(CeedFree(&impl));
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Operator Destroy
 //------------------------------------------------------------------------------
@@ -1747,6 +1920,22 @@ static int CeedOperatorDestroy_Ref(CeedOperator op) {
   CeedCallBackend(CeedFree(&impl->e_vecs_full));
   CeedCallBackend(CeedFree(&impl->input_states));
 
+  if (impl->fields_in) {
+    for (CeedInt i = 0; i < impl->num_inputs; i++) {
+      CeedCallBackend(CeedVectorDestroy(&impl->fields_in[i].vec));
+      CeedCallBackend(CeedElemRestrictionDestroy(&impl->fields_in[i].elem_rstr));
+      CeedCallBackend(CeedBasisDestroy(&impl->fields_in[i].basis));
+    }
+    for (CeedInt i = 0; i < impl->num_outputs; i++) {
+      CeedCallBackend(CeedVectorDestroy(&impl->fields_out[i].vec));
+      CeedCallBackend(CeedElemRestrictionDestroy(&impl->fields_out[i].elem_rstr));
+      CeedCallBackend(CeedBasisDestroy(&impl->fields_out[i].basis));
+    }
+  }
+  CeedCallBackend(CeedFree(&impl->fields_in));
+  CeedCallBackend(CeedFree(&impl->fields_out));
+  CeedCallBackend(CeedQFunctionDestroy(&impl->qf));
+
   for (CeedInt i = 0; i < impl->num_inputs; i++) {
     CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_in[i]));
     CeedCallBackend(CeedVectorDestroy(&impl->q_vecs_in[i]));
@@ -1762,6 +1951,13 @@ static int CeedOperatorDestroy_Ref(CeedOperator op) {
   CeedCallBackend(CeedFree(&impl->q_vecs_out));
   CeedCallBackend(CeedVectorDestroy(&impl->point_coords_elem));
 
+  if (impl->qf_batch_in) {
+    for (CeedInt i = 0; i < impl->num_inputs; i++) CeedCallBackend(CeedVectorDestroy(&impl->qf_batch_in[i]));
+    for (CeedInt i = 0; i < impl->num_outputs; i++) CeedCallBackend(CeedVectorDestroy(&impl->qf_batch_out[i]));
+  }
+  CeedCallBackend(CeedFree(&impl->qf_batch_in));
+  CeedCallBackend(CeedFree(&impl->qf_batch_out));
+
   CeedCallBackend(CeedFree(&impl));
   return CEED_ERROR_SUCCESS;
 }
@@ -1806,3 +2002,19 @@ int CeedOperatorCreateAtPoints_Ref(CeedOperator op) {
 }
 
 //------------------------------------------------------------------------------
+// Composite Operator Create
+//------------------------------------------------------------------------------
+int CeedCompositeOperatorCreate_Ref(CeedOperator op) {
+  Ceed                       ceed;
+  CeedCompositeOperator_Ref *impl;
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedCalloc(1, &impl));
+  CeedCallBackend(CeedOperatorSetData(op, impl));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddComposite", CeedOperatorApplyAddComposite_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "Destroy", CeedCompositeOperatorDestroy_Ref));
+  CeedCallBackend(CeedDestroy(&ceed));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
@@ -64,10 +64,32 @@ static inline int CeedElemRestrictionApplyOffsetNoTranspose_Ref_Core(CeedElemRes
   CeedElemRestriction_Ref *impl;
 
   CeedCallBackend(CeedElemRestrictionGetData(rstr, &impl));
-  for (CeedSize e = start * block_size; e < stop * block_size; e += block_size) {
-    CeedPragmaSIMD for (CeedSize k = 0; k < num_comp; k++) {
-      CeedPragmaSIMD for (CeedSize i = 0; i < elem_size * block_size; i++) {
-        vv[elem_size * (k * block_size + e * num_comp) + i - v_offset] = uu[impl->offsets[i + e * elem_size] + k * comp_stride];
+  if (impl->offsets_pattern) {
+    for (CeedSize e = start * block_size; e < stop * block_size; e += block_size) {
+      const CeedScalar *uu_e = &uu[impl->offsets_base[e / block_size]];
+
+      CeedPragmaSIMD for (CeedSize k = 0; k < num_comp; k++) {
+        CeedPragmaSIMD for (CeedSize i = 0; i < elem_size * block_size; i++) {
+          vv[elem_size * (k * block_size + e * num_comp) + i - v_offset] = uu_e[impl->offsets_pattern[i] + k * comp_stride];
+        }
+      }
+    }
+  } else if (impl->offsets_delta) {
+    for (CeedSize e = start * block_size; e < stop * block_size; e += block_size) {
+      const CeedScalar *uu_e = &uu[impl->offsets_base[e / block_size]];
+
+      CeedPragmaSIMD for (CeedSize k = 0; k < num_comp; k++) {
+        CeedPragmaSIMD for (CeedSize i = 0; i < elem_size * block_size; i++) {
+          vv[elem_size * (k * block_size + e * num_comp) + i - v_offset] = uu_e[impl->offsets_delta[i + e * elem_size] + k * comp_stride];
+        }
+      }
+    }
+  } else {
+    for (CeedSize e = start * block_size; e < stop * block_size; e += block_size) {
+      CeedPragmaSIMD for (CeedSize k = 0; k < num_comp; k++) {
+        CeedPragmaSIMD for (CeedSize i = 0; i < elem_size * block_size; i++) {
+          vv[elem_size * (k * block_size + e * num_comp) + i - v_offset] = uu[impl->offsets[i + e * elem_size] + k * comp_stride];
+        }
       }
     }
   }
@@ -225,15 +247,49 @@ static inline int CeedElemRestrictionApplyOffsetTranspose_Ref_Core(CeedElemRestr
   CeedElemRestriction_Ref *impl;
 
   CeedCallBackend(CeedElemRestrictionGetData(rstr, &impl));
-  for (CeedSize e = start * block_size; e < stop * block_size; e += block_size) {
-    for (CeedSize k = 0; k < num_comp; k++) {
-      for (CeedSize i = 0; i < elem_size * block_size; i += block_size) {
-        // Iteration bound set to discard padding elements
-        for (CeedSize j = i; j < i + CeedIntMin(block_size, num_elem - e); j++) {
-          CeedScalar vv_loc;
+  if (impl->offsets_pattern) {
+    for (CeedSize e = start * block_size; e < stop * block_size; e += block_size) {
+      CeedScalar *vv_e = &vv[impl->offsets_base[e / block_size]];
 
-          vv_loc = uu[elem_size * (k * block_size + e * num_comp) + j - v_offset];
-          CeedPragmaAtomic vv[impl->offsets[j + e * elem_size] + k * comp_stride] += vv_loc;
+      for (CeedSize k = 0; k < num_comp; k++) {
+        for (CeedSize i = 0; i < elem_size * block_size; i += block_size) {
+          // Iteration bound set to discard padding elements
+          for (CeedSize j = i; j < i + CeedIntMin(block_size, num_elem - e); j++) {
+            CeedScalar vv_loc;
+
+            vv_loc = uu[elem_size * (k * block_size + e * num_comp) + j - v_offset];
+            CeedPragmaAtomic vv_e[impl->offsets_pattern[j] + k * comp_stride] += vv_loc;
+          }
+        }
+      }
+    }
+  } else if (impl->offsets_delta) {
+    for (CeedSize e = start * block_size; e < stop * block_size; e += block_size) {
+      CeedScalar *vv_e = &vv[impl->offsets_base[e / block_size]];
+
+      for (CeedSize k = 0; k < num_comp; k++) {
+        for (CeedSize i = 0; i < elem_size * block_size; i += block_size) {
+          // Iteration bound set to discard padding elements
+          for (CeedSize j = i; j < i + CeedIntMin(block_size, num_elem - e); j++) {
+            CeedScalar vv_loc;
+
+            vv_loc = uu[elem_size * (k * block_size + e * num_comp) + j - v_offset];
+            CeedPragmaAtomic vv_e[impl->offsets_delta[j + e * elem_size] + k * comp_stride] += vv_loc;
+          }
+        }
+      }
+    }
+  } else {
+    for (CeedSize e = start * block_size; e < stop * block_size; e += block_size) {
+      for (CeedSize k = 0; k < num_comp; k++) {
+        for (CeedSize i = 0; i < elem_size * block_size; i += block_size) {
+          // Iteration bound set to discard padding elements
+          for (CeedSize j = i; j < i + CeedIntMin(block_size, num_elem - e); j++) {
+            CeedScalar vv_loc;
+
+            vv_loc = uu[elem_size * (k * block_size + e * num_comp) + j - v_offset];
+            CeedPragmaAtomic vv[impl->offsets[j + e * elem_size] + k * comp_stride] += vv_loc;
+          }
         }
       }
     }
@@ -516,6 +572,18 @@ static int CeedElemRestrictionApply_Ref_111(CeedElemRestriction rstr, const Ceed
   return CeedElemRestrictionApply_Ref_Core(rstr, 1, 1, 1, start, stop, t_mode, use_signs, use_orients, u, v, request);
 }
 
+static int CeedElemRestrictionApply_Ref_140(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size, const CeedInt comp_stride,
+                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, bool use_signs, bool use_orients, CeedVector u,
+                                            CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(rstr, 1, 4, comp_stride, start, stop, t_mode, use_signs, use_orients, u, v, request);
+}
+
+static int CeedElemRestrictionApply_Ref_141(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size, const CeedInt comp_stride,
+                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, bool use_signs, bool use_orients, CeedVector u,
+                                            CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(rstr, 1, 4, 1, start, stop, t_mode, use_signs, use_orients, u, v, request);
+}
+
 static int CeedElemRestrictionApply_Ref_180(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size, const CeedInt comp_stride,
                                             CeedInt start, CeedInt stop, CeedTransposeMode t_mode, bool use_signs, bool use_orients, CeedVector u,
                                             CeedVector v, CeedRequest *request) {
@@ -528,6 +596,18 @@ static int CeedElemRestrictionApply_Ref_181(CeedElemRestriction rstr, const Ceed
   return CeedElemRestrictionApply_Ref_Core(rstr, 1, 8, 1, start, stop, t_mode, use_signs, use_orients, u, v, request);
 }
 
+static int CeedElemRestrictionApply_Ref_1160(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size, const CeedInt comp_stride,
+                                             CeedInt start, CeedInt stop, CeedTransposeMode t_mode, bool use_signs, bool use_orients, CeedVector u,
+                                             CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(rstr, 1, 16, comp_stride, start, stop, t_mode, use_signs, use_orients, u, v, request);
+}
+
+static int CeedElemRestrictionApply_Ref_1161(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size, const CeedInt comp_stride,
+                                             CeedInt start, CeedInt stop, CeedTransposeMode t_mode, bool use_signs, bool use_orients, CeedVector u,
+                                             CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(rstr, 1, 16, 1, start, stop, t_mode, use_signs, use_orients, u, v, request);
+}
+
 static int CeedElemRestrictionApply_Ref_310(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size, const CeedInt comp_stride,
                                             CeedInt start, CeedInt stop, CeedTransposeMode t_mode, bool use_signs, bool use_orients, CeedVector u,
                                             CeedVector v, CeedRequest *request) {
@@ -540,6 +620,18 @@ static int CeedElemRestrictionApply_Ref_311(CeedElemRestriction rstr, const Ceed
   return CeedElemRestrictionApply_Ref_Core(rstr, 3, 1, 1, start, stop, t_mode, use_signs, use_orients, u, v, request);
 }
 
+static int CeedElemRestrictionApply_Ref_340(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size, const CeedInt comp_stride,
+                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, bool use_signs, bool use_orients, CeedVector u,
+                                            CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(rstr, 3, 4, comp_stride, start, stop, t_mode, use_signs, use_orients, u, v, request);
+}
+
+static int CeedElemRestrictionApply_Ref_341(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size, const CeedInt comp_stride,
+                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, bool use_signs, bool use_orients, CeedVector u,
+                                            CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(rstr, 3, 4, 1, start, stop, t_mode, use_signs, use_orients, u, v, request);
+}
+
 static int CeedElemRestrictionApply_Ref_380(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size, const CeedInt comp_stride,
                                             CeedInt start, CeedInt stop, CeedTransposeMode t_mode, bool use_signs, bool use_orients, CeedVector u,
                                             CeedVector v, CeedRequest *request) {
@@ -552,6 +644,18 @@ static int CeedElemRestrictionApply_Ref_381(CeedElemRestriction rstr, const Ceed
   return CeedElemRestrictionApply_Ref_Core(rstr, 3, 8, 1, start, stop, t_mode, use_signs, use_orients, u, v, request);
 }
 
+static int CeedElemRestrictionApply_Ref_3160(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size, const CeedInt comp_stride,
+                                             CeedInt start, CeedInt stop, CeedTransposeMode t_mode, bool use_signs, bool use_orients, CeedVector u,
+                                             CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(rstr, 3, 16, comp_stride, start, stop, t_mode, use_signs, use_orients, u, v, request);
+}
+
+static int CeedElemRestrictionApply_Ref_3161(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size, const CeedInt comp_stride,
+                                             CeedInt start, CeedInt stop, CeedTransposeMode t_mode, bool use_signs, bool use_orients, CeedVector u,
+                                             CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(rstr, 3, 16, 1, start, stop, t_mode, use_signs, use_orients, u, v, request);
+}
+
 // LCOV_EXCL_START
 static int CeedElemRestrictionApply_Ref_510(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size, const CeedInt comp_stride,
                                             CeedInt start, CeedInt stop, CeedTransposeMode t_mode, bool use_signs, bool use_orients, CeedVector u,
@@ -659,6 +763,57 @@ static int CeedElemRestrictionApplyBlock_Ref(CeedElemRestriction rstr, CeedInt b
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// ElemRestriction Compress Offsets
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionCompressOffsets_Ref(CeedElemRestriction rstr, CeedElemRestriction_Ref *impl) {
+  bool    is_pattern = true;
+  CeedInt num_block, block_size, elem_size, max_delta = 0;
+
+  CeedCallBackend(CeedElemRestrictionGetNumBlocks(rstr, &num_block));
+  CeedCallBackend(CeedElemRestrictionGetBlockSize(rstr, &block_size));
+  CeedCallBackend(CeedElemRestrictionGetElementSize(rstr, &elem_size));
+  const CeedInt  block_len = block_size * elem_size;
+  const CeedInt *offsets   = impl->offsets;
+
+  if (num_block == 0 || block_len == 0) return CEED_ERROR_SUCCESS;
+
+  // Base offset of each element block
+  CeedCallBackend(CeedMalloc(num_block, &impl->offsets_base));
+  for (CeedInt b = 0; b < num_block; b++) {
+    CeedInt base = offsets[b * block_len];
+
+    for (CeedInt i = 1; i < block_len; i++) base = CeedIntMin(base, offsets[b * block_len + i]);
+    impl->offsets_base[b] = base;
+  }
+
+  // Structured meshes share one set of relative offsets across all element blocks
+  for (CeedInt b = 1; b < num_block && is_pattern; b++) {
+    for (CeedInt i = 0; i < block_len && is_pattern; i++) {
+      is_pattern = offsets[b * block_len + i] - impl->offsets_base[b] == offsets[i] - impl->offsets_base[0];
+    }
+  }
+  if (is_pattern) {
+    CeedCallBackend(CeedMalloc(block_len, &impl->offsets_pattern));
+    for (CeedInt i = 0; i < block_len; i++) impl->offsets_pattern[i] = offsets[i] - impl->offsets_base[0];
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Otherwise use 16-bit offsets relative to the base when the element blocks are compact enough
+  for (CeedInt b = 0; b < num_block; b++) {
+    for (CeedInt i = 0; i < block_len; i++) max_delta = CeedIntMax(max_delta, offsets[b * block_len + i] - impl->offsets_base[b]);
+  }
+  if (max_delta <= UINT16_MAX) {
+    CeedCallBackend(CeedMalloc((CeedSize)num_block * block_len, &impl->offsets_delta));
+    for (CeedInt b = 0; b < num_block; b++) {
+      for (CeedInt i = 0; i < block_len; i++) impl->offsets_delta[b * block_len + i] = (uint16_t)(offsets[b * block_len + i] - impl->offsets_base[b]);
+    }
+    return CEED_ERROR_SUCCESS;
+  }
+  CeedCallBackend(CeedFree(&impl->offsets_base));
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // ElemRestriction Get Offsets
 //------------------------------------------------------------------------------
@@ -669,10 +824,46 @@ static int CeedElemRestrictionGetOffsets_Ref(CeedElemRestriction rstr, CeedMemTy
 
   CeedCheck(mem_type == CEED_MEM_HOST, CeedElemRestrictionReturnCeed(rstr), CEED_ERROR_BACKEND, "Can only provide to HOST memory");
 
+  // Expand compressed offsets into a temporary array, freed when the last reader restores it
+  if (!impl->offsets && impl->offsets_base) {
+    if (!impl->offsets_expanded) {
+      CeedInt num_block, block_size, elem_size;
+
+      CeedCallBackend(CeedElemRestrictionGetNumBlocks(rstr, &num_block));
+      CeedCallBackend(CeedElemRestrictionGetBlockSize(rstr, &block_size));
+      CeedCallBackend(CeedElemRestrictionGetElementSize(rstr, &elem_size));
+      const CeedInt block_len = block_size * elem_size;
+
+      CeedCallBackend(CeedMalloc((CeedSize)num_block * block_len, &impl->offsets_expanded));
+      for (CeedInt b = 0; b < num_block; b++) {
+        for (CeedInt i = 0; i < block_len; i++) {
+          impl->offsets_expanded[b * block_len + i] =
+              impl->offsets_base[b] + (impl->offsets_pattern ? impl->offsets_pattern[i] : impl->offsets_delta[b * block_len + i]);
+        }
+      }
+    }
+    impl->num_expanded_readers++;
+    *offsets = impl->offsets_expanded;
+    return CEED_ERROR_SUCCESS;
+  }
   *offsets = impl->offsets;
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// ElemRestriction Restore Offsets
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionRestoreOffsets_Ref(CeedElemRestriction rstr, const CeedInt **offsets) {
+  CeedElemRestriction_Ref *impl;
+
+  CeedCallBackend(CeedElemRestrictionGetData(rstr, &impl));
+  if (impl->offsets_expanded && *offsets == impl->offsets_expanded) {
+    impl->num_expanded_readers--;
+    if (impl->num_expanded_readers == 0) CeedCallBackend(CeedFree(&impl->offsets_expanded));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // ElemRestriction Get Orientations
 //------------------------------------------------------------------------------
@@ -709,6 +900,10 @@ static int CeedElemRestrictionDestroy_Ref(CeedElemRestriction rstr) {
 
   CeedCallBackend(CeedElemRestrictionGetData(rstr, &impl));
   CeedCallBackend(CeedFree(&impl->offsets_owned));
+  CeedCallBackend(CeedFree(&impl->offsets_base));
+  CeedCallBackend(CeedFree(&impl->offsets_pattern));
+  CeedCallBackend(CeedFree(&impl->offsets_delta));
+  CeedCallBackend(CeedFree(&impl->offsets_expanded));
   CeedCallBackend(CeedFree(&impl->orients_owned));
   CeedCallBackend(CeedFree(&impl->curl_orients_owned));
   CeedCallBackend(CeedFree(&impl));
@@ -795,6 +990,15 @@ int CeedElemRestrictionCreate_Ref(CeedMemType mem_type, CeedCopyMode copy_mode,
     num_offsets = rstr_type == CEED_RESTRICTION_POINTS ? (num_elem + 1 + num_points) : (num_elem * elem_size);
     CeedCallBackend(CeedSetHostCeedIntArray(offsets, copy_mode, num_offsets, &impl->offsets_owned, &impl->offsets_borrowed, &impl->offsets));
 
+    // Compress standard offsets; owned full offsets are dropped and only expanded while read
+    if (rstr_type == CEED_RESTRICTION_STANDARD) {
+      CeedCallBackend(CeedElemRestrictionCompressOffsets_Ref(rstr, impl));
+      if (impl->offsets_base && impl->offsets_owned) {
+        CeedCallBackend(CeedFree(&impl->offsets_owned));
+        impl->offsets = NULL;
+      }
+    }
+
     // Orientation data
     if (rstr_type == CEED_RESTRICTION_ORIENTED) {
       CeedCheck(orients != NULL, ceed, CEED_ERROR_BACKEND, "No orients array provided for oriented restriction");
@@ -809,7 +1013,8 @@ int CeedElemRestrictionCreate_Ref(CeedMemType mem_type, CeedCopyMode copy_mode,
   // Set apply function based upon num_comp, block_size, and comp_stride
   CeedInt index = -1;
 
-  if (block_size < 10) index = 100 * num_comp + 10 * block_size + (comp_stride == 1);
+  if (num_comp < 10 && block_size < 10) index = 100 * num_comp + 10 * block_size + (comp_stride == 1);
+  else if (num_comp < 10 && block_size < 100) index = 1000 * num_comp + 10 * block_size + (comp_stride == 1);
   switch (index) {
     case 110:
       impl->Apply = CeedElemRestrictionApply_Ref_110;
@@ -817,24 +1022,48 @@ int CeedElemRestrictionCreate_Ref(CeedMemType mem_type, CeedCopyMode copy_mode,
     case 111:
       impl->Apply = CeedElemRestrictionApply_Ref_111;
       break;
+    case 140:
+      impl->Apply = CeedElemRestrictionApply_Ref_140;
+      break;
+    case 141:
+      impl->Apply = CeedElemRestrictionApply_Ref_141;
+      break;
     case 180:
       impl->Apply = CeedElemRestrictionApply_Ref_180;
       break;
     case 181:
       impl->Apply = CeedElemRestrictionApply_Ref_181;
       break;
+    case 1160:
+      impl->Apply = CeedElemRestrictionApply_Ref_1160;
+      break;
+    case 1161:
+      impl->Apply = CeedElemRestrictionApply_Ref_1161;
+      break;
     case 310:
       impl->Apply = CeedElemRestrictionApply_Ref_310;
       break;
     case 311:
       impl->Apply = CeedElemRestrictionApply_Ref_311;
       break;
+    case 340:
+      impl->Apply = CeedElemRestrictionApply_Ref_340;
+      break;
+    case 341:
+      impl->Apply = CeedElemRestrictionApply_Ref_341;
+      break;
     case 380:
       impl->Apply = CeedElemRestrictionApply_Ref_380;
       break;
     case 381:
       impl->Apply = CeedElemRestrictionApply_Ref_381;
       break;
+    case 3160:
+      impl->Apply = CeedElemRestrictionApply_Ref_3160;
+      break;
+    case 3161:
+      impl->Apply = CeedElemRestrictionApply_Ref_3161;
+      break;
     // LCOV_EXCL_START
     case 510:
       impl->Apply = CeedElemRestrictionApply_Ref_510;
@@ -865,6 +1094,7 @@ int CeedElemRestrictionCreate_Ref(CeedMemType mem_type, CeedCopyMode copy_mode,
   }
   CeedCallBackend(CeedSetBackendFunction(ceed, "ElemRestriction", rstr, "ApplyBlock", CeedElemRestrictionApplyBlock_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "ElemRestriction", rstr, "GetOffsets", CeedElemRestrictionGetOffsets_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "ElemRestriction", rstr, "RestoreOffsets", CeedElemRestrictionRestoreOffsets_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "ElemRestriction", rstr, "GetOrientations", CeedElemRestrictionGetOrientations_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "ElemRestriction", rstr, "GetCurlOrientations", CeedElemRestrictionGetCurlOrientations_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "ElemRestriction", rstr, "Destroy", CeedElemRestrictionDestroy_Ref));
@@ -21,6 +21,11 @@ typedef struct {
   const CeedInt  *offsets;
   const CeedInt  *offsets_borrowed;
   const CeedInt  *offsets_owned;
+  CeedInt        *offsets_base;         /* Smallest offset in each element block, for compressed offsets */
+  CeedInt        *offsets_pattern;      /* Offsets relative to the base, shared by all element blocks of a structured mesh */
+  uint16_t       *offsets_delta;        /* Offsets relative to the base of their element block */
+  CeedInt        *offsets_expanded;     /* Full offsets expanded from the compressed form while read */
+  CeedInt         num_expanded_readers; /* Number of readers of the expanded offsets */
   const bool     *orients; /* Orientation, if it exists, is true when the dof must be flipped */
   const bool     *orients_borrowed;
   const bool     *orients_owned;
@@ -33,6 +38,7 @@ typedef struct {
 
 typedef struct {
   CeedScalar *collo_grad_1d;
+  CeedScalar *chebyshev_interp_1d;
   bool        has_collo_interp;
 } CeedBasis_Ref;
 
@@ -48,20 +54,43 @@ typedef struct {
 } CeedQFunctionContext_Ref;
 
 typedef struct {
-  bool        is_identity_qf, is_identity_rstr_op;
-  bool       *skip_rstr_in, *skip_rstr_out, *apply_add_basis_out;
-  CeedInt    *e_data_out_indices;
-  uint64_t   *input_states; /* State counter of inputs */
-  CeedVector *e_vecs_full;  /* Full E-vectors, inputs followed by outputs */
-  CeedVector *e_vecs_in;    /* Single element input E-vectors  */
-  CeedVector *e_vecs_out;   /* Single element output E-vectors */
-  CeedVector *q_vecs_in;    /* Single element input Q-vectors  */
-  CeedVector *q_vecs_out;   /* Single element output Q-vectors */
-  CeedInt     num_inputs, num_outputs;
-  CeedInt     qf_size_in, qf_size_out;
-  CeedVector  point_coords_elem;
+  bool                is_active;
+  CeedEvalMode        eval_mode;
+  CeedInt             size, elem_size, num_comp;
+  CeedElemRestriction elem_rstr;
+  CeedBasis           basis;
+  CeedVector          vec; /* Passive field vector */
+} CeedOperatorFieldInfo_Ref;
+
+typedef struct {
+  bool                       is_identity_qf, is_identity_rstr_op;
+  bool                      *skip_rstr_in, *skip_rstr_out, *apply_add_basis_out;
+  CeedInt                   *e_data_out_indices;
+  uint64_t                  *input_states;           /* State counter of inputs */
+  CeedOperatorFieldInfo_Ref *fields_in, *fields_out; /* Field data cached at setup */
+  CeedQFunction              qf;
+  CeedQFunctionUser          qf_function;            /* User function called directly in the element loop, if available */
+  CeedVector                *e_vecs_full;            /* Full E-vectors, inputs followed by outputs */
+  CeedVector                *e_vecs_in;              /* Single element input E-vectors  */
+  CeedVector                *e_vecs_out;             /* Single element output E-vectors */
+  CeedVector                *q_vecs_in;              /* Single element input Q-vectors  */
+  CeedVector                *q_vecs_out;             /* Single element output Q-vectors */
+  CeedInt                    num_inputs, num_outputs, num_elem, Q;
+  CeedInt                    qf_size_in, qf_size_out;
+  CeedVector                *qf_batch_in;            /* Input Q-vectors widened by the active input directions for QFunction assembly */
+  CeedVector                *qf_batch_out;           /* Output Q-vectors widened by the active input directions for QFunction assembly */
+  CeedVector                 point_coords_elem;
 } CeedOperator_Ref;
 
+typedef struct {
+  bool                *is_fused;       /* Suboperators applied with the shared E-vectors */
+  bool                *is_shared_out;  /* Shared E-vector sums active outputs, otherwise holds the restricted active input */
+  CeedInt              num_shared;
+  CeedInt             *shared_indices; /* Shared E-vector of each suboperator field, inputs followed by outputs, -1 if not shared */
+  CeedElemRestriction *shared_rstrs;   /* Active restrictions used by more than one suboperator */
+  CeedVector          *shared_e_vecs;
+} CeedCompositeOperator_Ref;
+
 CEED_INTERN int CeedVectorCreate_Ref(CeedSize n, CeedVector vec);
 
 CEED_INTERN int CeedElemRestrictionCreate_Ref(CeedMemType mem_type, CeedCopyMode copy_mode, const CeedInt *offsets, const bool *orients,
@@ -83,4 +112,5 @@ CEED_INTERN int CeedQFunctionCreate_Ref(CeedQFunction qf);
 CEED_INTERN int CeedQFunctionContextCreate_Ref(CeedQFunctionContext ctx);
 
 CEED_INTERN int CeedOperatorCreate_Ref(CeedOperator op);
+CEED_INTERN int CeedCompositeOperatorCreate_Ref(CeedOperator op);
 CEED_INTERN int CeedOperatorCreateAtPoints_Ref(CeedOperator op);
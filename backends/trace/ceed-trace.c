@@ -0,0 +1,180 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#define _DEFAULT_SOURCE
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#else
+#include <pthread.h>
+#endif
+
+#include "ceed-trace.h"
+
+#define CEED_TRACE_PREFIX "/cpu/self/trace"
+
+//------------------------------------------------------------------------------
+// Thread id, as shown by tools such as top
+//------------------------------------------------------------------------------
+static long CeedGetThreadId_Trace(void) {
+#if defined(__linux__)
+  static __thread long thread_id = 0;
+
+  if (!thread_id) thread_id = syscall(SYS_gettid);
+  return thread_id;
+#else
+  return (long)(uintptr_t)pthread_self();
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Record an event in the ring buffer, overwriting the oldest event once it is full
+//------------------------------------------------------------------------------
+static int CeedTraceEvent_Trace(Ceed ceed, const char *name, const char *object_name, CeedSize size, double start, double duration) {
+  size_t           index;
+  Ceed_Trace      *data;
+  CeedEvent_Trace *event;
+
+  CeedCallBackend(CeedGetData(ceed, &data));
+  index = __atomic_fetch_add(&data->num_events, 1, __ATOMIC_RELAXED) % data->max_events;
+  event = &data->events[index];
+
+  event->name = name;
+  if (object_name) strncpy(event->object_name, object_name, CEED_TRACE_MAX_NAME_LEN - 1);
+  else event->object_name[0] = '\0';
+  event->size      = size;
+  event->start     = start;
+  event->duration  = duration;
+  event->thread_id = CeedGetThreadId_Trace();
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Write a JSON string, escaping quotes, backslashes, and control characters
+//------------------------------------------------------------------------------
+static void CeedWriteString_Trace(FILE *file, const char *str) {
+  fputc('"', file);
+  for (const unsigned char *c = (const unsigned char *)str; *c; c++) {
+    if (*c == '"' || *c == '\\') fprintf(file, "\\%c", *c);
+    else if (*c < 0x20) fprintf(file, "\\u%04x", *c);
+    else fputc(*c, file);
+  }
+  fputc('"', file);
+}
+
+//------------------------------------------------------------------------------
+// Write the recorded events, oldest first, in the Chrome trace event format also read by Perfetto
+//------------------------------------------------------------------------------
+static int CeedTraceWrite_Trace(Ceed ceed, Ceed_Trace *data) {
+  const long   pid        = (long)getpid();
+  const size_t num_events = data->num_events < data->max_events ? data->num_events : data->max_events;
+  const size_t first      = data->num_events < data->max_events ? 0 : data->num_events % data->max_events;
+  FILE        *file       = fopen(data->file_name, "w");
+
+  CeedCheck(file, ceed, CEED_ERROR_BACKEND, "Could not open trace file %s", data->file_name);
+  fprintf(file, "{\"traceEvents\":[\n");
+  fprintf(file, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%ld,\"tid\":0,\"args\":{\"name\":", pid);
+  CeedWriteString_Trace(file, data->delegate_resource);
+  fprintf(file, "}}");
+  for (size_t i = 0; i < num_events; i++) {
+    const CeedEvent_Trace *event = &data->events[(first + i) % data->max_events];
+
+    fprintf(file, ",\n{\"name\":");
+    CeedWriteString_Trace(file, event->name);
+    fprintf(file, ",\"cat\":\"libceed\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%ld,\"tid\":%ld,\"args\":{\"size\":%" CeedSize_FMT,
+            1e6 * (event->start - data->start_time), 1e6 * event->duration, pid, event->thread_id, event->size);
+    if (event->object_name[0]) {
+      fprintf(file, ",\"object\":");
+      CeedWriteString_Trace(file, event->object_name);
+    }
+    fprintf(file, "}}");
+  }
+  fprintf(file, "\n],\"displayTimeUnit\":\"ns\",\"otherData\":{\"dropped_events\":%zu}}\n", data->num_events - num_events);
+  CeedCheck(!fclose(file), ceed, CEED_ERROR_BACKEND, "Could not write trace file %s", data->file_name);
+  CeedDebug(ceed, "Wrote %zu trace events to %s\n", num_events, data->file_name);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Backend Destroy
+//------------------------------------------------------------------------------
+static int CeedDestroy_Trace(Ceed ceed) {
+  Ceed_Trace *data;
+
+  CeedCallBackend(CeedGetData(ceed, &data));
+  CeedCallBackend(CeedTraceWrite_Trace(ceed, data));
+  CeedCallBackend(CeedFree(&data->events));
+  CeedCallBackend(CeedFree(&data->file_name));
+  CeedCallBackend(CeedFree(&data->delegate_resource));
+  CeedCallBackend(CeedFree(&data));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Backend Init
+//------------------------------------------------------------------------------
+static int CeedInit_Trace(const char *resource, Ceed ceed) {
+  static int  num_contexts = 0;
+  bool        is_deterministic;
+  const char *delegate_resource = &resource[strlen(CEED_TRACE_PREFIX)];
+  Ceed        ceed_delegate;
+  Ceed_Trace *data;
+
+  CeedCheck(!strncmp(resource, CEED_TRACE_PREFIX, strlen(CEED_TRACE_PREFIX)), ceed, CEED_ERROR_BACKEND, "Trace backend cannot use resource: %s",
+            resource);
+  // The resource after the prefix names the backend to trace, such as /cpu/self/trace/cpu/self/opt/blocked
+  if (delegate_resource[0] != '/' || !delegate_resource[1] || delegate_resource[1] == ':') delegate_resource = "/cpu/self/ref/serial";
+
+  // Create delegate Ceed that all work is dispatched through
+  CeedCallBackend(CeedInit(delegate_resource, &ceed_delegate));
+  CeedCallBackend(CeedSetDelegate(ceed, ceed_delegate));
+  CeedCallBackend(CeedIsDeterministic(ceed_delegate, &is_deterministic));
+  CeedCallBackend(CeedSetDeterministic(ceed, is_deterministic));
+  CeedCallBackend(CeedDestroy(&ceed_delegate));
+
+  // Ring buffer of events and trace file, from CEED_TRACE_MAX_EVENTS and CEED_TRACE_FILE
+  CeedCallBackend(CeedCalloc(1, &data));
+  CeedCallBackend(CeedStringAllocCopy(delegate_resource, &data->delegate_resource));
+  {
+    const char *max_events_spec = getenv("CEED_TRACE_MAX_EVENTS");
+
+    data->max_events = max_events_spec ? (size_t)atol(max_events_spec) : CEED_TRACE_DEFAULT_MAX_EVENTS;
+  }
+  CeedCheck(data->max_events > 0, ceed, CEED_ERROR_BACKEND, "Trace backend must record at least one event");
+  CeedCallBackend(CeedCalloc(data->max_events, &data->events));
+  {
+    const char *file_name = getenv("CEED_TRACE_FILE");
+    char        default_file_name[64];
+
+    if (!file_name) {
+      if (num_contexts) snprintf(default_file_name, sizeof(default_file_name), "ceed-trace-%ld-%d.json", (long)getpid(), num_contexts);
+      else snprintf(default_file_name, sizeof(default_file_name), "ceed-trace-%ld.json", (long)getpid());
+      file_name = default_file_name;
+    }
+    CeedCallBackend(CeedStringAllocCopy(file_name, &data->file_name));
+    num_contexts++;
+  }
+  CeedCallBackend(CeedGetWallTime(&data->start_time));
+  CeedCallBackend(CeedSetData(ceed, data));
+
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "TraceEvent", CeedTraceEvent_Trace));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "Destroy", CeedDestroy_Trace));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Backend Register
+//------------------------------------------------------------------------------
+CEED_INTERN int CeedRegister_Trace(void) { return CeedRegister(CEED_TRACE_PREFIX "/", CeedInit_Trace, 100); }
+
+//------------------------------------------------------------------------------
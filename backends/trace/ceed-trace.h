@@ -0,0 +1,31 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+#pragma once
+
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <stddef.h>
+
+#define CEED_TRACE_MAX_NAME_LEN 32
+#define CEED_TRACE_DEFAULT_MAX_EVENTS 65536
+
+typedef struct {
+  const char *name;
+  char        object_name[CEED_TRACE_MAX_NAME_LEN];
+  CeedSize    size;
+  double      start, duration;
+  long        thread_id;
+} CeedEvent_Trace;
+
+typedef struct {
+  char            *file_name;
+  char            *delegate_resource;
+  double           start_time;
+  size_t           max_events;
+  size_t           num_events; /* Number of events recorded, the ring buffer holds the last max_events of them */
+  CeedEvent_Trace *events;
+} Ceed_Trace;
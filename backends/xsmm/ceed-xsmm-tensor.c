@@ -11,46 +11,77 @@
 
 #include "ceed-xsmm.h"
 
+//------------------------------------------------------------------------------
+// Get Kernel for Contraction Shape
+//------------------------------------------------------------------------------
+static inline int CeedTensorContractGetKernel_Xsmm(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J, CeedTransposeMode t_mode,
+                                                   const CeedInt add, libxsmm_gemmfunction *kernel) {
+  const CeedInt            key_A = C == 1 ? A : 0;  // Kernel for C > 1 is independent of A
+  CeedTensorContract_Xsmm *impl;
+
+  CeedCallBackend(CeedTensorContractGetData(contract, &impl));
+
+  // Check for cached kernel
+  for (CeedInt i = 0; i < impl->num_kernels; i++) {
+    const CeedTensorContractKernel_Xsmm *cached = &impl->kernels[i];
+
+    if (cached->A == key_A && cached->B == B && cached->C == C && cached->J == J && cached->t_mode == t_mode && cached->add == !!add) {
+      *kernel = cached->kernel;
+      return CEED_ERROR_SUCCESS;
+    }
+  }
+
+  // Build the required kernel
+  if (C == 1) {
+    const int                flags_t    = LIBXSMM_GEMM_FLAGS(!t_mode ? 'T' : 'N', 'N');
+    const int                flags_ab   = (!add) ? LIBXSMM_GEMM_FLAG_BETA_0 : LIBXSMM_BASIC_GEMM_FLAG_NONE;
+    const int                flags      = (flags_t | flags_ab);
+    const libxsmm_gemm_shape gemm_shape = (CEED_SCALAR_TYPE == CEED_SCALAR_FP64)
+                                              ? libxsmm_create_gemm_shape(J, A, B, !t_mode ? B : J, B, J, LIBXSMM_DATATYPE_F64, LIBXSMM_DATATYPE_F64,
+                                                                          LIBXSMM_DATATYPE_F64, LIBXSMM_DATATYPE_F64)
+                                              : libxsmm_create_gemm_shape(J, A, B, !t_mode ? B : J, B, J, LIBXSMM_DATATYPE_F32, LIBXSMM_DATATYPE_F32,
+                                                                          LIBXSMM_DATATYPE_F32, LIBXSMM_DATATYPE_F32);
+
+    *kernel = libxsmm_dispatch_gemm(gemm_shape, (libxsmm_bitfield)(flags), (libxsmm_bitfield)LIBXSMM_GEMM_PREFETCH_NONE);
+  } else {
+    const int                flags_t    = LIBXSMM_GEMM_FLAGS('N', t_mode ? 'T' : 'N');
+    const int                flags_ab   = (!add) ? LIBXSMM_GEMM_FLAG_BETA_0 : LIBXSMM_BASIC_GEMM_FLAG_NONE;
+    const int                flags      = (flags_t | flags_ab);
+    const libxsmm_gemm_shape gemm_shape = (CEED_SCALAR_TYPE == CEED_SCALAR_FP64)
+                                              ? libxsmm_create_gemm_shape(C, J, B, C, !t_mode ? B : J, C, LIBXSMM_DATATYPE_F64, LIBXSMM_DATATYPE_F64,
+                                                                          LIBXSMM_DATATYPE_F64, LIBXSMM_DATATYPE_F64)
+                                              : libxsmm_create_gemm_shape(C, J, B, C, !t_mode ? B : J, C, LIBXSMM_DATATYPE_F32, LIBXSMM_DATATYPE_F32,
+                                                                          LIBXSMM_DATATYPE_F32, LIBXSMM_DATATYPE_F32);
+
+    *kernel = libxsmm_dispatch_gemm(gemm_shape, (libxsmm_bitfield)(flags), (libxsmm_bitfield)LIBXSMM_GEMM_PREFETCH_NONE);
+  }
+  CeedCheck(*kernel, CeedTensorContractReturnCeed(contract), CEED_ERROR_BACKEND, "LIBXSMM kernel failed to build.");
+
+  // Cache kernel
+  if (impl->num_kernels == impl->max_kernels) {
+    impl->max_kernels = impl->max_kernels ? 2 * impl->max_kernels : 8;
+    CeedCallBackend(CeedRealloc(impl->max_kernels, &impl->kernels));
+  }
+  impl->kernels[impl->num_kernels++] = (CeedTensorContractKernel_Xsmm){key_A, B, C, J, t_mode, !!add, *kernel};
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Tensor Contract Apply
 //------------------------------------------------------------------------------
 static int CeedTensorContractApply_Xsmm(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
                                         CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u, CeedScalar *restrict v) {
-  if (C == 1) {
-    // Build or query the required kernel
-    const int                  flags_t    = LIBXSMM_GEMM_FLAGS(!t_mode ? 'T' : 'N', 'N');
-    const int                  flags_ab   = (!add) ? LIBXSMM_GEMM_FLAG_BETA_0 : LIBXSMM_BASIC_GEMM_FLAG_NONE;
-    const int                  flags      = (flags_t | flags_ab);
-    const libxsmm_gemm_shape   gemm_shape = (CEED_SCALAR_TYPE == CEED_SCALAR_FP64)
-                                                ? libxsmm_create_gemm_shape(J, A, B, !t_mode ? B : J, B, J, LIBXSMM_DATATYPE_F64, LIBXSMM_DATATYPE_F64,
-                                                                            LIBXSMM_DATATYPE_F64, LIBXSMM_DATATYPE_F64)
-                                                : libxsmm_create_gemm_shape(J, A, B, !t_mode ? B : J, B, J, LIBXSMM_DATATYPE_F32, LIBXSMM_DATATYPE_F32,
-                                                                            LIBXSMM_DATATYPE_F32, LIBXSMM_DATATYPE_F32);
-    const libxsmm_gemmfunction kernel = libxsmm_dispatch_gemm(gemm_shape, (libxsmm_bitfield)(flags), (libxsmm_bitfield)LIBXSMM_GEMM_PREFETCH_NONE);
-    libxsmm_gemm_param         gemm_param;
-
-    CeedCheck(kernel, CeedTensorContractReturnCeed(contract), CEED_ERROR_BACKEND, "LIBXSMM kernel failed to build.");
+  libxsmm_gemmfunction kernel;
+  libxsmm_gemm_param   gemm_param;
 
+  CeedCallBackend(CeedTensorContractGetKernel_Xsmm(contract, A, B, C, J, t_mode, add, &kernel));
+  if (C == 1) {
     // Run kernel
     gemm_param.a.primary = (CeedScalar *)&t[0];
     gemm_param.b.primary = (CeedScalar *)&u[0];
     gemm_param.c.primary = (CeedScalar *)&v[0];
     kernel(&gemm_param);
   } else {
-    // Build or query the required kernel
-    const int                  flags_t    = LIBXSMM_GEMM_FLAGS('N', t_mode ? 'T' : 'N');
-    const int                  flags_ab   = (!add) ? LIBXSMM_GEMM_FLAG_BETA_0 : LIBXSMM_BASIC_GEMM_FLAG_NONE;
-    const int                  flags      = (flags_t | flags_ab);
-    const libxsmm_gemm_shape   gemm_shape = (CEED_SCALAR_TYPE == CEED_SCALAR_FP64)
-                                                ? libxsmm_create_gemm_shape(C, J, B, C, !t_mode ? B : J, C, LIBXSMM_DATATYPE_F64, LIBXSMM_DATATYPE_F64,
-                                                                            LIBXSMM_DATATYPE_F64, LIBXSMM_DATATYPE_F64)
-                                                : libxsmm_create_gemm_shape(C, J, B, C, !t_mode ? B : J, C, LIBXSMM_DATATYPE_F32, LIBXSMM_DATATYPE_F32,
-                                                                            LIBXSMM_DATATYPE_F32, LIBXSMM_DATATYPE_F32);
-    const libxsmm_gemmfunction kernel = libxsmm_dispatch_gemm(gemm_shape, (libxsmm_bitfield)(flags), (libxsmm_bitfield)LIBXSMM_GEMM_PREFETCH_NONE);
-    libxsmm_gemm_param         gemm_param;
-
-    CeedCheck(kernel, CeedTensorContractReturnCeed(contract), CEED_ERROR_BACKEND, "LIBXSMM kernel failed to build.");
-
     // Run kernel
     gemm_param.b.primary = (CeedScalar *)&t[0];
     for (CeedInt a = 0; a < A; a++) {
@@ -62,11 +93,31 @@ static int CeedTensorContractApply_Xsmm(CeedTensorContract contract, CeedInt A,
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Tensor Contract Destroy
+//------------------------------------------------------------------------------
+static int CeedTensorContractDestroy_Xsmm(CeedTensorContract contract) {
+  CeedTensorContract_Xsmm *impl;
+
+  CeedCallBackend(CeedTensorContractGetData(contract, &impl));
+  CeedCallBackend(CeedFree(&impl->kernels));
+  CeedCallBackend(CeedFree(&impl));
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Tensor Contract Create
 //------------------------------------------------------------------------------
 int CeedTensorContractCreate_Xsmm(CeedTensorContract contract) {
-  CeedCallBackend(CeedSetBackendFunction(CeedTensorContractReturnCeed(contract), "TensorContract", contract, "Apply", CeedTensorContractApply_Xsmm));
+  Ceed                     ceed;
+  CeedTensorContract_Xsmm *impl;
+
+  CeedCallBackend(CeedTensorContractGetCeed(contract, &ceed));
+  CeedCallBackend(CeedCalloc(1, &impl));
+  CeedCallBackend(CeedTensorContractSetData(contract, impl));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "TensorContract", contract, "Apply", CeedTensorContractApply_Xsmm));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "TensorContract", contract, "Destroy", CeedTensorContractDestroy_Xsmm));
+  CeedCallBackend(CeedDestroy(&ceed));
   return CEED_ERROR_SUCCESS;
 }
 
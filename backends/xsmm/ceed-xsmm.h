@@ -8,5 +8,18 @@
 
 #include <ceed.h>
 #include <ceed/backend.h>
+#include <libxsmm.h>
+
+typedef struct {
+  CeedInt              A, B, C, J;
+  CeedTransposeMode    t_mode;
+  bool                 add;
+  libxsmm_gemmfunction kernel;
+} CeedTensorContractKernel_Xsmm;
+
+typedef struct {
+  CeedInt                        num_kernels, max_kernels;
+  CeedTensorContractKernel_Xsmm *kernels; /* Kernels built for each contraction shape used */
+} CeedTensorContract_Xsmm;
 
 CEED_INTERN int CeedTensorContractCreate_Xsmm(CeedTensorContract contract);
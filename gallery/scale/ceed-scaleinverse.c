@@ -0,0 +1,31 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <ceed/jit-source/gallery/ceed-scaleinverse.h>
+#include <string.h>
+
+/**
+  @brief  Set fields for inverse scaling `CeedQFunction` that divides inputs by a scaling factor
+**/
+static int CeedQFunctionInit_ScaleInverse(Ceed ceed, const char *requested, CeedQFunction qf) {
+  // Check QFunction name
+  const char *name = "ScaleInverse";
+  CeedCheck(!strcmp(name, requested), ceed, CEED_ERROR_UNSUPPORTED, "QFunction '%s' does not match requested name: %s", name, requested);
+
+  // QFunction fields 'input', 'scale', and 'output' with requested emodes added by the library rather than being added here
+
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Register inverse scaling `CeedQFunction`
+**/
+CEED_INTERN int CeedQFunctionRegister_ScaleInverse(void) {
+  return CeedQFunctionRegister("ScaleInverse", ScaleInverse_loc, 1, ScaleInverse, CeedQFunctionInit_ScaleInverse);
+}
@@ -87,9 +87,20 @@ typedef struct CeedWorkVectors_private *CeedWorkVectors;
 struct CeedWorkVectors_private {
   CeedInt     num_vecs, max_vecs;
   bool       *is_in_use;
+  CeedSize   *lengths;
+  uint64_t   *last_use; /* Checkout count when each vector was last checked out, for LRU eviction */
+  uint64_t    num_checkouts;
+  CeedSize    num_hits, num_misses;
+  CeedSize    total_len, peak_len, max_len; /* Combined lengths of all work vectors; max_len of 0 is unlimited */
   CeedVector *vecs;
 };
 
+// Pending non-blocking work, completed by CeedRequestWait
+struct CeedRequest_private {
+  void *data;
+  int (*Wait)(CeedRequest);
+};
+
 struct Ceed_private {
   const char  *resource;
   Ceed         delegate;
@@ -104,6 +115,7 @@ struct Ceed_private {
   CeedInt      num_jit_defines, max_jit_defines, num_jit_defines_readers;
   int (*Error)(Ceed, const char *, int, const char *, int, const char *, va_list *);
   int (*SetStream)(Ceed, void *);
+  int (*SetBlockSize)(Ceed, CeedInt);
   int (*GetPreferredMemType)(CeedMemType *);
   int (*Destroy)(Ceed);
   int (*VectorCreate)(CeedSize, CeedVector);
@@ -123,6 +135,7 @@ struct Ceed_private {
   int (*OperatorCreate)(CeedOperator);
   int (*OperatorCreateAtPoints)(CeedOperator);
   int (*CompositeOperatorCreate)(CeedOperator);
+  int (*TraceEvent)(Ceed, const char *, const char *, CeedSize, double, double);
   int             ref_count;
   void           *data;
   bool            is_debug;
@@ -152,6 +165,8 @@ struct CeedVector_private {
   int (*Scale)(CeedVector, CeedScalar);
   int (*AXPY)(CeedVector, CeedScalar, CeedVector);
   int (*AXPBY)(CeedVector, CeedScalar, CeedScalar, CeedVector);
+  int (*AXPBYNorm)(CeedVector, CeedScalar, CeedScalar, CeedVector, CeedNormType, CeedScalar *);
+  int (*MDot)(CeedVector, CeedInt, CeedVector *, CeedScalar *);
   int (*PointwiseMult)(CeedVector, CeedVector, CeedVector);
   int (*Reciprocal)(CeedVector);
   int (*Destroy)(CeedVector);
@@ -172,6 +187,7 @@ struct CeedElemRestriction_private {
   int (*ApplyBlock)(CeedElemRestriction, CeedInt, CeedTransposeMode, CeedVector, CeedVector, CeedRequest *);
   int (*GetAtPointsElementOffset)(CeedElemRestriction, CeedInt, CeedSize *);
   int (*GetOffsets)(CeedElemRestriction, CeedMemType, const CeedInt **);
+  int (*RestoreOffsets)(CeedElemRestriction, const CeedInt **);
   int (*GetOrientations)(CeedElemRestriction, CeedMemType, const bool **);
   int (*GetCurlOrientations)(CeedElemRestriction, CeedMemType, const CeedInt8 **);
   int (*Destroy)(CeedElemRestriction);
@@ -264,6 +280,9 @@ struct CeedQFunction_private {
   bool                 is_fortran;
   bool                 is_immutable;
   bool                 is_context_writable;
+  bool                 is_assembly_symmetric;    /* linearization is symmetric in active inputs and outputs */
+  CeedInt              num_assembly_zero_blocks; /* number of (input field, output field) pairs with zero linearization */
+  CeedInt             *assembly_zero_blocks;
   CeedQFunctionContext ctx;  /* user context for function */
   void                *data; /* place for the backend to store any data */
 };
@@ -329,8 +348,10 @@ struct CeedQFunctionAssemblyData_private {
   bool                is_setup;
   bool                reuse_data;
   bool                needs_data_update;
+  bool                needs_compressed_update;
   CeedVector          vec;
   CeedElemRestriction rstr;
+  CeedVector          vec_compressed; /* unique entries only, see CeedOperatorAssemblyDataGetQFunctionEntries */
 };
 
 struct CeedOperatorAssemblyData_private {
@@ -342,14 +363,25 @@ struct CeedOperatorAssemblyData_private {
   CeedEvalMode       **eval_modes_in, **eval_modes_out;
   CeedScalar         **assembled_bases_in, **assembled_bases_out;
   CeedSize           **eval_mode_offsets_in, **eval_mode_offsets_out, num_output_components;
+  CeedInt              num_input_components, num_qf_entries;
+  CeedInt             *qf_entry_map; /* stored index of each assembled CeedQFunction entry, -1 for zero entries, or NULL if all are stored */
 };
 
+// Accumulated profile of one CeedOperator application phase
+typedef struct {
+  CeedSize num_calls;
+  double   time;
+  CeedSize bytes, flops;
+  CeedSize bytes_per_call, flops_per_call; /* estimates for one application, set on first profiled application */
+} CeedOperatorPhaseProfile;
+
 struct CeedOperator_private {
   Ceed         ceed;
   CeedOperator op_fallback, op_fallback_parent;
   int          ref_count;
   int (*LinearAssembleQFunction)(CeedOperator, CeedVector *, CeedElemRestriction *, CeedRequest *);
   int (*LinearAssembleQFunctionUpdate)(CeedOperator, CeedVector, CeedElemRestriction, CeedRequest *);
+  int (*LinearAssembleQFunctionElements)(CeedOperator, CeedInt, CeedInt, CeedVector, CeedRequest *);
   int (*LinearAssembleDiagonal)(CeedOperator, CeedVector, CeedRequest *);
   int (*LinearAssembleAddDiagonal)(CeedOperator, CeedVector, CeedRequest *);
   int (*LinearAssemblePointBlockDiagonal)(CeedOperator, CeedVector, CeedRequest *);
@@ -390,4 +422,6 @@ struct CeedOperator_private {
   CeedContextFieldLabel    *context_labels;
   CeedElemRestriction       rstr_points, first_points_rstr;
   CeedVector                point_coords;
+  bool                      is_profiling, has_profile_estimates;
+  CeedOperatorPhaseProfile  profile[CEED_OPERATOR_NUM_PHASES];
 };
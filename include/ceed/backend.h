@@ -258,10 +258,15 @@ CEED_EXTERN int CeedGetWorkVector(Ceed ceed, CeedSize len, CeedVector *vec);
 CEED_EXTERN int CeedRestoreWorkVector(Ceed ceed, CeedVector *vec);
 CEED_EXTERN int CeedClearWorkVectors(Ceed ceed, CeedSize min_len);
 CEED_EXTERN int CeedGetWorkVectorMemoryUsage(Ceed ceed, CeedScalar *usage_mb);
+CEED_EXTERN int CeedGetWorkVectorStatistics(Ceed ceed, CeedSize *num_hits, CeedSize *num_misses, CeedScalar *peak_usage_mb);
+CEED_EXTERN int CeedSetWorkVectorMemoryLimit(Ceed ceed, CeedScalar limit_mb);
 CEED_EXTERN int CeedGetJitSourceRoots(Ceed ceed, CeedInt *num_source_roots, const char ***jit_source_roots);
 CEED_EXTERN int CeedRestoreJitSourceRoots(Ceed ceed, const char ***jit_source_roots);
 CEED_EXTERN int CeedGetJitDefines(Ceed ceed, CeedInt *num_defines, const char ***jit_defines);
 CEED_EXTERN int CeedRestoreJitDefines(Ceed ceed, const char ***jit_defines);
+CEED_EXTERN int CeedGetWallTime(double *time);
+CEED_EXTERN int CeedTraceBegin(Ceed ceed, double *start);
+CEED_EXTERN int CeedTraceEnd(Ceed ceed, const char *name, const char *object_name, CeedSize size, double start);
 
 CEED_EXTERN int CeedVectorHasValidArray(CeedVector vec, bool *has_valid_array);
 CEED_EXTERN int CeedVectorHasBorrowedArrayOfType(CeedVector vec, CeedMemType mem_type, bool *has_borrowed_array_of_type);
@@ -363,6 +368,7 @@ CEED_EXTERN int  CeedTensorContractDestroy(CeedTensorContract *contract);
 CEED_EXTERN int CeedQFunctionRegister(const char *name, const char *source, CeedInt vec_length, CeedQFunctionUser f,
                                       int (*init)(Ceed, const char *, CeedQFunction));
 CEED_EXTERN int CeedQFunctionSetFortranStatus(CeedQFunction qf, bool status);
+CEED_EXTERN int CeedQFunctionGetFortranStatus(CeedQFunction qf, bool *is_fortran);
 CEED_EXTERN int CeedQFunctionGetVectorLength(CeedQFunction qf, CeedInt *vec_length);
 CEED_EXTERN int CeedQFunctionGetNumArgs(CeedQFunction qf, CeedInt *num_input_fields, CeedInt *num_output_fields);
 CEED_EXTERN int CeedQFunctionGetKernelName(CeedQFunction qf, const char **kernel_name);
@@ -377,6 +383,8 @@ CEED_EXTERN int CeedQFunctionGetInnerContextData(CeedQFunction qf, CeedMemType m
 CEED_EXTERN int CeedQFunctionRestoreInnerContextData(CeedQFunction qf, void *data);
 CEED_EXTERN int CeedQFunctionIsIdentity(CeedQFunction qf, bool *is_identity);
 CEED_EXTERN int CeedQFunctionIsContextWritable(CeedQFunction qf, bool *is_writable);
+CEED_EXTERN int CeedQFunctionIsAssemblySymmetric(CeedQFunction qf, bool *is_symmetric);
+CEED_EXTERN int CeedQFunctionGetAssemblyZeroBlocks(CeedQFunction qf, CeedInt *num_zero_blocks, const CeedInt **zero_blocks);
 CEED_EXTERN int CeedQFunctionGetData(CeedQFunction qf, void *data);
 CEED_EXTERN int CeedQFunctionSetData(CeedQFunction qf, void *data);
 CEED_EXTERN int CeedQFunctionIsImmutable(CeedQFunction qf, bool *is_immutable);
@@ -435,6 +443,8 @@ CEED_EXTERN int CeedOperatorAssemblyDataGetEvalModes(CeedOperatorAssemblyData da
                                                      CeedInt *num_active_bases_out, CeedInt **num_eval_modes_out,
                                                      const CeedEvalMode ***eval_modes_out, CeedSize ***eval_mode_offsets_out,
                                                      CeedSize *num_output_components);
+CEED_EXTERN int CeedOperatorAssemblyDataGetQFunctionEntries(CeedOperatorAssemblyData data, CeedInt *num_input_components, CeedInt *num_entries,
+                                                            const CeedInt **entry_map);
 CEED_EXTERN int CeedOperatorAssemblyDataGetBases(CeedOperatorAssemblyData data, CeedInt *num_active_bases_in, CeedBasis **active_bases_in,
                                                  const CeedScalar ***assembled_bases_in, CeedInt *num_active_bases_out, CeedBasis **active_bases_out,
                                                  const CeedScalar ***assembled_bases_out);
@@ -461,6 +471,9 @@ CEED_EXTERN int CeedOperatorGetFallback(CeedOperator op, CeedOperator *op_fallba
 CEED_EXTERN int CeedOperatorGetFallbackParent(CeedOperator op, CeedOperator *parent);
 CEED_EXTERN int CeedOperatorGetFallbackParentCeed(CeedOperator op, Ceed *parent);
 CEED_EXTERN int CeedOperatorSetSetupDone(CeedOperator op);
+CEED_EXTERN int CeedOperatorIsProfiling(CeedOperator op, bool *is_profiling);
+CEED_EXTERN int CeedOperatorProfileLap(double *time, double *phase_time);
+CEED_EXTERN int CeedOperatorAddProfile(CeedOperator op, const double *phase_times);
 
 CEED_INTERN int CeedMatrixMatrixMultiply(Ceed ceed, const CeedScalar *mat_A, const CeedScalar *mat_B, CeedScalar *mat_C, CeedInt m, CeedInt n,
                                          CeedInt kk);
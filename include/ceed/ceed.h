@@ -103,6 +103,7 @@ typedef struct CeedOperator_private *CeedOperator;
 CEED_EXTERN int CeedRegistryGetList(size_t *n, char ***const resources, CeedInt **array);
 CEED_EXTERN int CeedInit(const char *resource, Ceed *ceed);
 CEED_EXTERN int CeedSetStream(Ceed ceed, void *handle);
+CEED_EXTERN int CeedSetBlockSize(Ceed ceed, CeedInt block_size);
 CEED_EXTERN int CeedReferenceCopy(Ceed ceed, Ceed *ceed_copy);
 CEED_EXTERN int CeedGetResource(Ceed ceed, const char **resource);
 CEED_EXTERN int CeedIsDeterministic(Ceed ceed, bool *is_deterministic);
@@ -177,6 +178,7 @@ CEED_EXTERN const char *const  CeedEvalModes[];
 CEED_EXTERN const char *const  CeedQuadModes[];
 CEED_EXTERN const char *const  CeedElemTopologies[];
 CEED_EXTERN const char *const  CeedContextFieldTypes[];
+CEED_EXTERN const char *const  CeedOperatorPhases[];
 
 CEED_EXTERN int CeedGetPreferredMemType(Ceed ceed, CeedMemType *type);
 
@@ -198,6 +200,8 @@ CEED_EXTERN int  CeedVectorNorm(CeedVector vec, CeedNormType type, CeedScalar *n
 CEED_EXTERN int  CeedVectorScale(CeedVector x, CeedScalar alpha);
 CEED_EXTERN int  CeedVectorAXPY(CeedVector y, CeedScalar alpha, CeedVector x);
 CEED_EXTERN int  CeedVectorAXPBY(CeedVector y, CeedScalar alpha, CeedScalar beta, CeedVector x);
+CEED_EXTERN int  CeedVectorAXPBYNorm(CeedVector y, CeedScalar alpha, CeedScalar beta, CeedVector x, CeedNormType norm_type, CeedScalar *norm);
+CEED_EXTERN int  CeedVectorMDot(CeedVector x, CeedInt num_vecs, CeedVector *vecs, CeedScalar *dots);
 CEED_EXTERN int  CeedVectorPointwiseMult(CeedVector w, CeedVector x, CeedVector y);
 CEED_EXTERN int  CeedVectorReciprocal(CeedVector vec);
 CEED_EXTERN int  CeedVectorViewRange(CeedVector vec, CeedSize start, CeedSize stop, CeedInt step, const char *fp_fmt, FILE *stream);
@@ -364,6 +368,8 @@ CEED_EXTERN int  CeedQFunctionGetFields(CeedQFunction qf, CeedInt *num_input_fie
 CEED_EXTERN int  CeedQFunctionSetContext(CeedQFunction qf, CeedQFunctionContext ctx);
 CEED_EXTERN int  CeedQFunctionSetContextWritable(CeedQFunction qf, bool is_writable);
 CEED_EXTERN int  CeedQFunctionSetUserFlopsEstimate(CeedQFunction qf, CeedSize flops);
+CEED_EXTERN int  CeedQFunctionSetAssemblySymmetric(CeedQFunction qf, bool is_symmetric);
+CEED_EXTERN int  CeedQFunctionSetAssemblyZeroBlock(CeedQFunction qf, const char *input_field_name, const char *output_field_name);
 CEED_EXTERN int  CeedQFunctionView(CeedQFunction qf, FILE *stream);
 CEED_EXTERN int  CeedQFunctionGetCeed(CeedQFunction qf, Ceed *ceed);
 CEED_EXTERN Ceed CeedQFunctionReturnCeed(CeedQFunction qf);
@@ -435,6 +441,7 @@ CEED_EXTERN int  CeedOperatorLinearAssemblePointBlockDiagonal(CeedOperator op, C
 CEED_EXTERN int  CeedOperatorLinearAssembleAddPointBlockDiagonal(CeedOperator op, CeedVector assembled, CeedRequest *request);
 CEED_EXTERN int  CeedOperatorLinearAssemblePointBlockDiagonalSymbolic(CeedOperator op, CeedSize *num_entries, CeedInt **rows, CeedInt **cols);
 CEED_EXTERN int  CeedOperatorLinearAssembleSymbolic(CeedOperator op, CeedSize *num_entries, CeedInt **rows, CeedInt **cols);
+CEED_EXTERN int  CeedOperatorLinearAssembleSymbolicCeedSize(CeedOperator op, CeedSize *num_entries, CeedSize **rows, CeedSize **cols);
 CEED_EXTERN int  CeedOperatorLinearAssemble(CeedOperator op, CeedVector values);
 CEED_EXTERN int  CeedCompositeOperatorGetMultiplicity(CeedOperator op, CeedInt num_skip_indices, CeedInt *skip_indices, CeedVector mult);
 CEED_EXTERN int  CeedOperatorMultigridLevelCreate(CeedOperator op_fine, CeedVector p_mult_fine, CeedElemRestriction rstr_coarse,
@@ -446,6 +453,9 @@ CEED_EXTERN int  CeedOperatorMultigridLevelCreateTensorH1(CeedOperator op_fine,
 CEED_EXTERN int  CeedOperatorMultigridLevelCreateH1(CeedOperator op_fine, CeedVector p_mult_fine, CeedElemRestriction rstr_coarse,
                                                     CeedBasis basis_coarse, const CeedScalar *interp_c_to_f, CeedOperator *op_coarse,
                                                     CeedOperator *op_prolong, CeedOperator *op_restrict);
+CEED_EXTERN int  CeedOperatorMultigridHierarchyCreate(CeedOperator op_fine, CeedInt num_levels, const CeedVector *p_mult,
+                                                     const CeedElemRestriction *rstrs_coarse, const CeedBasis *bases_coarse, CeedOperator *ops_coarse,
+                                                     CeedOperator *ops_prolong, CeedOperator *ops_restrict);
 CEED_EXTERN int  CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdm_inv, CeedRequest *request);
 CEED_EXTERN int  CeedOperatorSetName(CeedOperator op, const char *name);
 CEED_EXTERN int  CeedOperatorView(CeedOperator op, FILE *stream);
@@ -455,6 +465,11 @@ CEED_EXTERN Ceed CeedOperatorReturnCeed(CeedOperator op);
 CEED_EXTERN int  CeedOperatorGetNumElements(CeedOperator op, CeedInt *num_elem);
 CEED_EXTERN int  CeedOperatorGetNumQuadraturePoints(CeedOperator op, CeedInt *num_qpts);
 CEED_EXTERN int  CeedOperatorGetFlopsEstimate(CeedOperator op, CeedSize *flops);
+CEED_EXTERN int  CeedOperatorSetProfiling(CeedOperator op, bool is_profiling);
+CEED_EXTERN int  CeedOperatorGetProfile(CeedOperator op, CeedOperatorPhase phase, CeedSize *num_calls, double *time, CeedSize *bytes,
+                                        CeedSize *flops);
+CEED_EXTERN int  CeedOperatorResetProfile(CeedOperator op);
+CEED_EXTERN int  CeedOperatorViewProfile(CeedOperator op, FILE *stream);
 CEED_EXTERN int  CeedOperatorGetContext(CeedOperator op, CeedQFunctionContext *ctx);
 CEED_EXTERN int  CeedOperatorGetContextFieldLabel(CeedOperator op, const char *field_name, CeedContextFieldLabel *field_label);
 CEED_EXTERN int  CeedOperatorSetContextDouble(CeedOperator op, CeedContextFieldLabel field_label, double *values);
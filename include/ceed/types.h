@@ -254,4 +254,23 @@ typedef enum {
   CEED_CONTEXT_FIELD_BOOL = 3,
 } CeedContextFieldType;
 
+/// Phase of a CeedOperator application, for profiling
+/// @ingroup CeedOperator
+typedef enum {
+  /// Restriction of inputs to E-vectors
+  CEED_OPERATOR_PHASE_INPUT_RESTRICTION = 0,
+  /// Basis action on inputs
+  CEED_OPERATOR_PHASE_INPUT_BASIS = 1,
+  /// QFunction evaluation
+  CEED_OPERATOR_PHASE_QFUNCTION = 2,
+  /// Transpose basis action on outputs
+  CEED_OPERATOR_PHASE_OUTPUT_BASIS = 3,
+  /// Transpose restriction of outputs from E-vectors
+  CEED_OPERATOR_PHASE_OUTPUT_RESTRICTION = 4,
+} CeedOperatorPhase;
+
+/// Number of CeedOperatorPhase values
+/// @ingroup CeedOperator
+#define CEED_OPERATOR_NUM_PHASES 5
+
 #endif  // CEED_QFUNCTION_DEFS_H
@@ -1942,9 +1942,13 @@ int CeedBasisView(CeedBasis basis, FILE *stream) {
   @ref User
 **/
 int CeedBasisApply(CeedBasis basis, CeedInt num_elem, CeedTransposeMode t_mode, CeedEvalMode eval_mode, CeedVector u, CeedVector v) {
+  double trace_start;
+
   CeedCall(CeedBasisApplyCheckDims(basis, num_elem, t_mode, eval_mode, u, v));
   CeedCheck(basis->Apply, CeedBasisReturnCeed(basis), CEED_ERROR_UNSUPPORTED, "Backend does not support CeedBasisApply");
+  CeedCall(CeedTraceBegin(CeedBasisReturnCeed(basis), &trace_start));
   CeedCall(basis->Apply(basis, num_elem, t_mode, eval_mode, u, v));
+  CeedCall(CeedTraceEnd(CeedBasisReturnCeed(basis), "CeedBasisApply", NULL, num_elem, trace_start));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1970,10 +1974,14 @@ int CeedBasisApply(CeedBasis basis, CeedInt num_elem, CeedTransposeMode t_mode,
   @ref User
 **/
 int CeedBasisApplyAdd(CeedBasis basis, CeedInt num_elem, CeedTransposeMode t_mode, CeedEvalMode eval_mode, CeedVector u, CeedVector v) {
+  double trace_start;
+
   CeedCheck(t_mode == CEED_TRANSPOSE, CeedBasisReturnCeed(basis), CEED_ERROR_UNSUPPORTED, "CeedBasisApplyAdd only supports CEED_TRANSPOSE");
   CeedCall(CeedBasisApplyCheckDims(basis, num_elem, t_mode, eval_mode, u, v));
   CeedCheck(basis->ApplyAdd, CeedBasisReturnCeed(basis), CEED_ERROR_UNSUPPORTED, "Backend does not implement CeedBasisApplyAdd");
+  CeedCall(CeedTraceBegin(CeedBasisReturnCeed(basis), &trace_start));
   CeedCall(basis->ApplyAdd(basis, num_elem, t_mode, eval_mode, u, v));
+  CeedCall(CeedTraceEnd(CeedBasisReturnCeed(basis), "CeedBasisApplyAdd", NULL, num_elem, trace_start));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1999,12 +2007,16 @@ int CeedBasisApplyAdd(CeedBasis basis, CeedInt num_elem, CeedTransposeMode t_mod
 **/
 int CeedBasisApplyAtPoints(CeedBasis basis, CeedInt num_elem, const CeedInt *num_points, CeedTransposeMode t_mode, CeedEvalMode eval_mode,
                            CeedVector x_ref, CeedVector u, CeedVector v) {
+  double trace_start;
+
   CeedCall(CeedBasisApplyAtPointsCheckDims(basis, num_elem, num_points, t_mode, eval_mode, x_ref, u, v));
+  CeedCall(CeedTraceBegin(CeedBasisReturnCeed(basis), &trace_start));
   if (basis->ApplyAtPoints) {
     CeedCall(basis->ApplyAtPoints(basis, num_elem, num_points, t_mode, eval_mode, x_ref, u, v));
   } else {
     CeedCall(CeedBasisApplyAtPoints_Core(basis, false, num_elem, num_points, t_mode, eval_mode, x_ref, u, v));
   }
+  CeedCall(CeedTraceEnd(CeedBasisReturnCeed(basis), "CeedBasisApplyAtPoints", NULL, num_elem, trace_start));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -2030,13 +2042,17 @@ int CeedBasisApplyAtPoints(CeedBasis basis, CeedInt num_elem, const CeedInt *num
 **/
 int CeedBasisApplyAddAtPoints(CeedBasis basis, CeedInt num_elem, const CeedInt *num_points, CeedTransposeMode t_mode, CeedEvalMode eval_mode,
                               CeedVector x_ref, CeedVector u, CeedVector v) {
+  double trace_start;
+
   CeedCheck(t_mode == CEED_TRANSPOSE, CeedBasisReturnCeed(basis), CEED_ERROR_UNSUPPORTED, "CeedBasisApplyAddAtPoints only supports CEED_TRANSPOSE");
   CeedCall(CeedBasisApplyAtPointsCheckDims(basis, num_elem, num_points, t_mode, eval_mode, x_ref, u, v));
+  CeedCall(CeedTraceBegin(CeedBasisReturnCeed(basis), &trace_start));
   if (basis->ApplyAddAtPoints) {
     CeedCall(basis->ApplyAddAtPoints(basis, num_elem, num_points, t_mode, eval_mode, x_ref, u, v));
   } else {
     CeedCall(CeedBasisApplyAtPoints_Core(basis, true, num_elem, num_points, t_mode, eval_mode, x_ref, u, v));
   }
+  CeedCall(CeedTraceEnd(CeedBasisReturnCeed(basis), "CeedBasisApplyAddAtPoints", NULL, num_elem, trace_start));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -263,6 +263,7 @@ int CeedElemRestrictionRestoreOffsets(CeedElemRestriction rstr, const CeedInt **
   if (rstr->rstr_base) {
     CeedCall(CeedElemRestrictionRestoreOffsets(rstr->rstr_base, offsets));
   } else {
+    if (rstr->RestoreOffsets) CeedCall(rstr->RestoreOffsets(rstr, offsets));
     *offsets = NULL;
     rstr->num_readers--;
   }
@@ -1313,7 +1314,14 @@ int CeedElemRestrictionApply(CeedElemRestriction rstr, CeedTransposeMode t_mode,
             "Output vector size %" CeedInt_FMT " not compatible with element restriction (%" CeedInt_FMT ", %" CeedInt_FMT ")", len, min_u_len,
             min_ru_len);
   CeedCall(CeedElemRestrictionGetNumElements(rstr, &num_elem));
-  if (num_elem > 0) CeedCall(rstr->Apply(rstr, t_mode, u, ru, request));
+  if (num_elem > 0) {
+    double trace_start;
+
+    CeedCall(CeedTraceBegin(CeedElemRestrictionReturnCeed(rstr), &trace_start));
+    CeedCall(rstr->Apply(rstr, t_mode, u, ru, request));
+    CeedCall(CeedTraceEnd(CeedElemRestrictionReturnCeed(rstr), "CeedElemRestrictionApply", NULL, t_mode == CEED_NOTRANSPOSE ? min_ru_len : min_u_len,
+                          trace_start));
+  }
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1391,6 +1399,7 @@ int CeedElemRestrictionApplyBlock(CeedElemRestriction rstr, CeedInt block, CeedT
                                   CeedRequest *request) {
   CeedSize min_u_len, min_ru_len, len;
   CeedInt  block_size, num_elem;
+  double   trace_start;
 
   CeedCheck(rstr->ApplyBlock, CeedElemRestrictionReturnCeed(rstr), CEED_ERROR_UNSUPPORTED,
             "Backend does not implement CeedElemRestrictionApplyBlock");
@@ -1423,7 +1432,10 @@ int CeedElemRestrictionApplyBlock(CeedElemRestriction rstr, CeedInt block, CeedT
   CeedCheck(block_size * block <= num_elem, CeedElemRestrictionReturnCeed(rstr), CEED_ERROR_DIMENSION,
             "Cannot retrieve block %" CeedInt_FMT ", element %" CeedInt_FMT " > total elements %" CeedInt_FMT "", block, block_size * block,
             num_elem);
+  CeedCall(CeedTraceBegin(CeedElemRestrictionReturnCeed(rstr), &trace_start));
   CeedCall(rstr->ApplyBlock(rstr, block, t_mode, u, ru, request));
+  CeedCall(CeedTraceEnd(CeedElemRestrictionReturnCeed(rstr), "CeedElemRestrictionApplyBlock", NULL,
+                        t_mode == CEED_NOTRANSPOSE ? min_ru_len : min_u_len, trace_start));
   return CEED_ERROR_SUCCESS;
 }
 
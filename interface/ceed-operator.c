@@ -12,6 +12,10 @@
 #include <stdio.h>
 #include <string.h>
 
+#ifdef CEED_USE_PTHREAD
+#include <pthread.h>
+#endif
+
 /// @file
 /// Implementation of CeedOperator interfaces
 
@@ -534,6 +538,205 @@ static int CeedOperatorContextRestoreGenericRead(CeedOperator op, CeedContextFie
   return CEED_ERROR_SUCCESS;
 }
 
+#ifdef CEED_USE_PTHREAD
+/// @cond DOXYGEN_SKIP
+typedef struct {
+  pthread_t    thread;
+  CeedOperator op;
+  CeedVector   in, out;
+  bool         is_add;
+  int          ierr;
+} CeedOperatorApplyAsync_private;
+/// @endcond
+
+/**
+  @brief Apply a `CeedOperator` on a background thread
+
+  @param[in,out] data `CeedOperatorApplyAsync_private` describing the application
+
+  @return `NULL`
+
+  @ref Developer
+**/
+static void *CeedOperatorApplyAsync_Worker(void *data) {
+  CeedOperatorApplyAsync_private *apply = data;
+
+  if (apply->is_add) apply->ierr = CeedOperatorApplyAdd(apply->op, apply->in, apply->out, CEED_REQUEST_IMMEDIATE);
+  else apply->ierr = CeedOperatorApply(apply->op, apply->in, apply->out, CEED_REQUEST_IMMEDIATE);
+  return NULL;
+}
+
+/**
+  @brief Wait for a background `CeedOperator` application to complete
+
+  @param[in] request `CeedRequest` returned by @ref CeedOperatorApplyAsync()
+
+  @return Error code of the `CeedOperator` application
+
+  @ref Developer
+**/
+static int CeedOperatorApplyAsync_Wait(CeedRequest request) {
+  int                             ierr;
+  CeedOperatorApplyAsync_private *apply = request->data;
+
+  if (pthread_join(apply->thread, NULL)) {
+    // LCOV_EXCL_START
+    ierr = CeedError(CeedOperatorReturnCeed(apply->op), CEED_ERROR_MAJOR, "Failed to join operator apply thread");
+    // LCOV_EXCL_STOP
+  } else {
+    ierr = apply->ierr;
+  }
+  // Release the references held by the request on every path
+  CeedCall(CeedVectorDestroy(&apply->in));
+  CeedCall(CeedVectorDestroy(&apply->out));
+  CeedCall(CeedOperatorDestroy(&apply->op));
+  CeedCall(CeedFree(&apply));
+  return ierr;
+}
+#endif
+
+/**
+  @brief Start a `CeedOperator` application on a background thread for a non-blocking request.
+
+  Only host backends apply operators asynchronously, and only when libCEED is built with `PTHREAD=1`.
+  Device backends already order work on their streams.
+  The caller must not use objects sharing the `Ceed` context of `op` until @ref CeedRequestWait() returns.
+  Errors are only reported by the return code of @ref CeedRequestWait(), as the error handler may run on the background thread.
+
+  @param[in]  op       `CeedOperator` to apply
+  @param[in]  in       `CeedVector` containing input state or @ref CEED_VECTOR_NONE
+  @param[out] out      `CeedVector` to store or sum in result or @ref CEED_VECTOR_NONE
+  @param[in]  is_add   Boolean flag to sum into `out` rather than overwrite
+  @param[out] request  Address of @ref CeedRequest to complete with @ref CeedRequestWait()
+  @param[out] is_async Variable to store whether the application was started on a background thread
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorApplyAsync(CeedOperator op, CeedVector in, CeedVector out, bool is_add, CeedRequest *request, bool *is_async) {
+  *is_async = false;
+#ifdef CEED_USE_PTHREAD
+  CeedMemType                     mem_type;
+  CeedOperatorApplyAsync_private *apply;
+
+  if (!request || request == CEED_REQUEST_IMMEDIATE || request == CEED_REQUEST_ORDERED) return CEED_ERROR_SUCCESS;
+  CeedCall(CeedGetPreferredMemType(CeedOperatorReturnCeed(op), &mem_type));
+  if (mem_type != CEED_MEM_HOST) return CEED_ERROR_SUCCESS;
+
+  CeedCall(CeedCalloc(1, &apply));
+  CeedCall(CeedOperatorReferenceCopy(op, &apply->op));
+  CeedCall(CeedVectorReferenceCopy(in, &apply->in));
+  CeedCall(CeedVectorReferenceCopy(out, &apply->out));
+  apply->is_add = is_add;
+  if (pthread_create(&apply->thread, NULL, CeedOperatorApplyAsync_Worker, apply)) {
+    // LCOV_EXCL_START
+    CeedCall(CeedVectorDestroy(&apply->in));
+    CeedCall(CeedVectorDestroy(&apply->out));
+    CeedCall(CeedOperatorDestroy(&apply->op));
+    CeedCall(CeedFree(&apply));
+    return CEED_ERROR_SUCCESS;
+    // LCOV_EXCL_STOP
+  }
+  CeedCall(CeedCalloc(1, request));
+  (*request)->data = apply;
+  (*request)->Wait = CeedOperatorApplyAsync_Wait;
+  *is_async        = true;
+#endif
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Estimate bytes moved and FLOPs of each phase of one application of a non-composite `CeedOperator`.
+
+  Restrictions and bases of all fields are counted, including passive inputs that backends may skip restricting when unchanged.
+  Estimates are zero for operators at points.
+
+  @param[in,out] op `CeedOperator` to estimate for
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorSetupProfileEstimates(CeedOperator op) {
+  bool                      is_at_points;
+  CeedInt                   num_elem, num_qpts, num_input_fields, num_output_fields;
+  CeedQFunction             qf;
+  CeedQFunctionField       *qf_input_fields, *qf_output_fields;
+  CeedOperatorField        *op_input_fields, *op_output_fields;
+  CeedOperatorPhaseProfile *profile = op->profile;
+
+  op->has_profile_estimates = true;
+  CeedCall(CeedOperatorIsAtPoints(op, &is_at_points));
+  CeedCall(CeedOperatorGetNumElements(op, &num_elem));
+  if (is_at_points || num_elem == 0) return CEED_ERROR_SUCCESS;
+  CeedCall(CeedOperatorGetNumQuadraturePoints(op, &num_qpts));
+  CeedCall(CeedOperatorGetQFunction(op, &qf));
+  CeedCall(CeedQFunctionGetFields(qf, &num_input_fields, &qf_input_fields, &num_output_fields, &qf_output_fields));
+  CeedCall(CeedOperatorGetFields(op, NULL, &op_input_fields, NULL, &op_output_fields));
+
+  // QFunction FLOPs, if the user provided an estimate
+  {
+    CeedSize qf_flops;
+
+    CeedCall(CeedQFunctionGetFlopsEstimate(qf, &qf_flops));
+    if (qf_flops > 0) profile[CEED_OPERATOR_PHASE_QFUNCTION].flops_per_call = qf_flops * num_elem * num_qpts;
+  }
+  CeedCall(CeedQFunctionDestroy(&qf));
+
+  for (CeedInt i = 0; i < num_input_fields + num_output_fields; i++) {
+    const bool                is_input = i < num_input_fields;
+    const CeedTransposeMode   t_mode   = is_input ? CEED_NOTRANSPOSE : CEED_TRANSPOSE;
+    CeedInt                   size;
+    CeedSize                  e_size = 0;
+    CeedEvalMode              eval_mode;
+    CeedElemRestriction       rstr;
+    CeedBasis                 basis;
+    CeedQFunctionField        qf_field      = is_input ? qf_input_fields[i] : qf_output_fields[i - num_input_fields];
+    CeedOperatorField         op_field      = is_input ? op_input_fields[i] : op_output_fields[i - num_input_fields];
+    CeedOperatorPhaseProfile *rstr_profile  = &profile[is_input ? CEED_OPERATOR_PHASE_INPUT_RESTRICTION : CEED_OPERATOR_PHASE_OUTPUT_RESTRICTION];
+    CeedOperatorPhaseProfile *basis_profile = &profile[is_input ? CEED_OPERATOR_PHASE_INPUT_BASIS : CEED_OPERATOR_PHASE_OUTPUT_BASIS];
+
+    CeedCall(CeedQFunctionFieldGetEvalMode(qf_field, &eval_mode));
+    CeedCall(CeedQFunctionFieldGetSize(qf_field, &size));
+    CeedCall(CeedOperatorFieldGetElemRestriction(op_field, &rstr));
+    CeedCall(CeedOperatorFieldGetBasis(op_field, &basis));
+
+    // Restriction, reading and writing each E-vector entry, and reading the L-vector entry again when summing into it
+    if (rstr != CEED_ELEMRESTRICTION_NONE && eval_mode != CEED_EVAL_WEIGHT) {
+      CeedSize            rstr_flops;
+      CeedRestrictionType rstr_type;
+
+      CeedCall(CeedElemRestrictionGetEVectorSize(rstr, &e_size));
+      CeedCall(CeedElemRestrictionGetType(rstr, &rstr_type));
+      CeedCall(CeedElemRestrictionGetFlopsEstimate(rstr, t_mode, &rstr_flops));
+      rstr_profile->bytes_per_call += (is_input ? 2 : 3) * e_size * (CeedSize)sizeof(CeedScalar);
+      if (rstr_type != CEED_RESTRICTION_STRIDED) {
+        CeedInt num_comp;
+
+        CeedCall(CeedElemRestrictionGetNumComponents(rstr, &num_comp));
+        rstr_profile->bytes_per_call += e_size / num_comp * (CeedSize)sizeof(CeedInt);
+      }
+      rstr_profile->flops_per_call += rstr_flops;
+    }
+
+    // Basis, reading the E-vector and writing the Q-vector, or the reverse
+    if (basis != CEED_BASIS_NONE && eval_mode != CEED_EVAL_NONE) {
+      CeedSize basis_flops;
+
+      CeedCall(CeedBasisGetFlopsEstimate(basis, t_mode, eval_mode, false, 0, &basis_flops));
+      basis_profile->bytes_per_call += (e_size + (CeedSize)num_elem * num_qpts * size) * (CeedSize)sizeof(CeedScalar);
+      basis_profile->flops_per_call += basis_flops * num_elem;
+    }
+
+    // QFunction, reading inputs and writing outputs at quadrature points
+    profile[CEED_OPERATOR_PHASE_QFUNCTION].bytes_per_call += (CeedSize)num_elem * num_qpts * size * (CeedSize)sizeof(CeedScalar);
+    CeedCall(CeedElemRestrictionDestroy(&rstr));
+    CeedCall(CeedBasisDestroy(&basis));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -727,6 +930,70 @@ int CeedOperatorSetSetupDone(CeedOperator op) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get the profiling status of a `CeedOperator`
+
+  @param[in]  op           `CeedOperator`
+  @param[out] is_profiling Variable to store profiling status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorIsProfiling(CeedOperator op, bool *is_profiling) {
+  *is_profiling = op->is_profiling;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Add the wall time elapsed since `time` to `phase_time` and set `time` to the current wall time
+
+  @param[in,out] time       Wall time in seconds of the previous lap
+  @param[in,out] phase_time Time to add the elapsed time to, or `NULL` to only set `time`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorProfileLap(double *time, double *phase_time) {
+  double now;
+
+  CeedCall(CeedGetWallTime(&now));
+  if (phase_time) *phase_time += now - *time;
+  *time = now;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Add the phase times of one application to the profile of a `CeedOperator`.
+
+  For non-composite operators, this also counts the call and adds the estimated bytes moved and FLOPs of each phase.
+  For composite operators, only the times are added, such as for restrictions the backend shares between suboperators.
+
+  @param[in,out] op          `CeedOperator`
+  @param[in]     phase_times Wall time in seconds of each @ref CeedOperatorPhase
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorAddProfile(CeedOperator op, const double *phase_times) {
+  bool is_composite;
+
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  if (!is_composite && !op->has_profile_estimates) CeedCall(CeedOperatorSetupProfileEstimates(op));
+  for (CeedInt p = 0; p < CEED_OPERATOR_NUM_PHASES; p++) {
+    CeedOperatorPhaseProfile *profile = &op->profile[p];
+
+    profile->time += phase_times[p];
+    if (is_composite) continue;
+    profile->num_calls++;
+    profile->bytes += profile->bytes_per_call;
+    profile->flops += profile->flops_per_call;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -1816,6 +2083,182 @@ int CeedOperatorGetFlopsEstimate(CeedOperator op, CeedSize *flops) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Enable or disable profiling of the phases of `CeedOperator` applications.
+
+  Backends that support profiling accumulate the wall time of each @ref CeedOperatorPhase.
+  The interface counts calls and adds estimates of the bytes moved and FLOPs.
+  For composite operators, profiling is set on all current suboperators.
+
+  @param[in,out] op           `CeedOperator`
+  @param[in]     is_profiling Boolean flag to enable profiling
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorSetProfiling(CeedOperator op, bool is_profiling) {
+  bool is_composite;
+
+  op->is_profiling = is_profiling;
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  if (is_composite) {
+    CeedInt       num_suboperators;
+    CeedOperator *sub_operators;
+
+    CeedCall(CeedCompositeOperatorGetNumSub(op, &num_suboperators));
+    CeedCall(CeedCompositeOperatorGetSubList(op, &sub_operators));
+    for (CeedInt i = 0; i < num_suboperators; i++) CeedCall(CeedOperatorSetProfiling(sub_operators[i], is_profiling));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the accumulated profile of a phase of `CeedOperator` applications.
+
+  Bytes and FLOPs are estimates from the sizes of the restrictions, bases, and @ref CeedQFunction fields.
+  Achieved bandwidth and FLOP rates are `bytes / time` and `flops / time`.
+  The @ref CeedQFunction FLOPs are only counted if set with @ref CeedQFunctionSetUserFlopsEstimate().
+  For composite operators, the profiles of the suboperators are summed, along with any time the backend spends on work shared between suboperators.
+  Profiles for individual suboperators can be read from the suboperators.
+
+  Note: Any of the output arguments may be `NULL`.
+
+  @param[in]  op        `CeedOperator`
+  @param[in]  phase     @ref CeedOperatorPhase to get the profile of
+  @param[out] num_calls Variable to store number of profiled applications
+  @param[out] time      Variable to store accumulated wall time in seconds
+  @param[out] bytes     Variable to store estimated bytes moved
+  @param[out] flops     Variable to store estimated FLOPs
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorGetProfile(CeedOperator op, CeedOperatorPhase phase, CeedSize *num_calls, double *time, CeedSize *bytes, CeedSize *flops) {
+  bool     is_composite;
+  CeedSize total_num_calls, total_bytes, total_flops;
+  double   total_time;
+
+  CeedCheck(phase >= 0 && phase < CEED_OPERATOR_NUM_PHASES, CeedOperatorReturnCeed(op), CEED_ERROR_MINOR, "Invalid CeedOperator phase: %d",
+            phase);
+  total_num_calls = op->profile[phase].num_calls;
+  total_time      = op->profile[phase].time;
+  total_bytes     = op->profile[phase].bytes;
+  total_flops     = op->profile[phase].flops;
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  if (is_composite) {
+    CeedInt       num_suboperators;
+    CeedOperator *sub_operators;
+
+    CeedCall(CeedCompositeOperatorGetNumSub(op, &num_suboperators));
+    CeedCall(CeedCompositeOperatorGetSubList(op, &sub_operators));
+    for (CeedInt i = 0; i < num_suboperators; i++) {
+      CeedSize sub_num_calls, sub_bytes, sub_flops;
+      double   sub_time;
+
+      CeedCall(CeedOperatorGetProfile(sub_operators[i], phase, &sub_num_calls, &sub_time, &sub_bytes, &sub_flops));
+      total_num_calls += sub_num_calls;
+      total_time += sub_time;
+      total_bytes += sub_bytes;
+      total_flops += sub_flops;
+    }
+  }
+  if (num_calls) *num_calls = total_num_calls;
+  if (time) *time = total_time;
+  if (bytes) *bytes = total_bytes;
+  if (flops) *flops = total_flops;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Reset the accumulated profile of a `CeedOperator`, and of its suboperators for composite operators
+
+  @param[in,out] op `CeedOperator`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorResetProfile(CeedOperator op) {
+  bool is_composite;
+
+  for (CeedInt p = 0; p < CEED_OPERATOR_NUM_PHASES; p++) {
+    op->profile[p].num_calls = 0;
+    op->profile[p].time      = 0.0;
+    op->profile[p].bytes     = 0;
+    op->profile[p].flops     = 0;
+  }
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  if (is_composite) {
+    CeedInt       num_suboperators;
+    CeedOperator *sub_operators;
+
+    CeedCall(CeedCompositeOperatorGetNumSub(op, &num_suboperators));
+    CeedCall(CeedCompositeOperatorGetSubList(op, &sub_operators));
+    for (CeedInt i = 0; i < num_suboperators; i++) CeedCall(CeedOperatorResetProfile(sub_operators[i]));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief View the profile of each phase of a `CeedOperator`
+
+  @param[in] op     `CeedOperator`
+  @param[in] indent Number of leading spaces
+  @param[in] stream Stream to write
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorViewProfile_Core(CeedOperator op, CeedInt indent, FILE *stream) {
+  fprintf(stream, "%*s%-20s %10s %12s %12s %10s %12s %10s\n", indent, "", "Phase", "Calls", "Time (s)", "GB", "GB/s", "GFLOP", "GFLOP/s");
+  for (CeedInt p = 0; p < CEED_OPERATOR_NUM_PHASES; p++) {
+    CeedSize num_calls, bytes, flops;
+    double   time;
+
+    CeedCall(CeedOperatorGetProfile(op, (CeedOperatorPhase)p, &num_calls, &time, &bytes, &flops));
+    fprintf(stream, "%*s%-20s %10" CeedSize_FMT " %12.6g %12.6g %10.4g %12.6g %10.4g\n", indent, "", CeedOperatorPhases[p], num_calls, time,
+            1e-9 * bytes, time > 0 ? 1e-9 * bytes / time : 0.0, 1e-9 * flops, time > 0 ? 1e-9 * flops / time : 0.0);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief View the accumulated profile of a `CeedOperator`, with achieved bandwidth and FLOP rates for each phase.
+
+  For composite operators, the summed profile is followed by the profile of each suboperator.
+
+  @param[in] op     `CeedOperator` to view profile of
+  @param[in] stream Stream to write; typically `stdout` or a file
+
+  @return Error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorViewProfile(CeedOperator op, FILE *stream) {
+  bool is_composite;
+
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  fprintf(stream, "%sCeedOperator%s%s profile\n", is_composite ? "Composite " : "", op->name ? " - " : "", op->name ? op->name : "");
+  CeedCall(CeedOperatorViewProfile_Core(op, 2, stream));
+  if (is_composite) {
+    CeedInt       num_suboperators;
+    CeedOperator *sub_operators;
+
+    CeedCall(CeedCompositeOperatorGetNumSub(op, &num_suboperators));
+    CeedCall(CeedCompositeOperatorGetSubList(op, &sub_operators));
+    for (CeedInt i = 0; i < num_suboperators; i++) {
+      const char *name = sub_operators[i]->name;
+
+      fprintf(stream, "  SubOperator %" CeedInt_FMT "%s%s profile\n", i, name ? " - " : "", name ? name : "");
+      CeedCall(CeedOperatorViewProfile_Core(sub_operators[i], 4, stream));
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get `CeedQFunction` global context for a `CeedOperator`.
 
@@ -2118,6 +2561,12 @@ int CeedOperatorRestoreContextBooleanRead(CeedOperator op, CeedContextFieldLabel
 
   Note: Calling this function asserts that setup is complete and sets the `CeedOperator` as immutable.
 
+  Note: With a user `request` on a host backend, the operator is applied on a background thread until @ref CeedRequestWait() is called.
+        This requires libCEED built with `PTHREAD=1`, otherwise the operator is applied before returning.
+        Work that does not use libCEED objects, such as posting MPI messages, may overlap with the application.
+        Errors in the application are only reported by the return code of @ref CeedRequestWait().
+        The error handler may run on the background thread, so the stored error message must not be read before the wait.
+
   @param[in]  op      `CeedOperator` to apply
   @param[in]  in      `CeedVector` containing input state or @ref CEED_VECTOR_NONE if there are no active inputs
   @param[out] out     `CeedVector` to store result of applying operator (must be distinct from `in`) or @ref CEED_VECTOR_NONE if there are no active outputs
@@ -2128,10 +2577,14 @@ int CeedOperatorRestoreContextBooleanRead(CeedOperator op, CeedContextFieldLabel
   @ref User
 **/
 int CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request) {
-  bool is_composite;
+  bool   is_async, is_composite;
+  double trace_start;
 
   CeedCall(CeedOperatorCheckReady(op));
+  CeedCall(CeedOperatorApplyAsync(op, in, out, false, request, &is_async));
+  if (is_async) return CEED_ERROR_SUCCESS;
 
+  CeedCall(CeedTraceBegin(CeedOperatorReturnCeed(op), &trace_start));
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
   if (is_composite) {
     // Composite Operator
@@ -2188,6 +2641,7 @@ int CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out, CeedReques
       if (op->num_elem > 0) CeedCall(op->ApplyAdd(op, in, out, request));
     }
   }
+  CeedCall(CeedTraceEnd(CeedOperatorReturnCeed(op), "CeedOperatorApply", op->name, op->num_elem, trace_start));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -2197,6 +2651,11 @@ int CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out, CeedReques
   This computes the action of the operator on the specified (active) input, yielding its (active) output.
   All inputs and outputs must be specified using @ref CeedOperatorSetField().
 
+  Note: With a user `request` on a host backend, the operator is applied on a background thread until @ref CeedRequestWait() is called.
+        This requires libCEED built with `PTHREAD=1`, otherwise the operator is applied before returning.
+        Errors in the application are only reported by the return code of @ref CeedRequestWait().
+        The error handler may run on the background thread, so the stored error message must not be read before the wait.
+
   @param[in]  op      `CeedOperator` to apply
   @param[in]  in      `CeedVector` containing input state or @ref CEED_VECTOR_NONE if there are no active inputs
   @param[out] out     `CeedVector` to sum in result of applying operator (must be distinct from `in`) or @ref CEED_VECTOR_NONE if there are no active outputs
@@ -2207,10 +2666,14 @@ int CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out, CeedReques
   @ref User
 **/
 int CeedOperatorApplyAdd(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request) {
-  bool is_composite;
+  bool   is_async, is_composite;
+  double trace_start;
 
   CeedCall(CeedOperatorCheckReady(op));
+  CeedCall(CeedOperatorApplyAsync(op, in, out, true, request, &is_async));
+  if (is_async) return CEED_ERROR_SUCCESS;
 
+  CeedCall(CeedTraceBegin(CeedOperatorReturnCeed(op), &trace_start));
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
   if (is_composite) {
     // Composite Operator
@@ -2230,6 +2693,7 @@ int CeedOperatorApplyAdd(CeedOperator op, CeedVector in, CeedVector out, CeedReq
     // Standard Operator
     CeedCall(op->ApplyAdd(op, in, out, request));
   }
+  CeedCall(CeedTraceEnd(CeedOperatorReturnCeed(op), "CeedOperatorApplyAdd", op->name, op->num_elem, trace_start));
   return CEED_ERROR_SUCCESS;
 }
 
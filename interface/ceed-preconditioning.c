@@ -204,7 +204,362 @@ static int CeedOperatorCreateFallback(CeedOperator op) {
 }
 
 /**
-  @brief Core logic for assembling operator diagonal or point block diagonal
+  @brief Assemble the linearized `CeedQFunction` for a non-composite `CeedOperator`, storing only the entries given by the symmetry and zero block
+           hints of the `CeedQFunction`.
+
+  Entry `i` of the assembled `CeedQFunction` matrix for quadrature point `q` of element `e` is stored at
+  `q * layout[0] + entry_map[i] * layout[1] + e * layout[2]`, see @ref CeedOperatorAssemblyDataGetQFunctionEntries().
+  If the `CeedQFunction` has no hints, this is @ref CeedOperatorLinearAssembleQFunctionBuildOrUpdate() with `entry_map` set to `NULL`.
+  Otherwise, the full assembled `CeedQFunction` data is not retained, and the stored entries are only retained if assembly data reuse is requested.
+
+  @param[in]  op        `CeedOperator` to assemble `CeedQFunction`
+  @param[in]  request   Address of @ref CeedRequest for non-blocking completion, else @ref CEED_REQUEST_IMMEDIATE
+  @param[out] assembled `CeedVector` to store assembled `CeedQFunction` entries
+  @param[out] layout    E-vector layout of assembled `CeedQFunction` entries
+  @param[out] entry_map Map from assembled `CeedQFunction` matrix entries to stored entries, or `NULL` if all entries are stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedSingleOperatorLinearAssembleQFunctionCompressed(CeedOperator op, CeedRequest *request, CeedVector *assembled, CeedInt layout[3],
+                                                               const CeedInt **entry_map) {
+  CeedInt                   num_elem, num_qpts, num_input_components, num_entries;
+  CeedSize                  num_output_components;
+  CeedScalar               *assembled_array;
+  CeedOperatorAssemblyData  data;
+  CeedQFunctionAssemblyData qf_data;
+
+  CeedCall(CeedOperatorGetOperatorAssemblyData(op, &data));
+  CeedCall(CeedOperatorAssemblyDataGetQFunctionEntries(data, &num_input_components, &num_entries, entry_map));
+  if (!*entry_map) {
+    CeedElemRestriction assembled_elem_rstr = NULL;
+
+    CeedCall(CeedOperatorLinearAssembleQFunctionBuildOrUpdate(op, assembled, &assembled_elem_rstr, request));
+    CeedCall(CeedElemRestrictionGetELayout(assembled_elem_rstr, layout));
+    CeedCall(CeedElemRestrictionDestroy(&assembled_elem_rstr));
+    return CEED_ERROR_SUCCESS;
+  }
+  CeedCall(CeedOperatorAssemblyDataGetEvalModes(data, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &num_output_components));
+  CeedCall(CeedOperatorGetNumElements(op, &num_elem));
+  CeedCall(CeedOperatorGetNumQuadraturePoints(op, &num_qpts));
+  layout[0] = 1;
+  layout[1] = num_qpts;
+  layout[2] = num_qpts * num_entries;
+
+  // Reuse stored entries, if allowed
+  CeedCall(CeedOperatorGetQFunctionAssemblyData(op, &qf_data));
+  if (qf_data->reuse_data && qf_data->vec_compressed && !qf_data->needs_compressed_update) {
+    CeedCall(CeedVectorReferenceCopy(qf_data->vec_compressed, assembled));
+    return CEED_ERROR_SUCCESS;
+  }
+  if (qf_data->vec_compressed) CeedCall(CeedVectorReferenceCopy(qf_data->vec_compressed, assembled));
+  else CeedCall(CeedVectorCreate(CeedOperatorReturnCeed(op), (CeedSize)num_elem * layout[2], assembled));
+  CeedCall(CeedVectorGetArrayWrite(*assembled, CEED_MEM_HOST, &assembled_array));
+
+  {
+    const CeedInt       chunk_size = op->LinearAssembleQFunctionElements ? CeedIntMin(num_elem, 256) : num_elem;
+    const CeedInt       num_full   = num_input_components * num_output_components;
+    CeedInt             layout_full[3];
+    const CeedScalar   *full_array;
+    CeedVector          assembled_full      = NULL;
+    CeedElemRestriction assembled_full_rstr = NULL;
+
+    if (op->LinearAssembleQFunctionElements) {
+      // Assemble full CeedQFunction data in chunks of elements
+      layout_full[0] = 1;
+      layout_full[1] = num_qpts;
+      layout_full[2] = num_qpts * num_full;
+      CeedCall(CeedVectorCreate(CeedOperatorReturnCeed(op), (CeedSize)chunk_size * layout_full[2], &assembled_full));
+    } else {
+      CeedCall(CeedOperatorLinearAssembleQFunction(op, &assembled_full, &assembled_full_rstr, request));
+      CeedCall(CeedElemRestrictionGetELayout(assembled_full_rstr, layout_full));
+      CeedCall(CeedElemRestrictionDestroy(&assembled_full_rstr));
+    }
+    for (CeedInt e_start = 0; e_start < num_elem; e_start += chunk_size) {
+      const CeedInt num_elem_chunk = CeedIntMin(chunk_size, num_elem - e_start);
+      const CeedInt e_offset       = op->LinearAssembleQFunctionElements ? e_start : 0;
+
+      if (op->LinearAssembleQFunctionElements) CeedCall(op->LinearAssembleQFunctionElements(op, e_start, num_elem_chunk, assembled_full, request));
+      CeedCall(CeedVectorGetArrayRead(assembled_full, CEED_MEM_HOST, &full_array));
+      for (CeedSize e = e_start; e < e_start + num_elem_chunk; e++) {
+        for (CeedInt i = 0; i < num_full; i++) {
+          if ((*entry_map)[i] < 0) continue;
+          for (CeedInt q = 0; q < num_qpts; q++) {
+            assembled_array[q * layout[0] + (*entry_map)[i] * layout[1] + e * layout[2]] =
+                full_array[q * layout_full[0] + i * layout_full[1] + (e - e_offset) * layout_full[2]];
+          }
+        }
+      }
+      CeedCall(CeedVectorRestoreArrayRead(assembled_full, &full_array));
+    }
+    CeedCall(CeedVectorDestroy(&assembled_full));
+  }
+  CeedCall(CeedVectorRestoreArray(*assembled, &assembled_array));
+
+  // Retain stored entries for reuse
+  if (qf_data->reuse_data) {
+    CeedCall(CeedVectorReferenceCopy(*assembled, &qf_data->vec_compressed));
+    qf_data->needs_compressed_update = false;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Assemble element diagonals or point block diagonals for a range of elements of a non-composite `CeedOperator`.
+
+  The diagonal of \f$B^T D B\f$ is formed directly from the basis matrices, one element at a time.
+
+  @param[in]  basis_in              Active input basis
+  @param[in]  basis_out             Active output basis
+  @param[in]  num_elem              Number of elements in range
+  @param[in]  num_comp              Number of active components
+  @param[in]  is_point_block        Boolean flag to assemble diagonal or point block diagonal
+  @param[in]  num_eval_modes_in     Number of active input evaluation modes
+  @param[in]  eval_modes_in         Active input evaluation modes
+  @param[in]  eval_mode_offsets_in  Offsets of active input evaluation modes in assembled `CeedQFunction` data
+  @param[in]  num_eval_modes_out    Number of active output evaluation modes
+  @param[in]  eval_modes_out        Active output evaluation modes
+  @param[in]  eval_mode_offsets_out Offsets of active output evaluation modes in assembled `CeedQFunction` data
+  @param[in]  num_output_components Number of columns in the assembled `CeedQFunction` matrix at each quadrature point
+  @param[in]  identity              Identity matrix for @ref CEED_EVAL_NONE, or `NULL`
+  @param[in]  entry_map             Map from assembled `CeedQFunction` matrix entries to stored entries, or `NULL` if all entries are stored
+  @param[in]  layout_qf             E-vector layout of assembled `CeedQFunction` data
+  @param[in]  assembled_qf_array    Assembled `CeedQFunction` data, starting at the first element in range
+  @param[out] elem_diag_array       Array to add element diagonals to, starting at the first element in range
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedSingleOperatorAssembleDiagonalElements(CeedBasis basis_in, CeedBasis basis_out, CeedInt num_elem, CeedInt num_comp,
+                                                      bool is_point_block, CeedInt num_eval_modes_in, const CeedEvalMode *eval_modes_in,
+                                                      const CeedSize *eval_mode_offsets_in, CeedInt num_eval_modes_out,
+                                                      const CeedEvalMode *eval_modes_out, const CeedSize *eval_mode_offsets_out,
+                                                      CeedSize num_output_components, const CeedScalar *identity, const CeedInt *entry_map,
+                                                      const CeedInt layout_qf[3], const CeedScalar *assembled_qf_array, CeedScalar *elem_diag_array) {
+  CeedInt num_nodes, num_qpts;
+
+  CeedCall(CeedBasisGetNumNodes(basis_in, &num_nodes));
+  if (basis_in == CEED_BASIS_NONE) num_qpts = num_nodes;
+  else CeedCall(CeedBasisGetNumQuadraturePoints(basis_in, &num_qpts));
+
+  // Compute the diagonal of B^T D B
+  // Each element
+  for (CeedSize e = 0; e < num_elem; e++) {
+    // Each basis eval mode pair
+    CeedInt      d_out              = 0, q_comp_out;
+    CeedEvalMode eval_mode_out_prev = CEED_EVAL_NONE;
+
+    for (CeedInt e_out = 0; e_out < num_eval_modes_out; e_out++) {
+      CeedInt           d_in              = 0, q_comp_in;
+      const CeedScalar *B_t               = NULL;
+      CeedEvalMode      eval_mode_in_prev = CEED_EVAL_NONE;
+
+      CeedCall(CeedOperatorGetBasisPointer(basis_out, eval_modes_out[e_out], identity, &B_t));
+      CeedCall(CeedBasisGetNumQuadratureComponents(basis_out, eval_modes_out[e_out], &q_comp_out));
+      if (q_comp_out > 1) {
+        if (e_out == 0 || eval_modes_out[e_out] != eval_mode_out_prev) d_out = 0;
+        else B_t = &B_t[(++d_out) * num_qpts * num_nodes];
+      }
+      eval_mode_out_prev = eval_modes_out[e_out];
+
+      for (CeedInt e_in = 0; e_in < num_eval_modes_in; e_in++) {
+        const CeedScalar *B = NULL;
+
+        CeedCall(CeedOperatorGetBasisPointer(basis_in, eval_modes_in[e_in], identity, &B));
+        CeedCall(CeedBasisGetNumQuadratureComponents(basis_in, eval_modes_in[e_in], &q_comp_in));
+        if (q_comp_in > 1) {
+          if (e_in == 0 || eval_modes_in[e_in] != eval_mode_in_prev) d_in = 0;
+          else B = &B[(++d_in) * num_qpts * num_nodes];
+        }
+        eval_mode_in_prev = eval_modes_in[e_in];
+
+        // Each component
+        for (CeedInt c_out = 0; c_out < num_comp; c_out++) {
+          // Each qpt/node pair
+          for (CeedInt q = 0; q < num_qpts; q++) {
+            if (is_point_block) {
+              // Point Block Diagonal
+              for (CeedInt c_in = 0; c_in < num_comp; c_in++) {
+                const CeedSize c_offset = (eval_mode_offsets_in[e_in] + c_in) * num_output_components + eval_mode_offsets_out[e_out] + c_out;
+                const CeedSize qf_entry = entry_map ? entry_map[c_offset] : c_offset;
+
+                if (qf_entry < 0) continue;
+                const CeedScalar qf_value = assembled_qf_array[q * layout_qf[0] + qf_entry * layout_qf[1] + e * layout_qf[2]];
+
+                for (CeedInt n = 0; n < num_nodes; n++) {
+                  elem_diag_array[((e * num_comp + c_out) * num_comp + c_in) * num_nodes + n] +=
+                      B_t[q * num_nodes + n] * qf_value * B[q * num_nodes + n];
+                }
+              }
+            } else {
+              // Diagonal Only
+              const CeedSize c_offset = (eval_mode_offsets_in[e_in] + c_out) * num_output_components + eval_mode_offsets_out[e_out] + c_out;
+              const CeedSize qf_entry = entry_map ? entry_map[c_offset] : c_offset;
+
+              if (qf_entry < 0) continue;
+              const CeedScalar qf_value = assembled_qf_array[q * layout_qf[0] + qf_entry * layout_qf[1] + e * layout_qf[2]];
+
+              for (CeedInt n = 0; n < num_nodes; n++) {
+                elem_diag_array[(e * num_comp + c_out) * num_nodes + n] += B_t[q * num_nodes + n] * qf_value * B[q * num_nodes + n];
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Assemble element diagonals or point block diagonals for a range of elements of a non-composite `CeedOperator` with a tensor product active
+           basis using sum factorization.
+
+  The diagonal of \f$B^T D B\f$ only needs the pointwise products of the 1D output and input basis matrices, so the assembled `CeedQFunction` data is
+  contracted with these products one dimension at a time, costing \f$O(P^d Q)\f$ rather than \f$O(P^d Q^d)\f$ per element.
+  Blocks of elements are processed together, with the element index fastest so the inner loops vectorize.
+
+  @param[in]  basis                 Active tensor product basis
+  @param[in]  num_elem              Number of elements in range
+  @param[in]  num_comp              Number of active components
+  @param[in]  is_point_block        Boolean flag to assemble diagonal or point block diagonal
+  @param[in]  num_eval_modes_in     Number of active input evaluation modes
+  @param[in]  eval_modes_in         Active input evaluation modes, @ref CEED_EVAL_INTERP or @ref CEED_EVAL_GRAD
+  @param[in]  eval_mode_offsets_in  Offsets of active input evaluation modes in assembled `CeedQFunction` data
+  @param[in]  num_eval_modes_out    Number of active output evaluation modes
+  @param[in]  eval_modes_out        Active output evaluation modes, @ref CEED_EVAL_INTERP or @ref CEED_EVAL_GRAD
+  @param[in]  eval_mode_offsets_out Offsets of active output evaluation modes in assembled `CeedQFunction` data
+  @param[in]  num_output_components Number of columns in the assembled `CeedQFunction` matrix at each quadrature point
+  @param[in]  entry_map             Map from assembled `CeedQFunction` matrix entries to stored entries, or `NULL` if all entries are stored
+  @param[in]  layout_qf             E-vector layout of assembled `CeedQFunction` data
+  @param[in]  assembled_qf_array    Assembled `CeedQFunction` data, starting at the first element in range
+  @param[out] elem_diag_array       Array to add element diagonals to, starting at the first element in range
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedSingleOperatorAssembleDiagonalTensor(CeedBasis basis, CeedInt num_elem, CeedInt num_comp, bool is_point_block,
+                                                    CeedInt num_eval_modes_in, const CeedEvalMode *eval_modes_in,
+                                                    const CeedSize *eval_mode_offsets_in, CeedInt num_eval_modes_out,
+                                                    const CeedEvalMode *eval_modes_out, const CeedSize *eval_mode_offsets_out,
+                                                    CeedSize num_output_components, const CeedInt *entry_map, const CeedInt layout_qf[3],
+                                                    const CeedScalar *assembled_qf_array, CeedScalar *elem_diag_array) {
+  const CeedInt     block_size = 8, num_comp_in = is_point_block ? num_comp : 1;
+  CeedInt           dim, P, Q, num_qpts, num_nodes, tmp_size;
+  const CeedScalar *interp_1d, *grad_1d;
+  CeedScalar       *W[3][3], *diag, *tmp[2];
+
+  CeedCall(CeedBasisGetDimension(basis, &dim));
+  CeedCall(CeedBasisGetNumNodes1D(basis, &P));
+  CeedCall(CeedBasisGetNumQuadraturePoints1D(basis, &Q));
+  CeedCall(CeedBasisGetInterp1D(basis, &interp_1d));
+  CeedCall(CeedBasisGetGrad1D(basis, &grad_1d));
+  num_qpts  = CeedIntPow(Q, dim);
+  num_nodes = CeedIntPow(P, dim);
+
+  // Pointwise products of output and input 1D factors, indexed [output factor][input factor] with interp = 0, grad = 1
+  for (CeedInt i = 0; i < 2; i++) {
+    for (CeedInt j = 0; j < 2; j++) {
+      const CeedScalar *B_out = i ? grad_1d : interp_1d, *B_in = j ? grad_1d : interp_1d;
+
+      CeedCall(CeedCalloc(Q * P, &W[i][j]));
+      for (CeedInt k = 0; k < Q * P; k++) W[i][j][k] = B_out[k] * B_in[k];
+    }
+  }
+
+  // Derivative direction of each evaluation mode, or -1 for interpolation; each gradient field contributes dim consecutive evaluation modes
+  CeedInt grad_dim_in[num_eval_modes_in], grad_dim_out[num_eval_modes_out];
+
+  for (CeedInt e_in = 0, grad_dim = 0; e_in < num_eval_modes_in; e_in++) {
+    grad_dim_in[e_in] = eval_modes_in[e_in] == CEED_EVAL_GRAD ? grad_dim : -1;
+    if (eval_modes_in[e_in] == CEED_EVAL_GRAD) grad_dim = (grad_dim + 1) % dim;
+  }
+  for (CeedInt e_out = 0, grad_dim = 0; e_out < num_eval_modes_out; e_out++) {
+    grad_dim_out[e_out] = eval_modes_out[e_out] == CEED_EVAL_GRAD ? grad_dim : -1;
+    if (eval_modes_out[e_out] == CEED_EVAL_GRAD) grad_dim = (grad_dim + 1) % dim;
+  }
+
+  // Work arrays, ordered [remaining qpts][nodes][elem in block]
+  tmp_size = num_qpts * block_size;
+  for (CeedInt d = 0; d < dim; d++) tmp_size = CeedIntMax(tmp_size, CeedIntPow(Q, dim - d - 1) * CeedIntPow(P, d + 1) * block_size);
+  CeedCall(CeedCalloc(num_nodes * block_size, &diag));
+  CeedCall(CeedCalloc(tmp_size, &tmp[0]));
+  CeedCall(CeedCalloc(tmp_size, &tmp[1]));
+
+  for (CeedInt e_start = 0; e_start < num_elem; e_start += block_size) {
+    const CeedInt num_elem_block = CeedIntMin(block_size, num_elem - e_start);
+
+    for (CeedInt c_out = 0; c_out < num_comp; c_out++) {
+      for (CeedInt i = 0; i < num_comp_in; i++) {
+        const CeedInt c_in = is_point_block ? i : c_out;
+
+        for (CeedInt k = 0; k < num_nodes * block_size; k++) diag[k] = 0.0;
+        for (CeedInt e_in = 0; e_in < num_eval_modes_in; e_in++) {
+          for (CeedInt e_out = 0; e_out < num_eval_modes_out; e_out++) {
+            const CeedSize c_offset = (eval_mode_offsets_in[e_in] + c_in) * num_output_components + eval_mode_offsets_out[e_out] + c_out;
+            const CeedSize qf_entry = entry_map ? entry_map[c_offset] : c_offset;
+
+            if (qf_entry < 0) continue;
+            // Gather pointwise D for the block, padding elements are zero
+            for (CeedInt q = 0; q < num_qpts; q++) {
+              for (CeedInt b = 0; b < block_size; b++) {
+                tmp[1][q * block_size + b] =
+                    b < num_elem_block ? assembled_qf_array[q * layout_qf[0] + qf_entry * layout_qf[1] + (e_start + b) * layout_qf[2]] : 0.0;
+              }
+            }
+
+            // Contract one quadrature dimension at a time
+            for (CeedInt d = 0; d < dim; d++) {
+              const CeedInt     num_q_rest = CeedIntPow(Q, dim - d - 1), num_n_prev = CeedIntPow(P, d);
+              const CeedScalar *in = tmp[(d + 1) % 2], *W_d = W[grad_dim_out[e_out] == d][grad_dim_in[e_in] == d];
+              CeedScalar       *out = d == dim - 1 ? diag : tmp[d % 2];
+
+              if (d < dim - 1) {
+                for (CeedInt k = 0; k < num_q_rest * P * num_n_prev * block_size; k++) out[k] = 0.0;
+              }
+              for (CeedInt q_rest = 0; q_rest < num_q_rest; q_rest++) {
+                for (CeedInt q = 0; q < Q; q++) {
+                  const CeedScalar *in_q = &in[(q_rest * Q + q) * num_n_prev * block_size];
+
+                  for (CeedInt n = 0; n < P; n++) {
+                    const CeedScalar W_qn  = W_d[q * P + n];
+                    CeedScalar      *out_n = &out[(q_rest * P + n) * num_n_prev * block_size];
+
+                    if (W_qn == 0.0) continue;
+                    CeedPragmaSIMD for (CeedInt k = 0; k < num_n_prev * block_size; k++) out_n[k] += W_qn * in_q[k];
+                  }
+                }
+              }
+            }
+          }
+        }
+
+        // Scatter element diagonals
+        for (CeedInt b = 0; b < num_elem_block; b++) {
+          CeedScalar *diag_e = &elem_diag_array[(((CeedSize)(e_start + b) * num_comp + c_out) * num_comp_in + i) * num_nodes];
+
+          for (CeedInt n = 0; n < num_nodes; n++) diag_e[n] += diag[n * block_size + b];
+        }
+      }
+    }
+  }
+  for (CeedInt i = 0; i < 2; i++) {
+    for (CeedInt j = 0; j < 2; j++) CeedCall(CeedFree(&W[i][j]));
+  }
+  CeedCall(CeedFree(&diag));
+  CeedCall(CeedFree(&tmp[0]));
+  CeedCall(CeedFree(&tmp[1]));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Core logic for assembling operator diagonal or point block diagonal.
+
+  If the backend can assemble the `CeedQFunction` for a range of elements and the assembled `CeedQFunction` is not being reused, the assembled
+  `CeedQFunction` data is built and consumed in chunks of elements rather than stored for the entire mesh.
 
   @param[in]  op             `CeedOperator` to assemble diagonal or point block diagonal
   @param[in]  request        Address of @ref CeedRequest for non-blocking completion, else @ref CEED_REQUEST_IMMEDIATE
@@ -222,17 +577,6 @@ static inline int CeedSingleOperatorLinearAssembleAddDiagonal_Mesh(CeedOperator
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
   CeedCheck(!is_composite, CeedOperatorReturnCeed(op), CEED_ERROR_UNSUPPORTED, "Composite operator not supported");
 
-  // Assemble QFunction
-  CeedInt             layout_qf[3];
-  const CeedScalar   *assembled_qf_array;
-  CeedVector          assembled_qf        = NULL;
-  CeedElemRestriction assembled_elem_rstr = NULL;
-
-  CeedCall(CeedOperatorLinearAssembleQFunctionBuildOrUpdate(op, &assembled_qf, &assembled_elem_rstr, request));
-  CeedCall(CeedElemRestrictionGetELayout(assembled_elem_rstr, layout_qf));
-  CeedCall(CeedElemRestrictionDestroy(&assembled_elem_rstr));
-  CeedCall(CeedVectorGetArrayRead(assembled_qf, CEED_MEM_HOST, &assembled_qf_array));
-
   // Get assembly data
   const CeedEvalMode     **eval_modes_in, **eval_modes_out;
   CeedInt                  num_active_bases_in, *num_eval_modes_in, num_active_bases_out, *num_eval_modes_out;
@@ -248,14 +592,28 @@ static inline int CeedSingleOperatorLinearAssembleAddDiagonal_Mesh(CeedOperator
   CeedCall(CeedOperatorAssemblyDataGetBases(data, NULL, &active_bases_in, NULL, NULL, &active_bases_out, NULL));
   CeedCall(CeedOperatorAssemblyDataGetElemRestrictions(data, NULL, &active_elem_rstrs_in, NULL, &active_elem_rstrs_out));
 
-  // Loop over all active bases (find matching input/output pairs)
-  for (CeedInt b = 0; b < CeedIntMin(num_active_bases_in, num_active_bases_out); b++) {
-    CeedInt             b_in, b_out, num_elem, num_nodes, num_qpts, num_comp;
-    bool                has_eval_none = false;
-    CeedScalar         *elem_diag_array, *identity = NULL;
-    CeedVector          elem_diag;
-    CeedElemRestriction diag_elem_rstr;
-
+  // Find matching input/output active basis pairs and set up element diagonals
+  const CeedInt        num_pairs = CeedIntMin(num_active_bases_in, num_active_bases_out);
+  CeedInt              num_elem, num_input_components, *pair_b_in, *pair_b_out;
+  bool                *pair_is_tensor;
+  CeedScalar         **elem_diag_arrays, **identities;
+  CeedVector          *elem_diags;
+  CeedElemRestriction *diag_elem_rstrs;
+
+  CeedCall(CeedOperatorGetNumElements(op, &num_elem));
+  CeedCall(CeedCalloc(num_pairs, &pair_b_in));
+  CeedCall(CeedCalloc(num_pairs, &pair_b_out));
+  CeedCall(CeedCalloc(num_pairs, &pair_is_tensor));
+  CeedCall(CeedCalloc(num_pairs, &elem_diag_arrays));
+  CeedCall(CeedCalloc(num_pairs, &identities));
+  CeedCall(CeedCalloc(num_pairs, &elem_diags));
+  CeedCall(CeedCalloc(num_pairs, &diag_elem_rstrs));
+  CeedCall(CeedOperatorAssemblyDataGetQFunctionEntries(data, &num_input_components, NULL, NULL));
+  for (CeedInt b = 0; b < num_pairs; b++) {
+    CeedInt b_in, b_out, num_nodes, num_qpts;
+    bool    has_eval_none = false;
+
+    pair_b_in[b] = pair_b_out[b] = -1;
     if (num_active_bases_in <= num_active_bases_out) {
       b_in = b;
       for (b_out = 0; b_out < num_active_bases_out; b_out++) {
@@ -279,27 +637,36 @@ static inline int CeedSingleOperatorLinearAssembleAddDiagonal_Mesh(CeedOperator
     }
     CeedCheck(active_elem_rstrs_in[b_in] == active_elem_rstrs_out[b_out], CeedOperatorReturnCeed(op), CEED_ERROR_UNSUPPORTED,
               "Cannot assemble operator diagonal with different input and output active element restrictions");
+    pair_b_in[b]  = b_in;
+    pair_b_out[b] = b_out;
 
     // Assemble point block diagonal restriction, if needed
     if (is_point_block) {
-      CeedCall(CeedOperatorCreateActivePointBlockRestriction(active_elem_rstrs_in[b_in], &diag_elem_rstr));
+      CeedCall(CeedOperatorCreateActivePointBlockRestriction(active_elem_rstrs_in[b_in], &diag_elem_rstrs[b]));
     } else {
-      CeedCall(CeedElemRestrictionCreateUnsignedCopy(active_elem_rstrs_in[b_in], &diag_elem_rstr));
+      CeedCall(CeedElemRestrictionCreateUnsignedCopy(active_elem_rstrs_in[b_in], &diag_elem_rstrs[b]));
     }
 
     // Create diagonal vector
-    CeedCall(CeedElemRestrictionCreateVector(diag_elem_rstr, NULL, &elem_diag));
+    CeedCall(CeedElemRestrictionCreateVector(diag_elem_rstrs[b], NULL, &elem_diags[b]));
+    CeedCall(CeedVectorSetValue(elem_diags[b], 0.0));
+    CeedCall(CeedVectorGetArray(elem_diags[b], CEED_MEM_HOST, &elem_diag_arrays[b]));
 
-    // Assemble element operator diagonals
-    CeedCall(CeedVectorSetValue(elem_diag, 0.0));
-    CeedCall(CeedVectorGetArray(elem_diag, CEED_MEM_HOST, &elem_diag_array));
-    CeedCall(CeedElemRestrictionGetNumElements(diag_elem_rstr, &num_elem));
+    // Check for sum factorized assembly with a tensor product basis
+    if (active_bases_in[b_in] != CEED_BASIS_NONE) {
+      CeedCall(CeedBasisIsTensor(active_bases_in[b_in], &pair_is_tensor[b]));
+    }
+    for (CeedInt i = 0; i < num_eval_modes_in[b_in]; i++) {
+      pair_is_tensor[b] &= eval_modes_in[b_in][i] == CEED_EVAL_INTERP || eval_modes_in[b_in][i] == CEED_EVAL_GRAD;
+    }
+    for (CeedInt i = 0; i < num_eval_modes_out[b_out]; i++) {
+      pair_is_tensor[b] &= eval_modes_out[b_out][i] == CEED_EVAL_INTERP || eval_modes_out[b_out][i] == CEED_EVAL_GRAD;
+    }
+
+    // Construct identity matrix for basis if required
     CeedCall(CeedBasisGetNumNodes(active_bases_in[b_in], &num_nodes));
-    CeedCall(CeedBasisGetNumComponents(active_bases_in[b_in], &num_comp));
     if (active_bases_in[b_in] == CEED_BASIS_NONE) num_qpts = num_nodes;
     else CeedCall(CeedBasisGetNumQuadraturePoints(active_bases_in[b_in], &num_qpts));
-
-    // Construct identity matrix for basis if required
     for (CeedInt i = 0; i < num_eval_modes_in[b_in]; i++) {
       has_eval_none = has_eval_none || (eval_modes_in[b_in][i] == CEED_EVAL_NONE);
     }
@@ -307,84 +674,89 @@ static inline int CeedSingleOperatorLinearAssembleAddDiagonal_Mesh(CeedOperator
       has_eval_none = has_eval_none || (eval_modes_out[b_out][i] == CEED_EVAL_NONE);
     }
     if (has_eval_none) {
-      CeedCall(CeedCalloc(num_qpts * num_nodes, &identity));
-      for (CeedInt i = 0; i < (num_nodes < num_qpts ? num_nodes : num_qpts); i++) identity[i * num_nodes + i] = 1.0;
-    }
-
-    // Compute the diagonal of B^T D B
-    // Each element
-    for (CeedSize e = 0; e < num_elem; e++) {
-      // Each basis eval mode pair
-      CeedInt      d_out              = 0, q_comp_out;
-      CeedEvalMode eval_mode_out_prev = CEED_EVAL_NONE;
-
-      for (CeedInt e_out = 0; e_out < num_eval_modes_out[b_out]; e_out++) {
-        CeedInt           d_in              = 0, q_comp_in;
-        const CeedScalar *B_t               = NULL;
-        CeedEvalMode      eval_mode_in_prev = CEED_EVAL_NONE;
-
-        CeedCall(CeedOperatorGetBasisPointer(active_bases_out[b_out], eval_modes_out[b_out][e_out], identity, &B_t));
-        CeedCall(CeedBasisGetNumQuadratureComponents(active_bases_out[b_out], eval_modes_out[b_out][e_out], &q_comp_out));
-        if (q_comp_out > 1) {
-          if (e_out == 0 || eval_modes_out[b_out][e_out] != eval_mode_out_prev) d_out = 0;
-          else B_t = &B_t[(++d_out) * num_qpts * num_nodes];
-        }
-        eval_mode_out_prev = eval_modes_out[b_out][e_out];
+      CeedCall(CeedCalloc(num_qpts * num_nodes, &identities[b]));
+      for (CeedInt i = 0; i < (num_nodes < num_qpts ? num_nodes : num_qpts); i++) identities[b][i * num_nodes + i] = 1.0;
+    }
+  }
 
-        for (CeedInt e_in = 0; e_in < num_eval_modes_in[b_in]; e_in++) {
-          const CeedScalar *B = NULL;
+  // Assemble QFunction, streaming chunks of elements if the backend supports it
+  bool                      use_chunks;
+  CeedInt                   chunk_size, layout_qf[3];
+  const CeedInt            *entry_map = NULL;
+  const CeedScalar         *assembled_qf_array;
+  CeedVector                assembled_qf = NULL;
+  CeedQFunctionAssemblyData qf_data;
 
-          CeedCall(CeedOperatorGetBasisPointer(active_bases_in[b_in], eval_modes_in[b_in][e_in], identity, &B));
-          CeedCall(CeedBasisGetNumQuadratureComponents(active_bases_in[b_in], eval_modes_in[b_in][e_in], &q_comp_in));
-          if (q_comp_in > 1) {
-            if (e_in == 0 || eval_modes_in[b_in][e_in] != eval_mode_in_prev) d_in = 0;
-            else B = &B[(++d_in) * num_qpts * num_nodes];
-          }
-          eval_mode_in_prev = eval_modes_in[b_in][e_in];
+  CeedCall(CeedOperatorGetQFunctionAssemblyData(op, &qf_data));
+  use_chunks = op->LinearAssembleQFunctionElements && !qf_data->reuse_data;
+  chunk_size = use_chunks ? CeedIntMin(num_elem, 256) : num_elem;
+  if (use_chunks) {
+    CeedInt num_qpts;
 
-          // Each component
-          for (CeedInt c_out = 0; c_out < num_comp; c_out++) {
-            // Each qpt/node pair
-            for (CeedInt q = 0; q < num_qpts; q++) {
-              if (is_point_block) {
-                // Point Block Diagonal
-                for (CeedInt c_in = 0; c_in < num_comp; c_in++) {
-                  const CeedSize c_offset =
-                      (eval_mode_offsets_in[b_in][e_in] + c_in) * num_output_components + eval_mode_offsets_out[b_out][e_out] + c_out;
-                  const CeedScalar qf_value = assembled_qf_array[q * layout_qf[0] + c_offset * layout_qf[1] + e * layout_qf[2]];
-
-                  for (CeedInt n = 0; n < num_nodes; n++) {
-                    elem_diag_array[((e * num_comp + c_out) * num_comp + c_in) * num_nodes + n] +=
-                        B_t[q * num_nodes + n] * qf_value * B[q * num_nodes + n];
-                  }
-                }
-              } else {
-                // Diagonal Only
-                const CeedInt c_offset =
-                    (eval_mode_offsets_in[b_in][e_in] + c_out) * num_output_components + eval_mode_offsets_out[b_out][e_out] + c_out;
-                const CeedScalar qf_value = assembled_qf_array[q * layout_qf[0] + c_offset * layout_qf[1] + e * layout_qf[2]];
+    CeedCall(CeedOperatorGetNumQuadraturePoints(op, &num_qpts));
+    layout_qf[0] = 1;
+    layout_qf[1] = num_qpts;
+    layout_qf[2] = num_qpts * num_input_components * num_output_components;
+    CeedCall(CeedVectorCreate(CeedOperatorReturnCeed(op), (CeedSize)chunk_size * layout_qf[2], &assembled_qf));
+  } else {
+    CeedCall(CeedSingleOperatorLinearAssembleQFunctionCompressed(op, request, &assembled_qf, layout_qf, &entry_map));
+  }
 
-                for (CeedInt n = 0; n < num_nodes; n++) {
-                  elem_diag_array[(e * num_comp + c_out) * num_nodes + n] += B_t[q * num_nodes + n] * qf_value * B[q * num_nodes + n];
-                }
-              }
-            }
-          }
-        }
+  // Assemble element operator diagonals
+  for (CeedInt e_start = 0; e_start < num_elem; e_start += chunk_size) {
+    const CeedInt num_elem_chunk = CeedIntMin(chunk_size, num_elem - e_start);
+
+    if (use_chunks) CeedCall(op->LinearAssembleQFunctionElements(op, e_start, num_elem_chunk, assembled_qf, request));
+    CeedCall(CeedVectorGetArrayRead(assembled_qf, CEED_MEM_HOST, &assembled_qf_array));
+    for (CeedInt b = 0; b < num_pairs; b++) {
+      const CeedInt     b_in = pair_b_in[b], b_out = pair_b_out[b];
+      const CeedScalar *qf_array_chunk = use_chunks ? assembled_qf_array : &assembled_qf_array[(CeedSize)e_start * layout_qf[2]];
+      CeedInt           num_comp;
+      CeedScalar       *elem_diag_chunk;
+
+      if (b_in == -1) continue;
+      CeedCall(CeedBasisGetNumComponents(active_bases_in[b_in], &num_comp));
+      {
+        CeedInt num_nodes;
+
+        CeedCall(CeedBasisGetNumNodes(active_bases_in[b_in], &num_nodes));
+        elem_diag_chunk = &elem_diag_arrays[b][(CeedSize)e_start * num_comp * (is_point_block ? num_comp : 1) * num_nodes];
+      }
+      if (pair_is_tensor[b]) {
+        CeedCall(CeedSingleOperatorAssembleDiagonalTensor(active_bases_in[b_in], num_elem_chunk, num_comp, is_point_block, num_eval_modes_in[b_in],
+                                                          eval_modes_in[b_in], eval_mode_offsets_in[b_in], num_eval_modes_out[b_out],
+                                                          eval_modes_out[b_out], eval_mode_offsets_out[b_out], num_output_components, entry_map,
+                                                          layout_qf, qf_array_chunk, elem_diag_chunk));
+      } else {
+        CeedCall(CeedSingleOperatorAssembleDiagonalElements(active_bases_in[b_in], active_bases_out[b_out], num_elem_chunk, num_comp, is_point_block,
+                                                            num_eval_modes_in[b_in], eval_modes_in[b_in], eval_mode_offsets_in[b_in],
+                                                            num_eval_modes_out[b_out], eval_modes_out[b_out], eval_mode_offsets_out[b_out],
+                                                            num_output_components, identities[b], entry_map, layout_qf, qf_array_chunk,
+                                                            elem_diag_chunk));
       }
     }
-    CeedCall(CeedVectorRestoreArray(elem_diag, &elem_diag_array));
+    CeedCall(CeedVectorRestoreArrayRead(assembled_qf, &assembled_qf_array));
+  }
+  CeedCall(CeedVectorDestroy(&assembled_qf));
 
-    // Assemble local operator diagonal
-    CeedCall(CeedElemRestrictionApply(diag_elem_rstr, CEED_TRANSPOSE, elem_diag, assembled, request));
+  // Assemble local operator diagonal
+  for (CeedInt b = 0; b < num_pairs; b++) {
+    if (pair_b_in[b] == -1) continue;
+    CeedCall(CeedVectorRestoreArray(elem_diags[b], &elem_diag_arrays[b]));
+    CeedCall(CeedElemRestrictionApply(diag_elem_rstrs[b], CEED_TRANSPOSE, elem_diags[b], assembled, request));
 
     // Cleanup
-    CeedCall(CeedElemRestrictionDestroy(&diag_elem_rstr));
-    CeedCall(CeedVectorDestroy(&elem_diag));
-    CeedCall(CeedFree(&identity));
-  }
-  CeedCall(CeedVectorRestoreArrayRead(assembled_qf, &assembled_qf_array));
-  CeedCall(CeedVectorDestroy(&assembled_qf));
+    CeedCall(CeedElemRestrictionDestroy(&diag_elem_rstrs[b]));
+    CeedCall(CeedVectorDestroy(&elem_diags[b]));
+    CeedCall(CeedFree(&identities[b]));
+  }
+  CeedCall(CeedFree(&pair_b_in));
+  CeedCall(CeedFree(&pair_b_out));
+  CeedCall(CeedFree(&pair_is_tensor));
+  CeedCall(CeedFree(&elem_diag_arrays));
+  CeedCall(CeedFree(&identities));
+  CeedCall(CeedFree(&elem_diags));
+  CeedCall(CeedFree(&diag_elem_rstrs));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -439,54 +811,140 @@ static inline int CeedCompositeOperatorLinearAssembleAddDiagonal(CeedOperator op
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get the L-vector node of each E-vector node of an active `CeedElemRestriction`.
+
+  Offsets based and user strided restrictions are read directly.
+  Other restrictions are applied to a vector holding the node indices.
+
+  @param[in]  rstr      `CeedElemRestriction` to query
+  @param[in]  num_nodes Length of the L-vector
+  @param[out] elem_dof  Array of L-vector nodes, ordered by element, component, and element node
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorAssemblyGetElemDof(CeedElemRestriction rstr, CeedSize num_nodes, CeedSize **elem_dof) {
+  bool                has_backend_strides = true;
+  CeedInt             num_elem, elem_size, num_comp, block_size;
+  CeedRestrictionType rstr_type;
+
+  CeedCall(CeedElemRestrictionGetType(rstr, &rstr_type));
+  CeedCall(CeedElemRestrictionGetNumElements(rstr, &num_elem));
+  CeedCall(CeedElemRestrictionGetElementSize(rstr, &elem_size));
+  CeedCall(CeedElemRestrictionGetNumComponents(rstr, &num_comp));
+  CeedCall(CeedElemRestrictionGetBlockSize(rstr, &block_size));
+  if (rstr_type == CEED_RESTRICTION_STRIDED) CeedCall(CeedElemRestrictionHasBackendStrides(rstr, &has_backend_strides));
+  CeedCall(CeedMalloc((CeedSize)num_elem * num_comp * elem_size, elem_dof));
+
+  if (block_size == 1 && (rstr_type == CEED_RESTRICTION_STANDARD || rstr_type == CEED_RESTRICTION_ORIENTED ||
+                          rstr_type == CEED_RESTRICTION_CURL_ORIENTED)) {
+    // Offsets give the node of each element node and component 0
+    CeedInt        comp_stride;
+    const CeedInt *offsets;
+
+    CeedCall(CeedElemRestrictionGetCompStride(rstr, &comp_stride));
+    CeedCall(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets));
+    CeedPragmaOMP(parallel for)
+    for (CeedInt e = 0; e < num_elem; e++) {
+      for (CeedInt comp = 0; comp < num_comp; comp++) {
+        for (CeedInt i = 0; i < elem_size; i++) {
+          (*elem_dof)[((CeedSize)e * num_comp + comp) * elem_size + i] = (CeedSize)offsets[(CeedSize)e * elem_size + i] + (CeedSize)comp * comp_stride;
+        }
+      }
+    }
+    CeedCall(CeedElemRestrictionRestoreOffsets(rstr, &offsets));
+  } else if (rstr_type == CEED_RESTRICTION_STRIDED && !has_backend_strides) {
+    // User strides give the node directly
+    CeedInt strides[3];
+
+    CeedCall(CeedElemRestrictionGetStrides(rstr, strides));
+    CeedPragmaOMP(parallel for)
+    for (CeedInt e = 0; e < num_elem; e++) {
+      for (CeedInt comp = 0; comp < num_comp; comp++) {
+        for (CeedInt i = 0; i < elem_size; i++) {
+          (*elem_dof)[((CeedSize)e * num_comp + comp) * elem_size + i] =
+              (CeedSize)i * strides[0] + (CeedSize)comp * strides[1] + (CeedSize)e * strides[2];
+        }
+      }
+    }
+  } else {
+    // Restrict a vector of node indices
+    Ceed                ceed;
+    CeedInt             layout[3];
+    CeedScalar         *array;
+    const CeedScalar   *elem_dof_a;
+    CeedVector          index_vec, elem_dof_vec;
+    CeedElemRestriction index_elem_rstr;
+
+    CeedCall(CeedElemRestrictionGetCeed(rstr, &ceed));
+    CeedCall(CeedElemRestrictionGetELayout(rstr, layout));
+    CeedCall(CeedVectorCreate(ceed, num_nodes, &index_vec));
+    CeedCall(CeedVectorGetArrayWrite(index_vec, CEED_MEM_HOST, &array));
+    for (CeedSize i = 0; i < num_nodes; i++) array[i] = i;
+    CeedCall(CeedVectorRestoreArray(index_vec, &array));
+    CeedCall(CeedVectorCreate(ceed, (CeedSize)num_elem * elem_size * num_comp, &elem_dof_vec));
+    CeedCall(CeedVectorSetValue(elem_dof_vec, 0.0));
+    CeedCall(CeedElemRestrictionCreateUnorientedCopy(rstr, &index_elem_rstr));
+    CeedCall(CeedElemRestrictionApply(index_elem_rstr, CEED_NOTRANSPOSE, index_vec, elem_dof_vec, CEED_REQUEST_IMMEDIATE));
+    CeedCall(CeedVectorGetArrayRead(elem_dof_vec, CEED_MEM_HOST, &elem_dof_a));
+    for (CeedInt e = 0; e < num_elem; e++) {
+      for (CeedInt comp = 0; comp < num_comp; comp++) {
+        for (CeedInt i = 0; i < elem_size; i++) {
+          (*elem_dof)[((CeedSize)e * num_comp + comp) * elem_size + i] =
+              (CeedSize)elem_dof_a[(CeedSize)i * layout[0] + (CeedSize)comp * layout[1] + (CeedSize)e * layout[2]];
+        }
+      }
+    }
+    CeedCall(CeedVectorRestoreArrayRead(elem_dof_vec, &elem_dof_a));
+    CeedCall(CeedVectorDestroy(&index_vec));
+    CeedCall(CeedVectorDestroy(&elem_dof_vec));
+    CeedCall(CeedElemRestrictionDestroy(&index_elem_rstr));
+    CeedCall(CeedDestroy(&ceed));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Build nonzero pattern for non-composite CeedOperator`.
 
-  Users should generally use @ref CeedOperatorLinearAssembleSymbolic().
+  Users should generally use @ref CeedOperatorLinearAssembleSymbolic() or @ref CeedOperatorLinearAssembleSymbolicCeedSize().
+  Exactly one of the `CeedInt` or `CeedSize` pairs of output arrays is provided; the other pair is `NULL`.
 
-  @param[in]  op     `CeedOperator` to assemble nonzero pattern
-  @param[in]  offset Offset for number of entries
-  @param[out] rows   Row number for each entry
-  @param[out] cols   Column number for each entry
+  @param[in]  op        `CeedOperator` to assemble nonzero pattern
+  @param[in]  offset    Offset for number of entries
+  @param[out] rows      Row number for each entry, as `CeedInt`
+  @param[out] cols      Column number for each entry, as `CeedInt`
+  @param[out] rows_size Row number for each entry, as `CeedSize`
+  @param[out] cols_size Column number for each entry, as `CeedSize`
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref Developer
 **/
-static int CeedSingleOperatorAssembleSymbolic(CeedOperator op, CeedInt offset, CeedInt *rows, CeedInt *cols) {
+static int CeedSingleOperatorAssembleSymbolic(CeedOperator op, CeedSize offset, CeedInt *rows, CeedInt *cols, CeedSize *rows_size,
+                                              CeedSize *cols_size) {
   Ceed                ceed;
   bool                is_composite;
-  CeedSize            num_nodes_in, num_nodes_out, local_num_entries, count = 0;
-  CeedInt             num_elem_in, elem_size_in, num_comp_in, layout_er_in[3];
-  CeedInt             num_elem_out, elem_size_out, num_comp_out, layout_er_out[3];
-  CeedScalar         *array;
-  const CeedScalar   *elem_dof_a_in, *elem_dof_a_out;
-  CeedVector          index_vec_in, index_vec_out, elem_dof_in, elem_dof_out;
-  CeedElemRestriction elem_rstr_in, elem_rstr_out, index_elem_rstr_in, index_elem_rstr_out;
+  CeedSize            num_nodes_in, num_nodes_out, *elem_dof_in, *elem_dof_out;
+  CeedInt             num_elem_in, elem_size_in, num_comp_in, num_elem_out, elem_size_out, num_comp_out;
+  CeedElemRestriction elem_rstr_in, elem_rstr_out;
 
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
   CeedCall(CeedOperatorGetCeed(op, &ceed));
   CeedCheck(!is_composite, ceed, CEED_ERROR_UNSUPPORTED, "Composite operator not supported");
 
   CeedCall(CeedOperatorGetActiveVectorLengths(op, &num_nodes_in, &num_nodes_out));
+  CeedCheck(rows_size || (num_nodes_in <= INT32_MAX && num_nodes_out <= INT32_MAX), ceed, CEED_ERROR_UNSUPPORTED,
+            "Active vector lengths exceed CeedInt, use CeedOperatorLinearAssembleSymbolicCeedSize");
   CeedCall(CeedOperatorGetActiveElemRestrictions(op, &elem_rstr_in, &elem_rstr_out));
   CeedCall(CeedElemRestrictionGetNumElements(elem_rstr_in, &num_elem_in));
   CeedCall(CeedElemRestrictionGetElementSize(elem_rstr_in, &elem_size_in));
   CeedCall(CeedElemRestrictionGetNumComponents(elem_rstr_in, &num_comp_in));
-  CeedCall(CeedElemRestrictionGetELayout(elem_rstr_in, layout_er_in));
 
   // Determine elem_dof relation for input
-  CeedCall(CeedVectorCreate(ceed, num_nodes_in, &index_vec_in));
-  CeedCall(CeedVectorGetArrayWrite(index_vec_in, CEED_MEM_HOST, &array));
-  for (CeedSize i = 0; i < num_nodes_in; i++) array[i] = i;
-  CeedCall(CeedVectorRestoreArray(index_vec_in, &array));
-  CeedCall(CeedVectorCreate(ceed, num_elem_in * elem_size_in * num_comp_in, &elem_dof_in));
-  CeedCall(CeedVectorSetValue(elem_dof_in, 0.0));
-  CeedCall(CeedElemRestrictionCreateUnorientedCopy(elem_rstr_in, &index_elem_rstr_in));
-  CeedCall(CeedElemRestrictionApply(index_elem_rstr_in, CEED_NOTRANSPOSE, index_vec_in, elem_dof_in, CEED_REQUEST_IMMEDIATE));
-  CeedCall(CeedVectorGetArrayRead(elem_dof_in, CEED_MEM_HOST, &elem_dof_a_in));
-  CeedCall(CeedVectorDestroy(&index_vec_in));
-  CeedCall(CeedElemRestrictionDestroy(&index_elem_rstr_in));
+  CeedCall(CeedOperatorAssemblyGetElemDof(elem_rstr_in, num_nodes_in, &elem_dof_in));
 
   if (elem_rstr_in != elem_rstr_out) {
     CeedCall(CeedElemRestrictionGetNumElements(elem_rstr_out, &num_elem_out));
@@ -496,63 +954,193 @@ static int CeedSingleOperatorAssembleSymbolic(CeedOperator op, CeedInt offset, C
               num_elem_in, num_elem_out);
     CeedCall(CeedElemRestrictionGetElementSize(elem_rstr_out, &elem_size_out));
     CeedCall(CeedElemRestrictionGetNumComponents(elem_rstr_out, &num_comp_out));
-    CeedCall(CeedElemRestrictionGetELayout(elem_rstr_out, layout_er_out));
 
     // Determine elem_dof relation for output
-    CeedCall(CeedVectorCreate(ceed, num_nodes_out, &index_vec_out));
-    CeedCall(CeedVectorGetArrayWrite(index_vec_out, CEED_MEM_HOST, &array));
-    for (CeedSize i = 0; i < num_nodes_out; i++) array[i] = i;
-    CeedCall(CeedVectorRestoreArray(index_vec_out, &array));
-    CeedCall(CeedVectorCreate(ceed, num_elem_out * elem_size_out * num_comp_out, &elem_dof_out));
-    CeedCall(CeedVectorSetValue(elem_dof_out, 0.0));
-    CeedCall(CeedElemRestrictionCreateUnorientedCopy(elem_rstr_out, &index_elem_rstr_out));
-    CeedCall(CeedElemRestrictionApply(index_elem_rstr_out, CEED_NOTRANSPOSE, index_vec_out, elem_dof_out, CEED_REQUEST_IMMEDIATE));
-    CeedCall(CeedVectorGetArrayRead(elem_dof_out, CEED_MEM_HOST, &elem_dof_a_out));
-    CeedCall(CeedVectorDestroy(&index_vec_out));
-    CeedCall(CeedElemRestrictionDestroy(&index_elem_rstr_out));
+    CeedCall(CeedOperatorAssemblyGetElemDof(elem_rstr_out, num_nodes_out, &elem_dof_out));
   } else {
-    num_elem_out     = num_elem_in;
-    elem_size_out    = elem_size_in;
-    num_comp_out     = num_comp_in;
-    layout_er_out[0] = layout_er_in[0];
-    layout_er_out[1] = layout_er_in[1];
-    layout_er_out[2] = layout_er_in[2];
-    elem_dof_a_out   = elem_dof_a_in;
+    num_elem_out  = num_elem_in;
+    elem_size_out = elem_size_in;
+    num_comp_out  = num_comp_in;
+    elem_dof_out  = elem_dof_in;
   }
-  local_num_entries = (CeedSize)elem_size_out * num_comp_out * elem_size_in * num_comp_in * num_elem_in;
 
   // Determine i, j locations for element matrices
+  const CeedSize num_entries_elem = (CeedSize)elem_size_out * num_comp_out * elem_size_in * num_comp_in;
+
+  CeedPragmaOMP(parallel for)
   for (CeedInt e = 0; e < num_elem_in; e++) {
+    CeedSize count = offset + e * num_entries_elem;
+
     for (CeedInt comp_in = 0; comp_in < num_comp_in; comp_in++) {
       for (CeedInt comp_out = 0; comp_out < num_comp_out; comp_out++) {
+        const CeedSize *elem_dof_row = &elem_dof_out[((CeedSize)e * num_comp_out + comp_out) * elem_size_out];
+        const CeedSize *elem_dof_col = &elem_dof_in[((CeedSize)e * num_comp_in + comp_in) * elem_size_in];
+
         for (CeedInt i = 0; i < elem_size_out; i++) {
-          for (CeedInt j = 0; j < elem_size_in; j++) {
-            const CeedInt elem_dof_index_row = i * layout_er_out[0] + comp_out * layout_er_out[1] + e * layout_er_out[2];
-            const CeedInt elem_dof_index_col = j * layout_er_in[0] + comp_in * layout_er_in[1] + e * layout_er_in[2];
-            const CeedInt row                = elem_dof_a_out[elem_dof_index_row];
-            const CeedInt col                = elem_dof_a_in[elem_dof_index_col];
-
-            rows[offset + count] = row;
-            cols[offset + count] = col;
-            count++;
+          if (rows_size) {
+            for (CeedInt j = 0; j < elem_size_in; j++) {
+              rows_size[count + j] = elem_dof_row[i];
+              cols_size[count + j] = elem_dof_col[j];
+            }
+          } else {
+            for (CeedInt j = 0; j < elem_size_in; j++) {
+              rows[count + j] = (CeedInt)elem_dof_row[i];
+              cols[count + j] = (CeedInt)elem_dof_col[j];
+            }
           }
+          count += elem_size_in;
         }
       }
     }
   }
-  CeedCheck(count == local_num_entries, ceed, CEED_ERROR_MAJOR, "Error computing assembled entries");
-  CeedCall(CeedVectorRestoreArrayRead(elem_dof_in, &elem_dof_a_in));
-  CeedCall(CeedVectorDestroy(&elem_dof_in));
-  if (elem_rstr_in != elem_rstr_out) {
-    CeedCall(CeedVectorRestoreArrayRead(elem_dof_out, &elem_dof_a_out));
-    CeedCall(CeedVectorDestroy(&elem_dof_out));
-  }
+  if (elem_dof_out != elem_dof_in) CeedCall(CeedFree(&elem_dof_out));
+  CeedCall(CeedFree(&elem_dof_in));
   CeedCall(CeedElemRestrictionDestroy(&elem_rstr_in));
   CeedCall(CeedElemRestrictionDestroy(&elem_rstr_out));
   CeedCall(CeedDestroy(&ceed));
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Assemble element matrices for non-composite `CeedOperator` with tensor product active bases using sum factorization.
+
+  The element matrix for each pair of active input and output evaluation modes is formed by contracting the assembled `CeedQFunction` data with the
+  1D interpolation and gradient matrices one dimension at a time, costing \f$O(P^{2d} Q)\f$ rather than \f$O(P^{2d} Q^d)\f$ per element.
+  Blocks of elements are processed together, with the element index fastest so the inner loops vectorize.
+
+  @param[in]  op                 `CeedOperator` to assemble
+  @param[in]  basis_in           Active input tensor product basis
+  @param[in]  basis_out          Active output tensor product basis
+  @param[in]  num_elem           Number of elements
+  @param[in]  num_comp_in        Number of active input components
+  @param[in]  num_comp_out       Number of active output components
+  @param[in]  num_eval_modes_in  Number of active input evaluation modes
+  @param[in]  eval_modes_in      Active input evaluation modes, @ref CEED_EVAL_INTERP or @ref CEED_EVAL_GRAD
+  @param[in]  num_eval_modes_out Number of active output evaluation modes
+  @param[in]  eval_modes_out     Active output evaluation modes, @ref CEED_EVAL_INTERP or @ref CEED_EVAL_GRAD
+  @param[in]  entry_map          Map from assembled `CeedQFunction` matrix entries to stored entries, or `NULL` if all entries are stored
+  @param[in]  layout_qf          E-vector layout of assembled `CeedQFunction` data
+  @param[in]  assembled_qf_array Assembled `CeedQFunction` data
+  @param[out] vals               Array to store element matrix entries in
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedSingleOperatorAssembleTensor(CeedOperator op, CeedBasis basis_in, CeedBasis basis_out, CeedInt num_elem, CeedInt num_comp_in,
+                                            CeedInt num_comp_out, CeedInt num_eval_modes_in, const CeedEvalMode *eval_modes_in,
+                                            CeedInt num_eval_modes_out, const CeedEvalMode *eval_modes_out, const CeedInt *entry_map,
+                                            const CeedInt layout_qf[3], const CeedScalar *assembled_qf_array, CeedScalar *vals) {
+  const CeedInt     block_size = 8;
+  CeedInt           dim, P_in, P_out, Q, num_qpts, num_nodes_in, num_nodes_out, tmp_size;
+  const CeedScalar *interp_in, *grad_in, *interp_out, *grad_out;
+  CeedScalar       *elem_mat, *tmp[2];
+
+  CeedCall(CeedBasisGetDimension(basis_in, &dim));
+  CeedCall(CeedBasisGetNumNodes1D(basis_in, &P_in));
+  CeedCall(CeedBasisGetNumNodes1D(basis_out, &P_out));
+  CeedCall(CeedBasisGetNumQuadraturePoints1D(basis_in, &Q));
+  CeedCall(CeedBasisGetInterp1D(basis_in, &interp_in));
+  CeedCall(CeedBasisGetGrad1D(basis_in, &grad_in));
+  CeedCall(CeedBasisGetInterp1D(basis_out, &interp_out));
+  CeedCall(CeedBasisGetGrad1D(basis_out, &grad_out));
+  num_qpts      = CeedIntPow(Q, dim);
+  num_nodes_in  = CeedIntPow(P_in, dim);
+  num_nodes_out = CeedIntPow(P_out, dim);
+
+  // 1D factors for each evaluation mode and dimension; each gradient field contributes dim consecutive evaluation modes
+  const CeedScalar *B_in[num_eval_modes_in][dim], *B_out[num_eval_modes_out][dim];
+
+  for (CeedInt e_in = 0, grad_dim = 0; e_in < num_eval_modes_in; e_in++) {
+    const bool is_grad = eval_modes_in[e_in] == CEED_EVAL_GRAD;
+
+    for (CeedInt d = 0; d < dim; d++) B_in[e_in][d] = (is_grad && d == grad_dim) ? grad_in : interp_in;
+    if (is_grad) grad_dim = (grad_dim + 1) % dim;
+  }
+  for (CeedInt e_out = 0, grad_dim = 0; e_out < num_eval_modes_out; e_out++) {
+    const bool is_grad = eval_modes_out[e_out] == CEED_EVAL_GRAD;
+
+    for (CeedInt d = 0; d < dim; d++) B_out[e_out][d] = (is_grad && d == grad_dim) ? grad_out : interp_out;
+    if (is_grad) grad_dim = (grad_dim + 1) % dim;
+  }
+
+  // Work arrays, ordered [remaining qpts][output nodes][input nodes][elem in block]
+  tmp_size = num_qpts * block_size;
+  for (CeedInt d = 0; d < dim; d++) {
+    tmp_size = CeedIntMax(tmp_size, CeedIntPow(Q, dim - d - 1) * CeedIntPow(P_out, d + 1) * CeedIntPow(P_in, d + 1) * block_size);
+  }
+  CeedCall(CeedCalloc(num_nodes_out * num_nodes_in * block_size, &elem_mat));
+  CeedCall(CeedCalloc(tmp_size, &tmp[0]));
+  CeedCall(CeedCalloc(tmp_size, &tmp[1]));
+
+  for (CeedInt e_start = 0; e_start < num_elem; e_start += block_size) {
+    const CeedInt num_elem_block = CeedIntMin(block_size, num_elem - e_start);
+
+    for (CeedInt comp_in = 0; comp_in < num_comp_in; comp_in++) {
+      for (CeedInt comp_out = 0; comp_out < num_comp_out; comp_out++) {
+        for (CeedInt i = 0; i < num_nodes_out * num_nodes_in * block_size; i++) elem_mat[i] = 0.0;
+        for (CeedInt e_in = 0; e_in < num_eval_modes_in; e_in++) {
+          for (CeedInt e_out = 0; e_out < num_eval_modes_out; e_out++) {
+            const CeedInt eval_mode_index = ((e_in * num_comp_in + comp_in) * num_eval_modes_out + e_out) * num_comp_out + comp_out;
+            const CeedInt qf_entry        = entry_map ? entry_map[eval_mode_index] : eval_mode_index;
+
+            if (qf_entry < 0) continue;
+            // Gather pointwise D for the block, padding elements are zero
+            for (CeedInt q = 0; q < num_qpts; q++) {
+              for (CeedInt b = 0; b < block_size; b++) {
+                tmp[1][q * block_size + b] =
+                    b < num_elem_block ? assembled_qf_array[q * layout_qf[0] + qf_entry * layout_qf[1] + (e_start + b) * layout_qf[2]] : 0.0;
+              }
+            }
+
+            // Contract one quadrature dimension at a time, B_out^T D B_in
+            for (CeedInt d = 0; d < dim; d++) {
+              const CeedInt     num_q_rest = CeedIntPow(Q, dim - d - 1), num_i = CeedIntPow(P_out, d), num_j = CeedIntPow(P_in, d);
+              const CeedScalar *in  = tmp[(d + 1) % 2], *B_in_d = B_in[e_in][d], *B_out_d = B_out[e_out][d];
+              CeedScalar       *out = d == dim - 1 ? elem_mat : tmp[d % 2];
+
+              if (d < dim - 1) {
+                for (CeedInt i = 0; i < num_q_rest * P_out * num_i * P_in * num_j * block_size; i++) out[i] = 0.0;
+              }
+              for (CeedInt q_rest = 0; q_rest < num_q_rest; q_rest++) {
+                for (CeedInt q = 0; q < Q; q++) {
+                  const CeedScalar *in_q = &in[(q_rest * Q + q) * num_i * num_j * block_size];
+
+                  for (CeedInt i = 0; i < P_out; i++) {
+                    for (CeedInt j = 0; j < P_in; j++) {
+                      const CeedScalar B_ij = B_out_d[q * P_out + i] * B_in_d[q * P_in + j];
+
+                      if (B_ij == 0.0) continue;
+                      for (CeedInt i_prev = 0; i_prev < num_i; i_prev++) {
+                        CeedScalar       *out_ij = &out[((q_rest * P_out + i) * num_i + i_prev) * P_in * num_j * block_size + j * num_j * block_size];
+                        const CeedScalar *in_ij  = &in_q[i_prev * num_j * block_size];
+
+                        CeedPragmaSIMD for (CeedInt k = 0; k < num_j * block_size; k++) out_ij[k] += B_ij * in_ij[k];
+                      }
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+
+        // Scatter element matrices
+        for (CeedInt b = 0; b < num_elem_block; b++) {
+          CeedScalar *vals_e =
+              &vals[(((CeedSize)(e_start + b) * num_comp_in + comp_in) * num_comp_out + comp_out) * (CeedSize)num_nodes_out * (CeedSize)num_nodes_in];
+
+          for (CeedInt i = 0; i < num_nodes_out * num_nodes_in; i++) vals_e[i] = elem_mat[i * block_size + b];
+        }
+      }
+    }
+  }
+  CeedCall(CeedFree(&elem_mat));
+  CeedCall(CeedFree(&tmp[0]));
+  CeedCall(CeedFree(&tmp[1]));
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Assemble nonzero entries for non-composite `CeedOperator`.
 
@@ -600,14 +1188,12 @@ static int CeedSingleOperatorAssemble(CeedOperator op, CeedInt offset, CeedVecto
             "Backend does not implement CeedOperatorLinearAssemble for AtPoints operator");
 
   // Assemble QFunction
-  CeedInt             layout_qf[3];
-  const CeedScalar   *assembled_qf_array;
-  CeedVector          assembled_qf        = NULL;
-  CeedElemRestriction assembled_elem_rstr = NULL;
-
-  CeedCall(CeedOperatorLinearAssembleQFunctionBuildOrUpdate(op, &assembled_qf, &assembled_elem_rstr, CEED_REQUEST_IMMEDIATE));
-  CeedCall(CeedElemRestrictionGetELayout(assembled_elem_rstr, layout_qf));
-  CeedCall(CeedElemRestrictionDestroy(&assembled_elem_rstr));
+  CeedInt           layout_qf[3];
+  const CeedInt    *entry_map;
+  const CeedScalar *assembled_qf_array;
+  CeedVector        assembled_qf = NULL;
+
+  CeedCall(CeedSingleOperatorLinearAssembleQFunctionCompressed(op, CEED_REQUEST_IMMEDIATE, &assembled_qf, layout_qf, &entry_map));
   CeedCall(CeedVectorGetArrayRead(assembled_qf, CEED_MEM_HOST, &assembled_qf_array));
 
   // Get assembly data
@@ -685,104 +1271,138 @@ static int CeedSingleOperatorAssemble(CeedOperator op, CeedInt offset, CeedVecto
   }
   local_num_entries = (CeedSize)elem_size_out * num_comp_out * elem_size_in * num_comp_in * num_elem_in;
 
+  // Check for sum factorized assembly with tensor product bases
+  bool use_tensor_assembly = false;
+
+  {
+    bool has_tensor_bases;
+
+    CeedCall(CeedOperatorHasTensorBases(op, &has_tensor_bases));
+    use_tensor_assembly = has_tensor_bases && basis_in != CEED_BASIS_NONE && basis_out != CEED_BASIS_NONE && !elem_rstr_orients_in &&
+                          !elem_rstr_orients_out && !elem_rstr_curl_orients_in && !elem_rstr_curl_orients_out;
+    if (use_tensor_assembly) {
+      CeedInt dim_in, dim_out, Q_1d_in, Q_1d_out;
+
+      CeedCall(CeedBasisGetDimension(basis_in, &dim_in));
+      CeedCall(CeedBasisGetDimension(basis_out, &dim_out));
+      CeedCall(CeedBasisGetNumQuadraturePoints1D(basis_in, &Q_1d_in));
+      CeedCall(CeedBasisGetNumQuadraturePoints1D(basis_out, &Q_1d_out));
+      use_tensor_assembly = dim_in == dim_out && Q_1d_in == Q_1d_out;
+    }
+    for (CeedInt i = 0; i < num_eval_modes_in[0]; i++) {
+      use_tensor_assembly &= eval_modes_in[0][i] == CEED_EVAL_INTERP || eval_modes_in[0][i] == CEED_EVAL_GRAD;
+    }
+    for (CeedInt i = 0; i < num_eval_modes_out[0]; i++) {
+      use_tensor_assembly &= eval_modes_out[0][i] == CEED_EVAL_INTERP || eval_modes_out[0][i] == CEED_EVAL_GRAD;
+    }
+  }
+
   // Loop over elements and put in data structure
   // We store B_mat_in, B_mat_out, BTD, elem_mat in row-major order
   CeedTensorContract contract;
   CeedScalar        *vals, *BTD_mat = NULL, *elem_mat = NULL, *elem_mat_b = NULL;
 
-  CeedCall(CeedBasisGetTensorContract(basis_in, &contract));
-  CeedCall(CeedCalloc(elem_size_out * num_qpts_in * num_eval_modes_in[0], &BTD_mat));
-  CeedCall(CeedCalloc(elem_size_out * elem_size_in, &elem_mat));
-  if (elem_rstr_curl_orients_in || elem_rstr_curl_orients_out) CeedCall(CeedCalloc(elem_size_out * elem_size_in, &elem_mat_b));
-
   CeedCall(CeedVectorGetArray(values, CEED_MEM_HOST, &vals));
-  for (CeedSize e = 0; e < num_elem_in; e++) {
-    for (CeedInt comp_in = 0; comp_in < num_comp_in; comp_in++) {
-      for (CeedInt comp_out = 0; comp_out < num_comp_out; comp_out++) {
-        // Compute B^T*D
-        for (CeedSize n = 0; n < elem_size_out; n++) {
-          for (CeedSize q = 0; q < num_qpts_in; q++) {
-            for (CeedInt e_in = 0; e_in < num_eval_modes_in[0]; e_in++) {
-              const CeedSize btd_index = n * (num_qpts_in * num_eval_modes_in[0]) + q * num_eval_modes_in[0] + e_in;
-              CeedScalar     sum       = 0.0;
-
-              for (CeedInt e_out = 0; e_out < num_eval_modes_out[0]; e_out++) {
-                const CeedSize b_out_index     = (q * num_eval_modes_out[0] + e_out) * elem_size_out + n;
-                const CeedSize eval_mode_index = ((e_in * num_comp_in + comp_in) * num_eval_modes_out[0] + e_out) * num_comp_out + comp_out;
-                const CeedSize qf_index        = q * layout_qf[0] + eval_mode_index * layout_qf[1] + e * layout_qf[2];
-
-                sum += B_mat_out[b_out_index] * assembled_qf_array[qf_index];
+  if (use_tensor_assembly) {
+    CeedCall(CeedSingleOperatorAssembleTensor(op, basis_in, basis_out, num_elem_in, num_comp_in, num_comp_out, num_eval_modes_in[0], eval_modes_in[0],
+                                              num_eval_modes_out[0], eval_modes_out[0], entry_map, layout_qf, assembled_qf_array, &vals[offset]));
+    count = local_num_entries;
+  } else {
+    CeedCall(CeedBasisGetTensorContract(basis_in, &contract));
+    CeedCall(CeedCalloc(elem_size_out * num_qpts_in * num_eval_modes_in[0], &BTD_mat));
+    CeedCall(CeedCalloc(elem_size_out * elem_size_in, &elem_mat));
+    if (elem_rstr_curl_orients_in || elem_rstr_curl_orients_out) CeedCall(CeedCalloc(elem_size_out * elem_size_in, &elem_mat_b));
+
+    for (CeedSize e = 0; e < num_elem_in; e++) {
+      for (CeedInt comp_in = 0; comp_in < num_comp_in; comp_in++) {
+        for (CeedInt comp_out = 0; comp_out < num_comp_out; comp_out++) {
+          // Compute B^T*D
+          for (CeedSize n = 0; n < elem_size_out; n++) {
+            for (CeedSize q = 0; q < num_qpts_in; q++) {
+              for (CeedInt e_in = 0; e_in < num_eval_modes_in[0]; e_in++) {
+                const CeedSize btd_index = n * (num_qpts_in * num_eval_modes_in[0]) + q * num_eval_modes_in[0] + e_in;
+                CeedScalar     sum       = 0.0;
+
+                for (CeedInt e_out = 0; e_out < num_eval_modes_out[0]; e_out++) {
+                  const CeedSize b_out_index     = (q * num_eval_modes_out[0] + e_out) * elem_size_out + n;
+                  const CeedSize eval_mode_index = ((e_in * num_comp_in + comp_in) * num_eval_modes_out[0] + e_out) * num_comp_out + comp_out;
+                  const CeedSize qf_entry        = entry_map ? entry_map[eval_mode_index] : eval_mode_index;
+                  const CeedSize qf_index        = q * layout_qf[0] + qf_entry * layout_qf[1] + e * layout_qf[2];
+
+                  if (qf_entry >= 0) sum += B_mat_out[b_out_index] * assembled_qf_array[qf_index];
+                }
+                BTD_mat[btd_index] = sum;
               }
-              BTD_mat[btd_index] = sum;
             }
           }
-        }
 
-        // Form element matrix itself (for each block component)
-        if (contract) {
-          CeedCall(CeedTensorContractApply(contract, 1, num_qpts_in * num_eval_modes_in[0], elem_size_in, elem_size_out, BTD_mat, CEED_NOTRANSPOSE,
-                                           false, B_mat_in, elem_mat));
-        } else {
-          Ceed ceed;
+          // Form element matrix itself (for each block component)
+          if (contract) {
+            CeedCall(CeedTensorContractApply(contract, 1, num_qpts_in * num_eval_modes_in[0], elem_size_in, elem_size_out, BTD_mat, CEED_NOTRANSPOSE,
+                                             false, B_mat_in, elem_mat));
+          } else {
+            Ceed ceed;
 
-          CeedCall(CeedOperatorGetCeed(op, &ceed));
-          CeedCall(CeedMatrixMatrixMultiply(ceed, BTD_mat, B_mat_in, elem_mat, elem_size_out, elem_size_in, num_qpts_in * num_eval_modes_in[0]));
-          CeedCall(CeedDestroy(&ceed));
-        }
+            CeedCall(CeedOperatorGetCeed(op, &ceed));
+            CeedCall(CeedMatrixMatrixMultiply(ceed, BTD_mat, B_mat_in, elem_mat, elem_size_out, elem_size_in, num_qpts_in * num_eval_modes_in[0]));
+            CeedCall(CeedDestroy(&ceed));
+          }
 
-        // Transform the element matrix if required
-        if (elem_rstr_orients_out) {
-          const bool *elem_orients = &elem_rstr_orients_out[e * elem_size_out];
+          // Transform the element matrix if required
+          if (elem_rstr_orients_out) {
+            const bool *elem_orients = &elem_rstr_orients_out[e * elem_size_out];
 
-          for (CeedInt i = 0; i < elem_size_out; i++) {
-            const double orient = elem_orients[i] ? -1.0 : 1.0;
+            for (CeedInt i = 0; i < elem_size_out; i++) {
+              const double orient = elem_orients[i] ? -1.0 : 1.0;
 
-            for (CeedInt j = 0; j < elem_size_in; j++) {
-              elem_mat[i * elem_size_in + j] *= orient;
+              for (CeedInt j = 0; j < elem_size_in; j++) {
+                elem_mat[i * elem_size_in + j] *= orient;
+              }
             }
-          }
-        } else if (elem_rstr_curl_orients_out) {
-          const CeedInt8 *elem_curl_orients = &elem_rstr_curl_orients_out[e * 3 * elem_size_out];
-
-          // T^T*(B^T*D*B)
-          memcpy(elem_mat_b, elem_mat, elem_size_out * elem_size_in * sizeof(CeedScalar));
-          for (CeedInt i = 0; i < elem_size_out; i++) {
-            for (CeedInt j = 0; j < elem_size_in; j++) {
-              elem_mat[i * elem_size_in + j] = elem_mat_b[i * elem_size_in + j] * elem_curl_orients[3 * i + 1] +
-                                               (i > 0 ? elem_mat_b[(i - 1) * elem_size_in + j] * elem_curl_orients[3 * i - 1] : 0.0) +
-                                               (i < elem_size_out - 1 ? elem_mat_b[(i + 1) * elem_size_in + j] * elem_curl_orients[3 * i + 3] : 0.0);
+          } else if (elem_rstr_curl_orients_out) {
+            const CeedInt8 *elem_curl_orients = &elem_rstr_curl_orients_out[e * 3 * elem_size_out];
+
+            // T^T*(B^T*D*B)
+            memcpy(elem_mat_b, elem_mat, elem_size_out * elem_size_in * sizeof(CeedScalar));
+            for (CeedInt i = 0; i < elem_size_out; i++) {
+              for (CeedInt j = 0; j < elem_size_in; j++) {
+                elem_mat[i * elem_size_in + j] =
+                    elem_mat_b[i * elem_size_in + j] * elem_curl_orients[3 * i + 1] +
+                    (i > 0 ? elem_mat_b[(i - 1) * elem_size_in + j] * elem_curl_orients[3 * i - 1] : 0.0) +
+                    (i < elem_size_out - 1 ? elem_mat_b[(i + 1) * elem_size_in + j] * elem_curl_orients[3 * i + 3] : 0.0);
+              }
             }
           }
-        }
-        if (elem_rstr_orients_in) {
-          const bool *elem_orients = &elem_rstr_orients_in[e * elem_size_in];
+          if (elem_rstr_orients_in) {
+            const bool *elem_orients = &elem_rstr_orients_in[e * elem_size_in];
 
-          for (CeedInt i = 0; i < elem_size_out; i++) {
-            for (CeedInt j = 0; j < elem_size_in; j++) {
-              elem_mat[i * elem_size_in + j] *= elem_orients[j] ? -1.0 : 1.0;
+            for (CeedInt i = 0; i < elem_size_out; i++) {
+              for (CeedInt j = 0; j < elem_size_in; j++) {
+                elem_mat[i * elem_size_in + j] *= elem_orients[j] ? -1.0 : 1.0;
+              }
+            }
+          } else if (elem_rstr_curl_orients_in) {
+            const CeedInt8 *elem_curl_orients = &elem_rstr_curl_orients_in[e * 3 * elem_size_in];
+
+            // (B^T*D*B)*T
+            memcpy(elem_mat_b, elem_mat, elem_size_out * elem_size_in * sizeof(CeedScalar));
+            for (CeedInt i = 0; i < elem_size_out; i++) {
+              for (CeedInt j = 0; j < elem_size_in; j++) {
+                elem_mat[i * elem_size_in + j] = elem_mat_b[i * elem_size_in + j] * elem_curl_orients[3 * j + 1] +
+                                                 (j > 0 ? elem_mat_b[i * elem_size_in + j - 1] * elem_curl_orients[3 * j - 1] : 0.0) +
+                                                 (j < elem_size_in - 1 ? elem_mat_b[i * elem_size_in + j + 1] * elem_curl_orients[3 * j + 3] : 0.0);
+              }
             }
           }
-        } else if (elem_rstr_curl_orients_in) {
-          const CeedInt8 *elem_curl_orients = &elem_rstr_curl_orients_in[e * 3 * elem_size_in];
 
-          // (B^T*D*B)*T
-          memcpy(elem_mat_b, elem_mat, elem_size_out * elem_size_in * sizeof(CeedScalar));
+          // Put element matrix in coordinate data structure
           for (CeedInt i = 0; i < elem_size_out; i++) {
             for (CeedInt j = 0; j < elem_size_in; j++) {
-              elem_mat[i * elem_size_in + j] = elem_mat_b[i * elem_size_in + j] * elem_curl_orients[3 * j + 1] +
-                                               (j > 0 ? elem_mat_b[i * elem_size_in + j - 1] * elem_curl_orients[3 * j - 1] : 0.0) +
-                                               (j < elem_size_in - 1 ? elem_mat_b[i * elem_size_in + j + 1] * elem_curl_orients[3 * j + 3] : 0.0);
+              vals[offset + count] = elem_mat[i * elem_size_in + j];
+              count++;
             }
           }
         }
-
-        // Put element matrix in coordinate data structure
-        for (CeedInt i = 0; i < elem_size_out; i++) {
-          for (CeedInt j = 0; j < elem_size_in; j++) {
-            vals[offset + count] = elem_mat[i * elem_size_in + j];
-            count++;
-          }
-        }
       }
     }
   }
@@ -853,6 +1473,36 @@ static int CeedSingleOperatorAssemblyCountEntries(CeedOperator op, CeedSize *num
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Create the "Scale" `CeedQFunction` used by multigrid level transfer `CeedOperator`
+
+  @param[in]  ceed        `Ceed` object used to create the `CeedQFunction`
+  @param[in]  num_comp    Number of components in the active vector
+  @param[in]  is_restrict Boolean flag indicating restriction (fine to coarse) rather than prolongation (coarse to fine)
+  @param[out] qf          Address of the variable where the newly created `CeedQFunction` will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorMultigridCreateScaleQFunction(Ceed ceed, CeedInt num_comp, bool is_restrict, CeedQFunction *qf) {
+  CeedInt             *num_comp_data;
+  CeedQFunctionContext ctx;
+
+  CeedCall(CeedQFunctionCreateInteriorByName(ceed, "Scale", qf));
+  CeedCall(CeedCalloc(1, &num_comp_data));
+  num_comp_data[0] = num_comp;
+  CeedCall(CeedQFunctionContextCreate(ceed, &ctx));
+  CeedCall(CeedQFunctionContextSetData(ctx, CEED_MEM_HOST, CEED_OWN_POINTER, sizeof(*num_comp_data), num_comp_data));
+  CeedCall(CeedQFunctionSetContext(*qf, ctx));
+  CeedCall(CeedQFunctionContextDestroy(&ctx));
+  CeedCall(CeedQFunctionAddInput(*qf, "input", num_comp, is_restrict ? CEED_EVAL_NONE : CEED_EVAL_INTERP));
+  CeedCall(CeedQFunctionAddInput(*qf, "scale", num_comp, CEED_EVAL_NONE));
+  CeedCall(CeedQFunctionAddOutput(*qf, "output", num_comp, is_restrict ? CEED_EVAL_INTERP : CEED_EVAL_NONE));
+  CeedCall(CeedQFunctionSetUserFlopsEstimate(*qf, num_comp));
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Common code for creating a multigrid coarse `CeedOperator` and level transfer `CeedOperator` for a `CeedOperator`
 
@@ -861,6 +1511,8 @@ static int CeedSingleOperatorAssemblyCountEntries(CeedOperator op, CeedSize *num
   @param[in]  rstr_coarse  Coarse grid `CeedElemRestriction`
   @param[in]  basis_coarse Coarse grid active vector `CeedBasis`
   @param[in]  basis_c_to_f `CeedBasis` for coarse to fine interpolation, or `NULL` if not creating prolongation/restriction operators
+  @param[in]  qf_restrict  Shared "Scale" `CeedQFunction` for the restriction `CeedOperator`, or `NULL` to create one
+  @param[in]  qf_prolong   Shared "Scale" `CeedQFunction` for the prolongation `CeedOperator`, or `NULL` to create one
   @param[out] op_coarse    Coarse grid `CeedOperator`
   @param[out] op_prolong   Coarse to fine `CeedOperator`, or `NULL`
   @param[out] op_restrict  Fine to coarse `CeedOperator`, or `NULL`
@@ -870,7 +1522,8 @@ static int CeedSingleOperatorAssemblyCountEntries(CeedOperator op, CeedSize *num
   @ref Developer
 **/
 static int CeedSingleOperatorMultigridLevel(CeedOperator op_fine, CeedVector p_mult_fine, CeedElemRestriction rstr_coarse, CeedBasis basis_coarse,
-                                            CeedBasis basis_c_to_f, CeedOperator *op_coarse, CeedOperator *op_prolong, CeedOperator *op_restrict) {
+                                            CeedBasis basis_c_to_f, CeedQFunction qf_restrict, CeedQFunction qf_prolong, CeedOperator *op_coarse,
+                                            CeedOperator *op_prolong, CeedOperator *op_restrict) {
   bool                is_composite;
   Ceed                ceed;
   CeedInt             num_comp, num_input_fields, num_output_fields;
@@ -988,23 +1641,11 @@ static int CeedSingleOperatorMultigridLevel(CeedOperator op_fine, CeedVector p_m
 
   // Restriction
   if (op_restrict) {
-    CeedInt             *num_comp_r_data;
-    CeedQFunctionContext ctx_r;
-    CeedQFunction        qf_restrict;
-
-    CeedCall(CeedQFunctionCreateInteriorByName(ceed, "Scale", &qf_restrict));
-    CeedCall(CeedCalloc(1, &num_comp_r_data));
-    num_comp_r_data[0] = num_comp;
-    CeedCall(CeedQFunctionContextCreate(ceed, &ctx_r));
-    CeedCall(CeedQFunctionContextSetData(ctx_r, CEED_MEM_HOST, CEED_OWN_POINTER, sizeof(*num_comp_r_data), num_comp_r_data));
-    CeedCall(CeedQFunctionSetContext(qf_restrict, ctx_r));
-    CeedCall(CeedQFunctionContextDestroy(&ctx_r));
-    CeedCall(CeedQFunctionAddInput(qf_restrict, "input", num_comp, CEED_EVAL_NONE));
-    CeedCall(CeedQFunctionAddInput(qf_restrict, "scale", num_comp, CEED_EVAL_NONE));
-    CeedCall(CeedQFunctionAddOutput(qf_restrict, "output", num_comp, CEED_EVAL_INTERP));
-    CeedCall(CeedQFunctionSetUserFlopsEstimate(qf_restrict, num_comp));
-
-    CeedCall(CeedOperatorCreate(ceed, qf_restrict, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, op_restrict));
+    CeedQFunction qf_r = NULL;
+
+    if (qf_restrict) CeedCall(CeedQFunctionReferenceCopy(qf_restrict, &qf_r));
+    else CeedCall(CeedOperatorMultigridCreateScaleQFunction(ceed, num_comp, true, &qf_r));
+    CeedCall(CeedOperatorCreate(ceed, qf_r, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, op_restrict));
     CeedCall(CeedOperatorSetField(*op_restrict, "input", rstr_fine, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE));
     CeedCall(CeedOperatorSetField(*op_restrict, "scale", rstr_p_mult_fine, CEED_BASIS_NONE, mult_vec));
     CeedCall(CeedOperatorSetField(*op_restrict, "output", rstr_coarse, basis_c_to_f, CEED_VECTOR_ACTIVE));
@@ -1021,28 +1662,16 @@ static int CeedSingleOperatorMultigridLevel(CeedOperator op_fine, CeedVector p_m
     CeedCall(CeedOperatorCheckReady(*op_restrict));
 
     // Cleanup
-    CeedCall(CeedQFunctionDestroy(&qf_restrict));
+    CeedCall(CeedQFunctionDestroy(&qf_r));
   }
 
   // Prolongation
   if (op_prolong) {
-    CeedInt             *num_comp_p_data;
-    CeedQFunctionContext ctx_p;
-    CeedQFunction        qf_prolong;
-
-    CeedCall(CeedQFunctionCreateInteriorByName(ceed, "Scale", &qf_prolong));
-    CeedCall(CeedCalloc(1, &num_comp_p_data));
-    num_comp_p_data[0] = num_comp;
-    CeedCall(CeedQFunctionContextCreate(ceed, &ctx_p));
-    CeedCall(CeedQFunctionContextSetData(ctx_p, CEED_MEM_HOST, CEED_OWN_POINTER, sizeof(*num_comp_p_data), num_comp_p_data));
-    CeedCall(CeedQFunctionSetContext(qf_prolong, ctx_p));
-    CeedCall(CeedQFunctionContextDestroy(&ctx_p));
-    CeedCall(CeedQFunctionAddInput(qf_prolong, "input", num_comp, CEED_EVAL_INTERP));
-    CeedCall(CeedQFunctionAddInput(qf_prolong, "scale", num_comp, CEED_EVAL_NONE));
-    CeedCall(CeedQFunctionAddOutput(qf_prolong, "output", num_comp, CEED_EVAL_NONE));
-    CeedCall(CeedQFunctionSetUserFlopsEstimate(qf_prolong, num_comp));
-
-    CeedCall(CeedOperatorCreate(ceed, qf_prolong, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, op_prolong));
+    CeedQFunction qf_p = NULL;
+
+    if (qf_prolong) CeedCall(CeedQFunctionReferenceCopy(qf_prolong, &qf_p));
+    else CeedCall(CeedOperatorMultigridCreateScaleQFunction(ceed, num_comp, false, &qf_p));
+    CeedCall(CeedOperatorCreate(ceed, qf_p, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, op_prolong));
     CeedCall(CeedOperatorSetField(*op_prolong, "input", rstr_coarse, basis_c_to_f, CEED_VECTOR_ACTIVE));
     CeedCall(CeedOperatorSetField(*op_prolong, "scale", rstr_p_mult_fine, CEED_BASIS_NONE, mult_vec));
     CeedCall(CeedOperatorSetField(*op_prolong, "output", rstr_fine, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE));
@@ -1059,7 +1688,7 @@ static int CeedSingleOperatorMultigridLevel(CeedOperator op_fine, CeedVector p_m
     CeedCall(CeedOperatorCheckReady(*op_prolong));
 
     // Cleanup
-    CeedCall(CeedQFunctionDestroy(&qf_prolong));
+    CeedCall(CeedQFunctionDestroy(&qf_p));
   }
 
   // Check
@@ -1263,8 +1892,9 @@ int CeedQFunctionAssemblyDataReference(CeedQFunctionAssemblyData data) {
   @ref Backend
 **/
 int CeedQFunctionAssemblyDataSetReuse(CeedQFunctionAssemblyData data, bool reuse_data) {
-  data->reuse_data        = reuse_data;
-  data->needs_data_update = true;
+  data->reuse_data              = reuse_data;
+  data->needs_data_update       = true;
+  data->needs_compressed_update = true;
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1280,6 +1910,7 @@ int CeedQFunctionAssemblyDataSetReuse(CeedQFunctionAssemblyData data, bool reuse
 **/
 int CeedQFunctionAssemblyDataSetUpdateNeeded(CeedQFunctionAssemblyData data, bool needs_data_update) {
   data->needs_data_update = needs_data_update;
+  if (needs_data_update) data->needs_compressed_update = true;
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1390,6 +2021,7 @@ int CeedQFunctionAssemblyDataDestroy(CeedQFunctionAssemblyData *data) {
   CeedCall(CeedDestroy(&(*data)->ceed));
   CeedCall(CeedVectorDestroy(&(*data)->vec));
   CeedCall(CeedElemRestrictionDestroy(&(*data)->rstr));
+  CeedCall(CeedVectorDestroy(&(*data)->vec_compressed));
 
   CeedCall(CeedFree(data));
   return CEED_ERROR_SUCCESS;
@@ -1435,8 +2067,9 @@ int CeedOperatorGetOperatorAssemblyData(CeedOperator op, CeedOperatorAssemblyDat
   @ref Backend
 **/
 int CeedOperatorAssemblyDataCreate(Ceed ceed, CeedOperator op, CeedOperatorAssemblyData *data) {
-  CeedInt             num_active_bases_in = 0, num_active_bases_out = 0, offset = 0;
+  CeedInt             num_active_bases_in = 0, num_active_bases_out = 0, offset = 0, num_input_components;
   CeedInt             num_input_fields, *num_eval_modes_in = NULL, num_output_fields, *num_eval_modes_out = NULL;
+  CeedInt            *input_component_fields = NULL, *output_component_fields = NULL;
   CeedSize          **eval_mode_offsets_in = NULL, **eval_mode_offsets_out = NULL;
   CeedEvalMode      **eval_modes_in = NULL, **eval_modes_out = NULL;
   CeedQFunctionField *qf_fields;
@@ -1500,9 +2133,11 @@ int CeedOperatorAssemblyDataCreate(Ceed ceed, CeedOperator op, CeedOperatorAssem
         // q_comp = 1 if CEED_EVAL_NONE, CEED_EVAL_WEIGHT caught by QF Assembly
         CeedCall(CeedRealloc(num_eval_modes_in[index] + q_comp, &eval_modes_in[index]));
         CeedCall(CeedRealloc(num_eval_modes_in[index] + q_comp, &eval_mode_offsets_in[index]));
+        CeedCall(CeedRealloc(offset + q_comp * num_comp, &input_component_fields));
         for (CeedInt d = 0; d < q_comp; d++) {
           eval_modes_in[index][num_eval_modes_in[index] + d]        = eval_mode;
           eval_mode_offsets_in[index][num_eval_modes_in[index] + d] = offset;
+          for (CeedInt c = 0; c < num_comp; c++) input_component_fields[offset + c] = i;
           offset += num_comp;
         }
         num_eval_modes_in[index] += q_comp;
@@ -1515,7 +2150,8 @@ int CeedOperatorAssemblyDataCreate(Ceed ceed, CeedOperator op, CeedOperatorAssem
   // Determine active output basis
   CeedCall(CeedQFunctionGetFields(qf, NULL, NULL, &num_output_fields, &qf_fields));
   CeedCall(CeedOperatorGetFields(op, NULL, NULL, NULL, &op_fields));
-  offset = 0;
+  num_input_components = offset;
+  offset               = 0;
   for (CeedInt i = 0; i < num_output_fields; i++) {
     CeedVector vec;
 
@@ -1558,9 +2194,11 @@ int CeedOperatorAssemblyDataCreate(Ceed ceed, CeedOperator op, CeedOperatorAssem
         // q_comp = 1 if CEED_EVAL_NONE, CEED_EVAL_WEIGHT caught by QF Assembly
         CeedCall(CeedRealloc(num_eval_modes_out[index] + q_comp, &eval_modes_out[index]));
         CeedCall(CeedRealloc(num_eval_modes_out[index] + q_comp, &eval_mode_offsets_out[index]));
+        CeedCall(CeedRealloc(offset + q_comp * num_comp, &output_component_fields));
         for (CeedInt d = 0; d < q_comp; d++) {
           eval_modes_out[index][num_eval_modes_out[index] + d]        = eval_mode;
           eval_mode_offsets_out[index][num_eval_modes_out[index] + d] = offset;
+          for (CeedInt c = 0; c < num_comp; c++) output_component_fields[offset + c] = i;
           offset += num_comp;
         }
         num_eval_modes_out[index] += q_comp;
@@ -1569,6 +2207,36 @@ int CeedOperatorAssemblyDataCreate(Ceed ceed, CeedOperator op, CeedOperatorAssem
     }
     CeedCall(CeedVectorDestroy(&vec));
   }
+
+  // Map assembled CeedQFunction entries to stored entries using the symmetry and zero block hints
+  {
+    bool           is_symmetric;
+    CeedInt        num_zero_blocks, num_entries = 0;
+    const CeedInt *zero_blocks;
+
+    CeedCall(CeedQFunctionIsAssemblySymmetric(qf, &is_symmetric));
+    CeedCall(CeedQFunctionGetAssemblyZeroBlocks(qf, &num_zero_blocks, &zero_blocks));
+    CeedCheck(!is_symmetric || num_input_components == offset, ceed, CEED_ERROR_INCOMPATIBLE,
+              "Symmetric CeedQFunction linearization requires the same number of active input and output components");
+    if (is_symmetric || num_zero_blocks > 0) {
+      CeedCall(CeedCalloc(num_input_components * offset, &(*data)->qf_entry_map));
+      for (CeedInt i = 0; i < num_input_components; i++) {
+        for (CeedInt j = 0; j < offset; j++) {
+          bool is_zero = false;
+
+          for (CeedInt k = 0; k < num_zero_blocks; k++) {
+            is_zero = is_zero || (zero_blocks[2 * k] == input_component_fields[i] && zero_blocks[2 * k + 1] == output_component_fields[j]);
+          }
+          if (is_symmetric && j < i) (*data)->qf_entry_map[i * offset + j] = (*data)->qf_entry_map[j * offset + i];
+          else (*data)->qf_entry_map[i * offset + j] = is_zero ? -1 : num_entries++;
+        }
+      }
+      if (num_entries == num_input_components * offset) CeedCall(CeedFree(&(*data)->qf_entry_map));
+    }
+    (*data)->num_qf_entries = (*data)->qf_entry_map ? num_entries : num_input_components * offset;
+  }
+  CeedCall(CeedFree(&input_component_fields));
+  CeedCall(CeedFree(&output_component_fields));
   CeedCall(CeedQFunctionDestroy(&qf));
   (*data)->num_active_bases_in   = num_active_bases_in;
   (*data)->num_eval_modes_in     = num_eval_modes_in;
@@ -1578,6 +2246,7 @@ int CeedOperatorAssemblyDataCreate(Ceed ceed, CeedOperator op, CeedOperatorAssem
   (*data)->num_eval_modes_out    = num_eval_modes_out;
   (*data)->eval_modes_out        = eval_modes_out;
   (*data)->eval_mode_offsets_out = eval_mode_offsets_out;
+  (*data)->num_input_components  = num_input_components;
   (*data)->num_output_components = offset;
   return CEED_ERROR_SUCCESS;
 }
@@ -1619,6 +2288,30 @@ int CeedOperatorAssemblyDataGetEvalModes(CeedOperatorAssemblyData data, CeedInt
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get map from assembled `CeedQFunction` matrix entries to stored entries for assembly.
+
+  The assembled `CeedQFunction` matrix at each quadrature point has `num_input_components` rows and `num_output_components` columns.
+  With the symmetry and zero block hints of the `CeedQFunction`, only `num_entries` of these entries are stored.
+  Entry `i * num_output_components + j` is stored at index `entry_map[i * num_output_components + j]`, or is zero if this index is negative.
+
+  @param[in]  data                 `CeedOperatorAssemblyData`
+  @param[out] num_input_components Number of rows in the assembled `CeedQFunction` matrix for each quadrature point, or `NULL`
+  @param[out] num_entries          Number of stored entries for each quadrature point, or `NULL`
+  @param[out] entry_map            Map from assembled `CeedQFunction` matrix entries to stored entries, or `NULL` if all entries are stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorAssemblyDataGetQFunctionEntries(CeedOperatorAssemblyData data, CeedInt *num_input_components, CeedInt *num_entries,
+                                                const CeedInt **entry_map) {
+  if (num_input_components) *num_input_components = data->num_input_components;
+  if (num_entries) *num_entries = data->num_qf_entries;
+  if (entry_map) *entry_map = data->qf_entry_map;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get `CeedOperator` `CeedBasis` data for assembly.
 
@@ -1812,6 +2505,7 @@ int CeedOperatorAssemblyDataDestroy(CeedOperatorAssemblyData *data) {
   CeedCall(CeedFree(&(*data)->eval_mode_offsets_out));
   CeedCall(CeedFree(&(*data)->assembled_bases_in));
   CeedCall(CeedFree(&(*data)->assembled_bases_out));
+  CeedCall(CeedFree(&(*data)->qf_entry_map));
 
   CeedCall(CeedFree(data));
   return CEED_ERROR_SUCCESS;
@@ -1915,8 +2609,11 @@ int CeedOperatorGetFallbackParentCeed(CeedOperator op, Ceed *parent) {
   @ref User
 **/
 int CeedOperatorLinearAssembleQFunction(CeedOperator op, CeedVector *assembled, CeedElemRestriction *rstr, CeedRequest *request) {
+  double trace_start;
+
   CeedCall(CeedOperatorCheckReady(op));
 
+  CeedCall(CeedTraceBegin(CeedOperatorReturnCeed(op), &trace_start));
   if (op->LinearAssembleQFunction) {
     // Backend version
     CeedCall(op->LinearAssembleQFunction(op, assembled, rstr, request));
@@ -1928,6 +2625,7 @@ int CeedOperatorLinearAssembleQFunction(CeedOperator op, CeedVector *assembled,
     if (op_fallback) CeedCall(CeedOperatorLinearAssembleQFunction(op_fallback, assembled, rstr, request));
     else return CeedError(CeedOperatorReturnCeed(op), CEED_ERROR_UNSUPPORTED, "Backend does not support CeedOperatorLinearAssembleQFunction");
   }
+  CeedCall(CeedTraceEnd(CeedOperatorReturnCeed(op), "CeedOperatorLinearAssembleQFunction", op->name, op->num_elem, trace_start));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1954,9 +2652,11 @@ int CeedOperatorLinearAssembleQFunctionBuildOrUpdate(CeedOperator op, CeedVector
   int (*LinearAssembleQFunctionUpdate)(CeedOperator, CeedVector, CeedElemRestriction, CeedRequest *) = NULL;
   CeedOperator op_assemble                                                                           = NULL;
   CeedOperator op_fallback_parent                                                                    = NULL;
+  double       trace_start;
 
   CeedCall(CeedOperatorCheckReady(op));
 
+  CeedCall(CeedTraceBegin(CeedOperatorReturnCeed(op), &trace_start));
   // Determine if fallback parent or operator has implementation
   CeedCall(CeedOperatorGetFallbackParent(op, &op_fallback_parent));
   if (op_fallback_parent && op_fallback_parent->LinearAssembleQFunctionUpdate) {
@@ -2004,6 +2704,7 @@ int CeedOperatorLinearAssembleQFunctionBuildOrUpdate(CeedOperator op, CeedVector
     if (op_fallback) CeedCall(CeedOperatorLinearAssembleQFunctionBuildOrUpdate(op_fallback, assembled, rstr, request));
     else return CeedError(CeedOperatorReturnCeed(op), CEED_ERROR_UNSUPPORTED, "Backend does not support CeedOperatorLinearAssembleQFunctionUpdate");
   }
+  CeedCall(CeedTraceEnd(CeedOperatorReturnCeed(op), "CeedOperatorLinearAssembleQFunctionBuildOrUpdate", op->name, op->num_elem, trace_start));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -2027,6 +2728,7 @@ int CeedOperatorLinearAssembleQFunctionBuildOrUpdate(CeedOperator op, CeedVector
 int CeedOperatorLinearAssembleDiagonal(CeedOperator op, CeedVector assembled, CeedRequest *request) {
   bool     is_composite;
   CeedSize input_size = 0, output_size = 0;
+  double   trace_start;
 
   CeedCall(CeedOperatorCheckReady(op));
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
@@ -2042,14 +2744,17 @@ int CeedOperatorLinearAssembleDiagonal(CeedOperator op, CeedVector assembled, Ce
     if (num_elem == 0) return CEED_ERROR_SUCCESS;
   }
 
+  CeedCall(CeedTraceBegin(CeedOperatorReturnCeed(op), &trace_start));
   if (op->LinearAssembleDiagonal) {
     // Backend version
     CeedCall(op->LinearAssembleDiagonal(op, assembled, request));
+    CeedCall(CeedTraceEnd(CeedOperatorReturnCeed(op), "CeedOperatorLinearAssembleDiagonal", op->name, op->num_elem, trace_start));
     return CEED_ERROR_SUCCESS;
   } else if (op->LinearAssembleAddDiagonal) {
     // Backend version with zeroing first
     CeedCall(CeedVectorSetValue(assembled, 0.0));
     CeedCall(op->LinearAssembleAddDiagonal(op, assembled, request));
+    CeedCall(CeedTraceEnd(CeedOperatorReturnCeed(op), "CeedOperatorLinearAssembleDiagonal", op->name, op->num_elem, trace_start));
     return CEED_ERROR_SUCCESS;
   } else {
     // Operator fallback
@@ -2058,12 +2763,14 @@ int CeedOperatorLinearAssembleDiagonal(CeedOperator op, CeedVector assembled, Ce
     CeedCall(CeedOperatorGetFallback(op, &op_fallback));
     if (op_fallback) {
       CeedCall(CeedOperatorLinearAssembleDiagonal(op_fallback, assembled, request));
+      CeedCall(CeedTraceEnd(CeedOperatorReturnCeed(op), "CeedOperatorLinearAssembleDiagonal", op->name, op->num_elem, trace_start));
       return CEED_ERROR_SUCCESS;
     }
   }
   // Default interface implementation
   CeedCall(CeedVectorSetValue(assembled, 0.0));
   CeedCall(CeedOperatorLinearAssembleAddDiagonal(op, assembled, request));
+  CeedCall(CeedTraceEnd(CeedOperatorReturnCeed(op), "CeedOperatorLinearAssembleDiagonal", op->name, op->num_elem, trace_start));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -2087,6 +2794,7 @@ int CeedOperatorLinearAssembleDiagonal(CeedOperator op, CeedVector assembled, Ce
 int CeedOperatorLinearAssembleAddDiagonal(CeedOperator op, CeedVector assembled, CeedRequest *request) {
   bool     is_composite;
   CeedSize input_size = 0, output_size = 0;
+  double   trace_start;
 
   CeedCall(CeedOperatorCheckReady(op));
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
@@ -2102,9 +2810,11 @@ int CeedOperatorLinearAssembleAddDiagonal(CeedOperator op, CeedVector assembled,
     if (num_elem == 0) return CEED_ERROR_SUCCESS;
   }
 
+  CeedCall(CeedTraceBegin(CeedOperatorReturnCeed(op), &trace_start));
   if (op->LinearAssembleAddDiagonal) {
     // Backend version
     CeedCall(op->LinearAssembleAddDiagonal(op, assembled, request));
+    CeedCall(CeedTraceEnd(CeedOperatorReturnCeed(op), "CeedOperatorLinearAssembleAddDiagonal", op->name, op->num_elem, trace_start));
     return CEED_ERROR_SUCCESS;
   } else {
     // Operator fallback
@@ -2113,6 +2823,7 @@ int CeedOperatorLinearAssembleAddDiagonal(CeedOperator op, CeedVector assembled,
     CeedCall(CeedOperatorGetFallback(op, &op_fallback));
     if (op_fallback) {
       CeedCall(CeedOperatorLinearAssembleAddDiagonal(op_fallback, assembled, request));
+      CeedCall(CeedTraceEnd(CeedOperatorReturnCeed(op), "CeedOperatorLinearAssembleAddDiagonal", op->name, op->num_elem, trace_start));
       return CEED_ERROR_SUCCESS;
     }
   }
@@ -2122,6 +2833,7 @@ int CeedOperatorLinearAssembleAddDiagonal(CeedOperator op, CeedVector assembled,
   } else {
     CeedCall(CeedSingleOperatorLinearAssembleAddDiagonal(op, request, false, assembled));
   }
+  CeedCall(CeedTraceEnd(CeedOperatorReturnCeed(op), "CeedOperatorLinearAssembleAddDiagonal", op->name, op->num_elem, trace_start));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -2251,6 +2963,7 @@ int CeedOperatorLinearAssemblePointBlockDiagonalSymbolic(CeedOperator op, CeedSi
 int CeedOperatorLinearAssemblePointBlockDiagonal(CeedOperator op, CeedVector assembled, CeedRequest *request) {
   bool     is_composite;
   CeedSize input_size = 0, output_size = 0;
+  double   trace_start;
 
   CeedCall(CeedOperatorCheckReady(op));
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
@@ -2266,14 +2979,17 @@ int CeedOperatorLinearAssemblePointBlockDiagonal(CeedOperator op, CeedVector ass
     if (num_elem == 0) return CEED_ERROR_SUCCESS;
   }
 
+  CeedCall(CeedTraceBegin(CeedOperatorReturnCeed(op), &trace_start));
   if (op->LinearAssemblePointBlockDiagonal) {
     // Backend version
     CeedCall(op->LinearAssemblePointBlockDiagonal(op, assembled, request));
+    CeedCall(CeedTraceEnd(CeedOperatorReturnCeed(op), "CeedOperatorLinearAssemblePointBlockDiagonal", op->name, op->num_elem, trace_start));
     return CEED_ERROR_SUCCESS;
   } else if (op->LinearAssembleAddPointBlockDiagonal) {
     // Backend version with zeroing first
     CeedCall(CeedVectorSetValue(assembled, 0.0));
     CeedCall(CeedOperatorLinearAssembleAddPointBlockDiagonal(op, assembled, request));
+    CeedCall(CeedTraceEnd(CeedOperatorReturnCeed(op), "CeedOperatorLinearAssemblePointBlockDiagonal", op->name, op->num_elem, trace_start));
     return CEED_ERROR_SUCCESS;
   } else {
     // Operator fallback
@@ -2282,12 +2998,14 @@ int CeedOperatorLinearAssemblePointBlockDiagonal(CeedOperator op, CeedVector ass
     CeedCall(CeedOperatorGetFallback(op, &op_fallback));
     if (op_fallback) {
       CeedCall(CeedOperatorLinearAssemblePointBlockDiagonal(op_fallback, assembled, request));
+      CeedCall(CeedTraceEnd(CeedOperatorReturnCeed(op), "CeedOperatorLinearAssemblePointBlockDiagonal", op->name, op->num_elem, trace_start));
       return CEED_ERROR_SUCCESS;
     }
   }
   // Default interface implementation
   CeedCall(CeedVectorSetValue(assembled, 0.0));
   CeedCall(CeedOperatorLinearAssembleAddPointBlockDiagonal(op, assembled, request));
+  CeedCall(CeedTraceEnd(CeedOperatorReturnCeed(op), "CeedOperatorLinearAssemblePointBlockDiagonal", op->name, op->num_elem, trace_start));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -2313,6 +3031,7 @@ int CeedOperatorLinearAssemblePointBlockDiagonal(CeedOperator op, CeedVector ass
 int CeedOperatorLinearAssembleAddPointBlockDiagonal(CeedOperator op, CeedVector assembled, CeedRequest *request) {
   bool     is_composite;
   CeedSize input_size = 0, output_size = 0;
+  double   trace_start;
 
   CeedCall(CeedOperatorCheckReady(op));
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
@@ -2328,9 +3047,11 @@ int CeedOperatorLinearAssembleAddPointBlockDiagonal(CeedOperator op, CeedVector
     if (num_elem == 0) return CEED_ERROR_SUCCESS;
   }
 
+  CeedCall(CeedTraceBegin(CeedOperatorReturnCeed(op), &trace_start));
   if (op->LinearAssembleAddPointBlockDiagonal) {
     // Backend version
     CeedCall(op->LinearAssembleAddPointBlockDiagonal(op, assembled, request));
+    CeedCall(CeedTraceEnd(CeedOperatorReturnCeed(op), "CeedOperatorLinearAssembleAddPointBlockDiagonal", op->name, op->num_elem, trace_start));
     return CEED_ERROR_SUCCESS;
   } else {
     // Operator fallback
@@ -2339,6 +3060,7 @@ int CeedOperatorLinearAssembleAddPointBlockDiagonal(CeedOperator op, CeedVector
     CeedCall(CeedOperatorGetFallback(op, &op_fallback));
     if (op_fallback) {
       CeedCall(CeedOperatorLinearAssembleAddPointBlockDiagonal(op_fallback, assembled, request));
+      CeedCall(CeedTraceEnd(CeedOperatorReturnCeed(op), "CeedOperatorLinearAssembleAddPointBlockDiagonal", op->name, op->num_elem, trace_start));
       return CEED_ERROR_SUCCESS;
     }
   }
@@ -2348,6 +3070,7 @@ int CeedOperatorLinearAssembleAddPointBlockDiagonal(CeedOperator op, CeedVector
   } else {
     CeedCall(CeedSingleOperatorLinearAssembleAddDiagonal(op, request, true, assembled));
   }
+  CeedCall(CeedTraceEnd(CeedOperatorReturnCeed(op), "CeedOperatorLinearAssembleAddPointBlockDiagonal", op->name, op->num_elem, trace_start));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -2373,16 +3096,19 @@ int CeedOperatorLinearAssembleAddPointBlockDiagonal(CeedOperator op, CeedVector
 **/
 int CeedOperatorLinearAssembleSymbolic(CeedOperator op, CeedSize *num_entries, CeedInt **rows, CeedInt **cols) {
   bool          is_composite;
-  CeedInt       num_suboperators, offset = 0;
-  CeedSize      single_entries;
+  CeedInt       num_suboperators;
+  CeedSize      single_entries, offset = 0;
   CeedOperator *sub_operators;
+  double        trace_start;
 
   CeedCall(CeedOperatorCheckReady(op));
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
 
+  CeedCall(CeedTraceBegin(CeedOperatorReturnCeed(op), &trace_start));
   if (op->LinearAssembleSymbolic) {
     // Backend version
     CeedCall(op->LinearAssembleSymbolic(op, num_entries, rows, cols));
+    CeedCall(CeedTraceEnd(CeedOperatorReturnCeed(op), "CeedOperatorLinearAssembleSymbolic", op->name, op->num_elem, trace_start));
     return CEED_ERROR_SUCCESS;
   } else {
     // Operator fallback
@@ -2391,6 +3117,7 @@ int CeedOperatorLinearAssembleSymbolic(CeedOperator op, CeedSize *num_entries, C
     CeedCall(CeedOperatorGetFallback(op, &op_fallback));
     if (op_fallback) {
       CeedCall(CeedOperatorLinearAssembleSymbolic(op_fallback, num_entries, rows, cols));
+      CeedCall(CeedTraceEnd(CeedOperatorReturnCeed(op), "CeedOperatorLinearAssembleSymbolic", op->name, op->num_elem, trace_start));
       return CEED_ERROR_SUCCESS;
     }
   }
@@ -2418,13 +3145,78 @@ int CeedOperatorLinearAssembleSymbolic(CeedOperator op, CeedSize *num_entries, C
     CeedCall(CeedCompositeOperatorGetNumSub(op, &num_suboperators));
     CeedCall(CeedCompositeOperatorGetSubList(op, &sub_operators));
     for (CeedInt k = 0; k < num_suboperators; ++k) {
-      CeedCall(CeedSingleOperatorAssembleSymbolic(sub_operators[k], offset, *rows, *cols));
+      CeedCall(CeedSingleOperatorAssembleSymbolic(sub_operators[k], offset, *rows, *cols, NULL, NULL));
+      CeedCall(CeedSingleOperatorAssemblyCountEntries(sub_operators[k], &single_entries));
+      offset += single_entries;
+    }
+  } else {
+    CeedCall(CeedSingleOperatorAssembleSymbolic(op, offset, *rows, *cols, NULL, NULL));
+  }
+  CeedCall(CeedTraceEnd(CeedOperatorReturnCeed(op), "CeedOperatorLinearAssembleSymbolic", op->name, op->num_elem, trace_start));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+   @brief Fully assemble the nonzero pattern of a linear `CeedOperator` with `CeedSize` indices.
+
+   This is equivalent to @ref CeedOperatorLinearAssembleSymbolic(), but the row and column numbers are stored as `CeedSize`.
+   Use this variant when the active vector lengths exceed the range of `CeedInt`.
+
+   Note: Calling this function asserts that setup is complete and sets the `CeedOperator` as immutable.
+
+   @param[in]  op          `CeedOperator` to assemble
+   @param[out] num_entries Number of entries in coordinate nonzero pattern
+   @param[out] rows        Row number for each entry
+   @param[out] cols        Column number for each entry
+
+   @ref User
+**/
+int CeedOperatorLinearAssembleSymbolicCeedSize(CeedOperator op, CeedSize *num_entries, CeedSize **rows, CeedSize **cols) {
+  bool          is_composite;
+  CeedInt       num_suboperators;
+  CeedSize      single_entries, offset = 0;
+  CeedOperator *sub_operators, op_fallback;
+  double        trace_start;
+
+  CeedCall(CeedOperatorCheckReady(op));
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+
+  CeedCall(CeedTraceBegin(CeedOperatorReturnCeed(op), &trace_start));
+  // Operator fallback
+  CeedCall(CeedOperatorGetFallback(op, &op_fallback));
+  if (op_fallback) {
+    CeedCall(CeedOperatorLinearAssembleSymbolicCeedSize(op_fallback, num_entries, rows, cols));
+    CeedCall(CeedTraceEnd(CeedOperatorReturnCeed(op), "CeedOperatorLinearAssembleSymbolicCeedSize", op->name, op->num_elem, trace_start));
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Count entries and allocate rows, cols arrays
+  *num_entries = 0;
+  if (is_composite) {
+    CeedCall(CeedCompositeOperatorGetNumSub(op, &num_suboperators));
+    CeedCall(CeedCompositeOperatorGetSubList(op, &sub_operators));
+    for (CeedInt k = 0; k < num_suboperators; ++k) {
+      CeedCall(CeedSingleOperatorAssemblyCountEntries(sub_operators[k], &single_entries));
+      *num_entries += single_entries;
+    }
+  } else {
+    CeedCall(CeedSingleOperatorAssemblyCountEntries(op, &single_entries));
+    *num_entries += single_entries;
+  }
+  CeedCall(CeedCalloc(*num_entries, rows));
+  CeedCall(CeedCalloc(*num_entries, cols));
+
+  // Assemble nonzero locations
+  if (is_composite) {
+    for (CeedInt k = 0; k < num_suboperators; ++k) {
+      CeedCall(CeedSingleOperatorAssembleSymbolic(sub_operators[k], offset, NULL, NULL, *rows, *cols));
       CeedCall(CeedSingleOperatorAssemblyCountEntries(sub_operators[k], &single_entries));
       offset += single_entries;
     }
   } else {
-    CeedCall(CeedSingleOperatorAssembleSymbolic(op, offset, *rows, *cols));
+    CeedCall(CeedSingleOperatorAssembleSymbolic(op, offset, NULL, NULL, *rows, *cols));
   }
+  CeedCall(CeedTraceEnd(CeedOperatorReturnCeed(op), "CeedOperatorLinearAssembleSymbolicCeedSize", op->name, op->num_elem, trace_start));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -2451,6 +3243,7 @@ int CeedOperatorLinearAssemble(CeedOperator op, CeedVector values) {
   CeedInt       num_suboperators, offset = 0;
   CeedSize      single_entries = 0;
   CeedOperator *sub_operators;
+  double        trace_start;
 
   CeedCall(CeedOperatorCheckReady(op));
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
@@ -2463,9 +3256,11 @@ int CeedOperatorLinearAssemble(CeedOperator op, CeedVector values) {
     if (num_elem == 0) return CEED_ERROR_SUCCESS;
   }
 
+  CeedCall(CeedTraceBegin(CeedOperatorReturnCeed(op), &trace_start));
   if (op->LinearAssemble) {
     // Backend version
     CeedCall(op->LinearAssemble(op, values));
+    CeedCall(CeedTraceEnd(CeedOperatorReturnCeed(op), "CeedOperatorLinearAssemble", op->name, op->num_elem, trace_start));
     return CEED_ERROR_SUCCESS;
   } else {
     // Operator fallback
@@ -2474,6 +3269,7 @@ int CeedOperatorLinearAssemble(CeedOperator op, CeedVector values) {
     CeedCall(CeedOperatorGetFallback(op, &op_fallback));
     if (op_fallback) {
       CeedCall(CeedOperatorLinearAssemble(op_fallback, values));
+      CeedCall(CeedTraceEnd(CeedOperatorReturnCeed(op), "CeedOperatorLinearAssemble", op->name, op->num_elem, trace_start));
       return CEED_ERROR_SUCCESS;
     }
   }
@@ -2491,6 +3287,7 @@ int CeedOperatorLinearAssemble(CeedOperator op, CeedVector values) {
   } else {
     CeedCall(CeedSingleOperatorAssemble(op, offset, values));
   }
+  CeedCall(CeedTraceEnd(CeedOperatorReturnCeed(op), "CeedOperatorLinearAssemble", op->name, op->num_elem, trace_start));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -2601,7 +3398,8 @@ int CeedOperatorMultigridLevelCreate(CeedOperator op_fine, CeedVector p_mult_fin
   }
 
   // Core code
-  CeedCall(CeedSingleOperatorMultigridLevel(op_fine, p_mult_fine, rstr_coarse, basis_coarse, basis_c_to_f, op_coarse, op_prolong, op_restrict));
+  CeedCall(CeedSingleOperatorMultigridLevel(op_fine, p_mult_fine, rstr_coarse, basis_coarse, basis_c_to_f, NULL, NULL, op_coarse, op_prolong,
+                                            op_restrict));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -2666,7 +3464,8 @@ int CeedOperatorMultigridLevelCreateTensorH1(CeedOperator op_fine, CeedVector p_
   }
 
   // Core code
-  CeedCall(CeedSingleOperatorMultigridLevel(op_fine, p_mult_fine, rstr_coarse, basis_coarse, basis_c_to_f, op_coarse, op_prolong, op_restrict));
+  CeedCall(CeedSingleOperatorMultigridLevel(op_fine, p_mult_fine, rstr_coarse, basis_coarse, basis_c_to_f, NULL, NULL, op_coarse, op_prolong,
+                                            op_restrict));
   CeedCall(CeedDestroy(&ceed));
   return CEED_ERROR_SUCCESS;
 }
@@ -2730,7 +3529,71 @@ int CeedOperatorMultigridLevelCreateH1(CeedOperator op_fine, CeedVector p_mult_f
   }
 
   // Core code
-  CeedCall(CeedSingleOperatorMultigridLevel(op_fine, p_mult_fine, rstr_coarse, basis_coarse, basis_c_to_f, op_coarse, op_prolong, op_restrict));
+  CeedCall(CeedSingleOperatorMultigridLevel(op_fine, p_mult_fine, rstr_coarse, basis_coarse, basis_c_to_f, NULL, NULL, op_coarse, op_prolong,
+                                            op_restrict));
+  CeedCall(CeedDestroy(&ceed));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Create a full p-multigrid hierarchy of coarse `CeedOperator` and level transfer `CeedOperator` for a `CeedOperator` in one pass.
+
+  Levels are ordered from finest to coarsest; level `i` coarsens `op_fine` for `i = 0` and `ops_coarse[i - 1]` otherwise.
+  The prolongation bases are created from the fine and coarse grid interpolation of each level.
+  All coarse `CeedOperator` share the `CeedQFunction` assembly data of `op_fine`, so the `CeedQFunction` is assembled at most once for the hierarchy.
+  All level transfer `CeedOperator` share a single pair of "Scale" `CeedQFunction`.
+
+  Note: Calling this function asserts that setup is complete and sets all `CeedOperator` in the hierarchy as immutable.
+
+  @param[in]  op_fine       Fine grid `CeedOperator`
+  @param[in]  num_levels    Number of coarse levels to create
+  @param[in]  p_mult        Array of `num_levels` fine grid L-vector multiplicities in parallel gather/scatter, or `NULL` if no transfer operators
+  @param[in]  rstrs_coarse  Array of `num_levels` coarse grid `CeedElemRestriction`
+  @param[in]  bases_coarse  Array of `num_levels` coarse grid active vector `CeedBasis`
+  @param[out] ops_coarse    Array of `num_levels` coarse grid `CeedOperator`
+  @param[out] ops_prolong   Array of `num_levels` coarse to fine `CeedOperator`, or `NULL`
+  @param[out] ops_restrict  Array of `num_levels` fine to coarse `CeedOperator`, or `NULL`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorMultigridHierarchyCreate(CeedOperator op_fine, CeedInt num_levels, const CeedVector *p_mult, const CeedElemRestriction *rstrs_coarse,
+                                         const CeedBasis *bases_coarse, CeedOperator *ops_coarse, CeedOperator *ops_prolong,
+                                         CeedOperator *ops_restrict) {
+  Ceed          ceed;
+  CeedInt       num_comp;
+  CeedBasis     basis_fine;
+  CeedQFunction qf_restrict = NULL, qf_prolong = NULL;
+
+  CeedCall(CeedOperatorCheckReady(op_fine));
+  CeedCall(CeedOperatorGetCeed(op_fine, &ceed));
+  CeedCheck(num_levels > 0, ceed, CEED_ERROR_DIMENSION, "Multigrid hierarchy requires at least one coarse level");
+  CeedCheck(p_mult || (!ops_prolong && !ops_restrict), ceed, CEED_ERROR_INCOMPATIBLE,
+            "Prolongation or restriction operator creation requires fine grid multiplicity vectors");
+
+  // Shared level transfer QFunctions
+  CeedCall(CeedBasisGetNumComponents(bases_coarse[0], &num_comp));
+  if (ops_restrict) CeedCall(CeedOperatorMultigridCreateScaleQFunction(ceed, num_comp, true, &qf_restrict));
+  if (ops_prolong) CeedCall(CeedOperatorMultigridCreateScaleQFunction(ceed, num_comp, false, &qf_prolong));
+
+  // Build levels from finest to coarsest
+  CeedCall(CeedOperatorGetActiveBasis(op_fine, &basis_fine));
+  for (CeedInt i = 0; i < num_levels; i++) {
+    CeedBasis basis_c_to_f = NULL;
+
+    if (ops_prolong || ops_restrict) CeedCall(CeedBasisCreateProjection(bases_coarse[i], basis_fine, &basis_c_to_f));
+    CeedCall(CeedSingleOperatorMultigridLevel(i == 0 ? op_fine : ops_coarse[i - 1], p_mult ? p_mult[i] : NULL, rstrs_coarse[i], bases_coarse[i],
+                                              basis_c_to_f, qf_restrict, qf_prolong, &ops_coarse[i], ops_prolong ? &ops_prolong[i] : NULL,
+                                              ops_restrict ? &ops_restrict[i] : NULL));
+    CeedCall(CeedBasisDestroy(&basis_fine));
+    CeedCall(CeedBasisReferenceCopy(bases_coarse[i], &basis_fine));
+  }
+
+  // Cleanup
+  CeedCall(CeedBasisDestroy(&basis_fine));
+  CeedCall(CeedQFunctionDestroy(&qf_restrict));
+  CeedCall(CeedQFunctionDestroy(&qf_prolong));
   CeedCall(CeedDestroy(&ceed));
   return CEED_ERROR_SUCCESS;
 }
@@ -2741,6 +3604,8 @@ int CeedOperatorMultigridLevelCreateH1(CeedOperator op_fine, CeedVector p_mult_f
   This returns a `CeedOperator` and `CeedVector` to apply a Fast Diagonalization Method based approximate inverse.
   This function obtains the simultaneous diagonalization for the 1D mass and Laplacian operators, \f$M = V^T V, K = V^T S V\f$.
   The assembled `CeedQFunction` is used to modify the eigenvalues from simultaneous diagonalization and obtain an approximate inverse of the form \f$V^T \hat S V\f$.
+  The assembled `CeedQFunction` diagonal is averaged per element and component for the mass term and each direction of the stiffness term.
+  The inverse is therefore exact, up to the Laplacian perturbation, for affine rectangular elements of any aspect ratio.
   The `CeedOperator` must be linear and non-composite.
   The associated `CeedQFunction` must therefore also be linear.
 
@@ -2758,11 +3623,11 @@ int CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdm_inv,
   Ceed                 ceed, ceed_parent;
   bool                 interp = false, grad = false, is_tensor_basis = true;
   CeedInt              num_input_fields, P_1d, Q_1d, num_nodes, num_qpts, dim, num_comp = 1, num_elem = 1;
-  CeedScalar          *mass, *laplace, *x, *fdm_interp, *lambda, *elem_avg;
+  CeedScalar          *mass, *laplace, *x, *fdm_interp, *lambda;
   const CeedScalar    *interp_1d, *grad_1d, *q_weight_1d;
   CeedVector           q_data;
   CeedElemRestriction  rstr  = NULL, rstr_qd_i;
-  CeedBasis            basis = NULL, fdm_basis;
+  CeedBasis            basis = NULL, fdm_basis, coeff_basis;
   CeedQFunctionContext ctx_fdm;
   CeedQFunctionField  *qf_fields;
   CeedQFunction        qf, qf_fdm;
@@ -2840,92 +3705,114 @@ int CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdm_inv,
   }
   CeedCall(CeedFree(&x));
 
+  // Build FDM scaling coefficients
+  // -- For each element and component, the assembled QFunction diagonal is averaged separately for the mass term and for each direction of the
+  //      stiffness term, giving the FDM diagonal m + sum_d a_d lambda_{i_d} for anisotropic elements
   {
-    CeedInt             layout[3], num_modes = (interp ? 1 : 0) + (grad ? dim : 0);
-    CeedScalar          max_norm = 0;
-    const CeedScalar   *assembled_array, *q_weight_array;
-    CeedVector          assembled = NULL, q_weight;
-    CeedElemRestriction rstr_qf   = NULL;
+    CeedInt                  layout[3], num_coeffs = 1 << dim, *num_eval_modes_in, *num_eval_modes_out;
+    CeedSize                 num_output_components, **eval_mode_offsets_in, **eval_mode_offsets_out;
+    CeedScalar               max_norm = 0, *q_data_array;
+    const CeedScalar        *assembled_array, *q_weight_array;
+    const CeedEvalMode     **eval_modes_in, **eval_modes_out;
+    CeedVector               assembled = NULL, q_weight;
+    CeedElemRestriction      rstr_qf   = NULL;
+    CeedOperatorAssemblyData data;
 
     // Assemble QFunction
     CeedCall(CeedOperatorLinearAssembleQFunctionBuildOrUpdate(op, &assembled, &rstr_qf, request));
     CeedCall(CeedElemRestrictionGetELayout(rstr_qf, layout));
     CeedCall(CeedElemRestrictionDestroy(&rstr_qf));
     CeedCall(CeedVectorNorm(assembled, CEED_NORM_MAX, &max_norm));
+    CeedCall(CeedOperatorGetOperatorAssemblyData(op, &data));
+    CeedCall(CeedOperatorAssemblyDataGetEvalModes(data, NULL, &num_eval_modes_in, &eval_modes_in, &eval_mode_offsets_in, NULL, &num_eval_modes_out,
+                                                  &eval_modes_out, &eval_mode_offsets_out, &num_output_components));
+
+    // Diagonal QFunction entries for the mass term, k = 0, and the stiffness term in each direction, k = 1 + d
+    CeedInt  num_terms = 0, term_kind[1 + dim];
+    CeedSize term_in[1 + dim], term_out[1 + dim];
+
+    for (CeedInt i = 0, d_in = 0; i < num_eval_modes_in[0]; i++) {
+      const CeedInt kind = eval_modes_in[0][i] == CEED_EVAL_INTERP ? 0 : eval_modes_in[0][i] == CEED_EVAL_GRAD ? 1 + d_in++ : -1;
+
+      if (kind < 0) continue;
+      for (CeedInt j = 0, d_out = 0; j < num_eval_modes_out[0]; j++) {
+        const CeedInt kind_out = eval_modes_out[0][j] == CEED_EVAL_INTERP ? 0 : eval_modes_out[0][j] == CEED_EVAL_GRAD ? 1 + d_out++ : -1;
+
+        if (kind_out != kind) continue;
+        term_kind[num_terms] = kind;
+        term_in[num_terms]   = eval_mode_offsets_in[0][i];
+        term_out[num_terms]  = eval_mode_offsets_out[0][j];
+        num_terms++;
+        break;
+      }
+    }
 
-    // Calculate element averages
+    // Calculate element and component coefficients
     CeedCall(CeedVectorCreate(ceed_parent, num_qpts, &q_weight));
     CeedCall(CeedBasisApply(basis, 1, CEED_NOTRANSPOSE, CEED_EVAL_WEIGHT, CEED_VECTOR_NONE, q_weight));
     CeedCall(CeedVectorGetArrayRead(assembled, CEED_MEM_HOST, &assembled_array));
     CeedCall(CeedVectorGetArrayRead(q_weight, CEED_MEM_HOST, &q_weight_array));
-    CeedCall(CeedCalloc(num_elem, &elem_avg));
-    const CeedScalar qf_value_bound = max_norm * 100 * CEED_EPSILON;
+    CeedCall(CeedVectorCreate(ceed_parent, (CeedSize)num_elem * num_comp * num_coeffs, &q_data));
+    CeedCall(CeedVectorSetValue(q_data, 0.0));
+    CeedCall(CeedVectorGetArray(q_data, CEED_MEM_HOST, &q_data_array));
+    const CeedScalar qf_value_bound = max_norm * 100 * CEED_EPSILON, fdm_diagonal_bound = num_nodes * CEED_EPSILON;
 
     for (CeedInt e = 0; e < num_elem; e++) {
-      CeedInt count = 0;
+      for (CeedInt c = 0; c < num_comp; c++) {
+        CeedInt    total_count = 0;
+        CeedScalar coeff[1 + dim], max_coeff = 0.0, *elem_coeffs = &q_data_array[(e * num_comp + c) * num_coeffs];
 
-      for (CeedInt q = 0; q < num_qpts; q++) {
-        for (CeedInt i = 0; i < num_comp * num_comp * num_modes * num_modes; i++) {
-          if (fabs(assembled_array[q * layout[0] + i * layout[1] + e * layout[2]]) > qf_value_bound) {
-            elem_avg[e] += assembled_array[q * layout[0] + i * layout[1] + e * layout[2]] / q_weight_array[q];
-            count++;
+        for (CeedInt k = 0; k < 1 + dim; k++) coeff[k] = 0.0;
+        for (CeedInt t = 0; t < num_terms; t++) {
+          const CeedSize entry = (term_in[t] + c) * num_output_components + term_out[t] + c;
+          CeedInt        count = 0;
+          CeedScalar     sum   = 0.0;
+
+          for (CeedInt q = 0; q < num_qpts; q++) {
+            const CeedScalar value = assembled_array[q * layout[0] + entry * layout[1] + e * layout[2]];
+
+            if (fabs(value) > qf_value_bound) {
+              sum += value / q_weight_array[q];
+              count++;
+            }
           }
+          if (count) coeff[term_kind[t]] = sum / count;
+          total_count += count;
         }
-      }
-      if (count) {
-        elem_avg[e] /= count;
-      } else {
-        elem_avg[e] = 1.0;
+        if (!total_count) {
+          coeff[0] = interp ? 1.0 : 0.0;
+          for (CeedInt d = 0; d < dim; d++) coeff[1 + d] = grad ? 1.0 : 0.0;
+        }
+        for (CeedInt k = 0; k < 1 + dim; k++) max_coeff = fmax(max_coeff, fabs(coeff[k]));
+        // Mass coefficient bounded away from zero for the null space of the stiffness term
+        elem_coeffs[0] = coeff[0] + fdm_diagonal_bound * max_coeff;
+        for (CeedInt d = 0; d < dim; d++) elem_coeffs[1 << d] = coeff[1 + d];
       }
     }
+    CeedCall(CeedVectorRestoreArray(q_data, &q_data_array));
     CeedCall(CeedVectorRestoreArrayRead(assembled, &assembled_array));
     CeedCall(CeedVectorDestroy(&assembled));
     CeedCall(CeedVectorRestoreArrayRead(q_weight, &q_weight_array));
     CeedCall(CeedVectorDestroy(&q_weight));
   }
 
-  // Build FDM diagonal
-  {
-    CeedScalar *q_data_array, *fdm_diagonal;
-
-    CeedCall(CeedCalloc(num_comp * num_nodes, &fdm_diagonal));
-    const CeedScalar fdm_diagonal_bound = num_nodes * CEED_EPSILON;
-    for (CeedInt c = 0; c < num_comp; c++) {
-      for (CeedInt n = 0; n < num_nodes; n++) {
-        if (interp) fdm_diagonal[c * num_nodes + n] = 1.0;
-        if (grad) {
-          for (CeedInt d = 0; d < dim; d++) {
-            CeedInt i = (n / CeedIntPow(P_1d, d)) % P_1d;
-            fdm_diagonal[c * num_nodes + n] += lambda[i];
-          }
-        }
-        if (fabs(fdm_diagonal[c * num_nodes + n]) < fdm_diagonal_bound) fdm_diagonal[c * num_nodes + n] = fdm_diagonal_bound;
-      }
-    }
-    CeedCall(CeedVectorCreate(ceed_parent, num_elem * num_comp * num_nodes, &q_data));
-    CeedCall(CeedVectorSetValue(q_data, 0.0));
-    CeedCall(CeedVectorGetArrayWrite(q_data, CEED_MEM_HOST, &q_data_array));
-    for (CeedInt e = 0; e < num_elem; e++) {
-      for (CeedInt c = 0; c < num_comp; c++) {
-        for (CeedInt n = 0; n < num_nodes; n++) {
-          q_data_array[(e * num_comp + c) * num_nodes + n] = 1. / (elem_avg[e] * fdm_diagonal[c * num_nodes + n]);
-        }
-      }
-    }
-    CeedCall(CeedFree(&elem_avg));
-    CeedCall(CeedFree(&fdm_diagonal));
-    CeedCall(CeedVectorRestoreArray(q_data, &q_data_array));
-  }
-
   // Setup FDM operator
-  // -- Basis
+  // -- Bases
   {
-    CeedScalar *grad_dummy, *q_ref_dummy, *q_weight_dummy;
+    CeedScalar *grad_dummy, *q_ref_dummy, *q_weight_dummy, *coeff_interp;
 
     CeedCall(CeedCalloc(P_1d * P_1d, &grad_dummy));
     CeedCall(CeedCalloc(P_1d, &q_ref_dummy));
     CeedCall(CeedCalloc(P_1d, &q_weight_dummy));
     CeedCall(CeedBasisCreateTensorH1(ceed_parent, dim, num_comp, P_1d, P_1d, fdm_interp, grad_dummy, q_ref_dummy, q_weight_dummy, &fdm_basis));
+    // ---- Coefficient basis evaluates m + sum_d a_d lambda_{i_d} from the 2^dim coefficients with 1D interpolation rows [1, lambda_i]
+    CeedCall(CeedCalloc(2 * P_1d, &coeff_interp));
+    for (CeedInt i = 0; i < P_1d; i++) {
+      coeff_interp[i * 2 + 0] = 1.0;
+      coeff_interp[i * 2 + 1] = lambda[i];
+    }
+    CeedCall(CeedBasisCreateTensorH1(ceed_parent, dim, num_comp, 2, P_1d, coeff_interp, grad_dummy, q_ref_dummy, q_weight_dummy, &coeff_basis));
+    CeedCall(CeedFree(&coeff_interp));
     CeedCall(CeedFree(&fdm_interp));
     CeedCall(CeedFree(&grad_dummy));
     CeedCall(CeedFree(&q_ref_dummy));
@@ -2935,15 +3822,17 @@ int CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdm_inv,
 
   // -- Restriction
   {
-    CeedInt strides[3] = {1, num_nodes, num_nodes * num_comp};
-    CeedCall(CeedElemRestrictionCreateStrided(ceed_parent, num_elem, num_nodes, num_comp,
-                                              (CeedSize)num_elem * (CeedSize)num_comp * (CeedSize)num_nodes, strides, &rstr_qd_i));
+    const CeedInt num_coeffs = 1 << dim;
+    CeedInt       strides[3] = {1, num_coeffs, num_coeffs * num_comp};
+
+    CeedCall(CeedElemRestrictionCreateStrided(ceed_parent, num_elem, num_coeffs, num_comp,
+                                              (CeedSize)num_elem * (CeedSize)num_comp * (CeedSize)num_coeffs, strides, &rstr_qd_i));
   }
 
   // -- QFunction
-  CeedCall(CeedQFunctionCreateInteriorByName(ceed_parent, "Scale", &qf_fdm));
+  CeedCall(CeedQFunctionCreateInteriorByName(ceed_parent, "ScaleInverse", &qf_fdm));
   CeedCall(CeedQFunctionAddInput(qf_fdm, "input", num_comp, CEED_EVAL_INTERP));
-  CeedCall(CeedQFunctionAddInput(qf_fdm, "scale", num_comp, CEED_EVAL_NONE));
+  CeedCall(CeedQFunctionAddInput(qf_fdm, "scale", num_comp, CEED_EVAL_INTERP));
   CeedCall(CeedQFunctionAddOutput(qf_fdm, "output", num_comp, CEED_EVAL_INTERP));
   CeedCall(CeedQFunctionSetUserFlopsEstimate(qf_fdm, num_comp));
 
@@ -2962,7 +3851,7 @@ int CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdm_inv,
   // -- Operator
   CeedCall(CeedOperatorCreate(ceed_parent, qf_fdm, NULL, NULL, fdm_inv));
   CeedCall(CeedOperatorSetField(*fdm_inv, "input", rstr, fdm_basis, CEED_VECTOR_ACTIVE));
-  CeedCall(CeedOperatorSetField(*fdm_inv, "scale", rstr_qd_i, CEED_BASIS_NONE, q_data));
+  CeedCall(CeedOperatorSetField(*fdm_inv, "scale", rstr_qd_i, coeff_basis, q_data));
   CeedCall(CeedOperatorSetField(*fdm_inv, "output", rstr, fdm_basis, CEED_VECTOR_ACTIVE));
 
   // Cleanup
@@ -2973,6 +3862,7 @@ int CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdm_inv,
   CeedCall(CeedElemRestrictionDestroy(&rstr_qd_i));
   CeedCall(CeedBasisDestroy(&basis));
   CeedCall(CeedBasisDestroy(&fdm_basis));
+  CeedCall(CeedBasisDestroy(&coeff_basis));
   CeedCall(CeedQFunctionDestroy(&qf));
   CeedCall(CeedQFunctionDestroy(&qf_fdm));
   return CEED_ERROR_SUCCESS;
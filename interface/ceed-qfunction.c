@@ -156,6 +156,21 @@ int CeedQFunctionSetFortranStatus(CeedQFunction qf, bool status) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get flag indicating if Fortran interface is used
+
+  @param[in]  qf         CeedQFunction
+  @param[out] is_fortran Variable to store Fortran status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedQFunctionGetFortranStatus(CeedQFunction qf, bool *is_fortran) {
+  *is_fortran = qf->is_fortran;
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -508,6 +523,38 @@ int CeedQFunctionIsContextWritable(CeedQFunction qf, bool *is_writable) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Determine if the linearization of a `CeedQFunction` is symmetric
+
+  @param[in]  qf           `CeedQFunction`
+  @param[out] is_symmetric Variable to store symmetry status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedQFunctionIsAssemblySymmetric(CeedQFunction qf, bool *is_symmetric) {
+  *is_symmetric = qf->is_assembly_symmetric;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the input and output field pairs with zero linearization for a `CeedQFunction`
+
+  @param[in]  qf              `CeedQFunction`
+  @param[out] num_zero_blocks Variable to store number of field pairs
+  @param[out] zero_blocks     Variable to store field pairs, ordered `[pair][input field index, output field index]`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedQFunctionGetAssemblyZeroBlocks(CeedQFunction qf, CeedInt *num_zero_blocks, const CeedInt **zero_blocks) {
+  if (num_zero_blocks) *num_zero_blocks = qf->num_assembly_zero_blocks;
+  if (zero_blocks) *zero_blocks = qf->assembly_zero_blocks;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get backend data of a `CeedQFunction`
 
@@ -976,6 +1023,60 @@ int CeedQFunctionSetUserFlopsEstimate(CeedQFunction qf, CeedSize flops) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Indicate that the linearization of a `CeedQFunction` is symmetric.
+
+  The assembled `CeedQFunction` matrix at each quadrature point, from the active input components to the active output components, must be symmetric.
+  Operator diagonal and full assembly then store only the upper triangle of this matrix.
+  This must be set before the first assembly of any `CeedOperator` using this `CeedQFunction`.
+
+  @param[in,out] qf           `CeedQFunction`
+  @param[in]     is_symmetric Boolean flag for symmetry of the linearization
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedQFunctionSetAssemblySymmetric(CeedQFunction qf, bool is_symmetric) {
+  qf->is_assembly_symmetric = is_symmetric;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Indicate that an output field of a `CeedQFunction` does not depend on an input field.
+
+  The block of the assembled `CeedQFunction` matrix coupling these fields is zero at every quadrature point and is not stored by operator diagonal
+  and full assembly.
+  This must be set before the first assembly of any `CeedOperator` using this `CeedQFunction`.
+
+  @param[in,out] qf                `CeedQFunction`
+  @param[in]     input_field_name  Name of input field
+  @param[in]     output_field_name Name of output field
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedQFunctionSetAssemblyZeroBlock(CeedQFunction qf, const char *input_field_name, const char *output_field_name) {
+  CeedInt input_index = -1, output_index = -1;
+
+  for (CeedInt i = 0; i < qf->num_input_fields; i++) {
+    if (!strcmp(input_field_name, qf->input_fields[i]->field_name)) input_index = i;
+  }
+  CeedCheck(input_index != -1, CeedQFunctionReturnCeed(qf), CEED_ERROR_INCOMPLETE, "CeedQFunction has no knowledge of input field '%s'",
+            input_field_name);
+  for (CeedInt i = 0; i < qf->num_output_fields; i++) {
+    if (!strcmp(output_field_name, qf->output_fields[i]->field_name)) output_index = i;
+  }
+  CeedCheck(output_index != -1, CeedQFunctionReturnCeed(qf), CEED_ERROR_INCOMPLETE, "CeedQFunction has no knowledge of output field '%s'",
+            output_field_name);
+  CeedCall(CeedRealloc(2 * (qf->num_assembly_zero_blocks + 1), &qf->assembly_zero_blocks));
+  qf->assembly_zero_blocks[2 * qf->num_assembly_zero_blocks + 0] = input_index;
+  qf->assembly_zero_blocks[2 * qf->num_assembly_zero_blocks + 1] = output_index;
+  qf->num_assembly_zero_blocks++;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief View a `CeedQFunction`
 
@@ -1047,13 +1148,16 @@ Ceed CeedQFunctionReturnCeed(CeedQFunction qf) { return qf->ceed; }
 **/
 int CeedQFunctionApply(CeedQFunction qf, CeedInt Q, CeedVector *u, CeedVector *v) {
   CeedInt vec_length;
+  double  trace_start;
 
   CeedCheck(qf->Apply, CeedQFunctionReturnCeed(qf), CEED_ERROR_UNSUPPORTED, "Backend does not support CeedQFunctionApply");
   CeedCall(CeedQFunctionGetVectorLength(qf, &vec_length));
   CeedCheck(Q % vec_length == 0, CeedQFunctionReturnCeed(qf), CEED_ERROR_DIMENSION,
             "Number of quadrature points %" CeedInt_FMT " must be a multiple of %" CeedInt_FMT, Q, qf->vec_length);
   CeedCall(CeedQFunctionSetImmutable(qf));
+  CeedCall(CeedTraceBegin(CeedQFunctionReturnCeed(qf), &trace_start));
   CeedCall(qf->Apply(qf, Q, u, v));
+  CeedCall(CeedTraceEnd(CeedQFunctionReturnCeed(qf), "CeedQFunctionApply", NULL, Q, trace_start));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1086,6 +1190,7 @@ int CeedQFunctionDestroy(CeedQFunction *qf) {
   }
   CeedCall(CeedFree(&(*qf)->input_fields));
   CeedCall(CeedFree(&(*qf)->output_fields));
+  CeedCall(CeedFree(&(*qf)->assembly_zero_blocks));
 
   // User context data object
   CeedCall(CeedQFunctionContextDestroy(&(*qf)->ctx));
@@ -59,6 +59,14 @@ const char *const CeedContextFieldTypes[] = {
     [CEED_CONTEXT_FIELD_BOOL]   = "bool",
 };
 
+const char *const CeedOperatorPhases[] = {
+    [CEED_OPERATOR_PHASE_INPUT_RESTRICTION]  = "input restriction",
+    [CEED_OPERATOR_PHASE_INPUT_BASIS]        = "input basis",
+    [CEED_OPERATOR_PHASE_QFUNCTION]          = "QFunction",
+    [CEED_OPERATOR_PHASE_OUTPUT_BASIS]       = "output basis",
+    [CEED_OPERATOR_PHASE_OUTPUT_RESTRICTION] = "output restriction",
+};
+
 const char *const CeedFESpaces[] = {
     [CEED_FE_SPACE_H1]    = "H^1 space",
     [CEED_FE_SPACE_HDIV]  = "H(div) space",
@@ -213,6 +213,7 @@ int CeedVectorReferenceCopy(CeedVector vec, CeedVector *vec_copy) {
 int CeedVectorCopy(CeedVector vec, CeedVector vec_copy) {
   CeedMemType mem_type, mem_type_copy;
   CeedScalar *array;
+  double      trace_start;
 
   // Get the preferred memory types
   {
@@ -239,11 +240,13 @@ int CeedVectorCopy(CeedVector vec, CeedVector vec_copy) {
     CeedCheck(length_vec == length_copy, CeedVectorReturnCeed(vec), CEED_ERROR_INCOMPATIBLE, "CeedVectors must have the same length to copy");
   }
 
+  CeedCall(CeedTraceBegin(CeedVectorReturnCeed(vec), &trace_start));
   // Copy the values from vec to vec_copy
   CeedCall(CeedVectorGetArray(vec, mem_type, &array));
   CeedCall(CeedVectorSetArray(vec_copy, mem_type, CEED_COPY_VALUES, array));
 
   CeedCall(CeedVectorRestoreArray(vec, &array));
+  CeedCall(CeedTraceEnd(CeedVectorReturnCeed(vec), "CeedVectorCopy", NULL, vec->length, trace_start));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -338,10 +341,13 @@ int CeedVectorSetArray(CeedVector vec, CeedMemType mem_type, CeedCopyMode copy_m
   @ref User
 **/
 int CeedVectorSetValue(CeedVector vec, CeedScalar value) {
+  double trace_start;
+
   CeedCheck(vec->state % 2 == 0, CeedVectorReturnCeed(vec), CEED_ERROR_ACCESS,
             "Cannot grant CeedVector array access, the access lock is already in use");
   CeedCheck(vec->num_readers == 0, CeedVectorReturnCeed(vec), CEED_ERROR_ACCESS, "Cannot grant CeedVector array access, a process has read access");
 
+  CeedCall(CeedTraceBegin(CeedVectorReturnCeed(vec), &trace_start));
   if (vec->SetValue) {
     CeedCall(vec->SetValue(vec, value));
     vec->state += 2;
@@ -354,6 +360,7 @@ int CeedVectorSetValue(CeedVector vec, CeedScalar value) {
     for (CeedSize i = 0; i < length; i++) array[i] = value;
     CeedCall(CeedVectorRestoreArray(vec, &array));
   }
+  CeedCall(CeedTraceEnd(CeedVectorReturnCeed(vec), "CeedVectorSetValue", NULL, vec->length, trace_start));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -640,6 +647,7 @@ int CeedVectorRestoreArrayRead(CeedVector vec, const CeedScalar **array) {
 int CeedVectorNorm(CeedVector vec, CeedNormType norm_type, CeedScalar *norm) {
   bool     has_valid_array = true;
   CeedSize length;
+  double   trace_start;
 
   CeedCall(CeedVectorHasValidArray(vec, &has_valid_array));
   CeedCheck(has_valid_array, CeedVectorReturnCeed(vec), CEED_ERROR_BACKEND,
@@ -651,9 +659,11 @@ int CeedVectorNorm(CeedVector vec, CeedNormType norm_type, CeedScalar *norm) {
     return CEED_ERROR_SUCCESS;
   }
 
+  CeedCall(CeedTraceBegin(CeedVectorReturnCeed(vec), &trace_start));
   // Backend impl for GPU, if added
   if (vec->Norm) {
     CeedCall(vec->Norm(vec, norm_type, norm));
+    CeedCall(CeedTraceEnd(CeedVectorReturnCeed(vec), "CeedVectorNorm", NULL, vec->length, trace_start));
     return CEED_ERROR_SUCCESS;
   }
 
@@ -682,6 +692,7 @@ int CeedVectorNorm(CeedVector vec, CeedNormType norm_type, CeedScalar *norm) {
   if (norm_type == CEED_NORM_2) *norm = sqrt(*norm);
 
   CeedCall(CeedVectorRestoreArrayRead(vec, &array));
+  CeedCall(CeedTraceEnd(CeedVectorReturnCeed(vec), "CeedVectorNorm", NULL, vec->length, trace_start));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -699,6 +710,7 @@ int CeedVectorScale(CeedVector x, CeedScalar alpha) {
   bool        has_valid_array = true;
   CeedSize    length;
   CeedScalar *x_array = NULL;
+  double      trace_start;
 
   CeedCall(CeedVectorHasValidArray(x, &has_valid_array));
   CeedCheck(has_valid_array, CeedVectorReturnCeed(x), CEED_ERROR_BACKEND,
@@ -708,14 +720,20 @@ int CeedVectorScale(CeedVector x, CeedScalar alpha) {
   CeedCall(CeedVectorGetLength(x, &length));
   if (length == 0) return CEED_ERROR_SUCCESS;
 
+  CeedCall(CeedTraceBegin(CeedVectorReturnCeed(x), &trace_start));
   // Backend implementation
-  if (x->Scale) return x->Scale(x, alpha);
+  if (x->Scale) {
+    CeedCall(x->Scale(x, alpha));
+    CeedCall(CeedTraceEnd(CeedVectorReturnCeed(x), "CeedVectorScale", NULL, x->length, trace_start));
+    return CEED_ERROR_SUCCESS;
+  }
 
   // Default implementation
   CeedCall(CeedVectorGetArray(x, CEED_MEM_HOST, &x_array));
   assert(x_array);
   for (CeedSize i = 0; i < length; i++) x_array[i] *= alpha;
   CeedCall(CeedVectorRestoreArray(x, &x_array));
+  CeedCall(CeedTraceEnd(CeedVectorReturnCeed(x), "CeedVectorScale", NULL, x->length, trace_start));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -735,6 +753,7 @@ int CeedVectorAXPY(CeedVector y, CeedScalar alpha, CeedVector x) {
   CeedSize          length_x, length_y;
   CeedScalar       *y_array = NULL;
   CeedScalar const *x_array = NULL;
+  double            trace_start;
 
   CeedCall(CeedVectorGetLength(y, &length_y));
   CeedCall(CeedVectorGetLength(x, &length_x));
@@ -769,9 +788,11 @@ int CeedVectorAXPY(CeedVector y, CeedScalar alpha, CeedVector x) {
   // Return early for empty vectors
   if (length_y == 0) return CEED_ERROR_SUCCESS;
 
+  CeedCall(CeedTraceBegin(CeedVectorReturnCeed(y), &trace_start));
   // Backend implementation
   if (y->AXPY) {
     CeedCall(y->AXPY(y, alpha, x));
+    CeedCall(CeedTraceEnd(CeedVectorReturnCeed(y), "CeedVectorAXPY", NULL, y->length, trace_start));
     return CEED_ERROR_SUCCESS;
   }
 
@@ -786,6 +807,7 @@ int CeedVectorAXPY(CeedVector y, CeedScalar alpha, CeedVector x) {
 
   CeedCall(CeedVectorRestoreArray(y, &y_array));
   CeedCall(CeedVectorRestoreArrayRead(x, &x_array));
+  CeedCall(CeedTraceEnd(CeedVectorReturnCeed(y), "CeedVectorAXPY", NULL, y->length, trace_start));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -806,6 +828,7 @@ int CeedVectorAXPBY(CeedVector y, CeedScalar alpha, CeedScalar beta, CeedVector
   CeedSize          length_x, length_y;
   CeedScalar       *y_array = NULL;
   CeedScalar const *x_array = NULL;
+  double            trace_start;
 
   CeedCall(CeedVectorGetLength(y, &length_y));
   CeedCall(CeedVectorGetLength(x, &length_x));
@@ -840,9 +863,11 @@ int CeedVectorAXPBY(CeedVector y, CeedScalar alpha, CeedScalar beta, CeedVector
   // Return early for empty vectors
   if (length_y == 0) return CEED_ERROR_SUCCESS;
 
+  CeedCall(CeedTraceBegin(CeedVectorReturnCeed(y), &trace_start));
   // Backend implementation
   if (y->AXPBY) {
     CeedCall(y->AXPBY(y, alpha, beta, x));
+    CeedCall(CeedTraceEnd(CeedVectorReturnCeed(y), "CeedVectorAXPBY", NULL, y->length, trace_start));
     return CEED_ERROR_SUCCESS;
   }
 
@@ -857,6 +882,128 @@ int CeedVectorAXPBY(CeedVector y, CeedScalar alpha, CeedScalar beta, CeedVector
 
   CeedCall(CeedVectorRestoreArray(y, &y_array));
   CeedCall(CeedVectorRestoreArrayRead(x, &x_array));
+  CeedCall(CeedTraceEnd(CeedVectorReturnCeed(y), "CeedVectorAXPBY", NULL, y->length, trace_start));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Compute `y = alpha x + beta y` and the norm of the updated `y` in one pass
+
+  This fused operation reads each `CeedVector` once on backends that implement it, such as for the residual update in a Krylov iteration.
+
+  Note: This operation is local to the `CeedVector`, see @ref CeedVectorNorm().
+
+  @param[in,out] y         target `CeedVector` for sum
+  @param[in]     alpha     first scaling factor
+  @param[in]     beta      second scaling factor
+  @param[in]     x         second `CeedVector`, must be different than `y`
+  @param[in]     norm_type Norm type @ref CEED_NORM_1, @ref CEED_NORM_2, or @ref CEED_NORM_MAX
+  @param[out]    norm      Variable to store norm value of the updated `y`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorAXPBYNorm(CeedVector y, CeedScalar alpha, CeedScalar beta, CeedVector x, CeedNormType norm_type, CeedScalar *norm) {
+  CeedSize length_x, length_y;
+  double   trace_start;
+
+  CeedCall(CeedVectorGetLength(y, &length_y));
+  CeedCall(CeedVectorGetLength(x, &length_x));
+  CeedCheck(length_x == length_y, CeedVectorReturnCeed(y), CEED_ERROR_UNSUPPORTED,
+            "Cannot add vector of different lengths."
+            " x length: %" CeedSize_FMT " y length: %" CeedSize_FMT,
+            length_x, length_y);
+  CeedCheck(x != y, CeedVectorReturnCeed(y), CEED_ERROR_UNSUPPORTED, "Cannot use same vector for x and y in CeedVectorAXPBYNorm");
+
+  CeedCall(CeedTraceBegin(CeedVectorReturnCeed(y), &trace_start));
+  // Backend implementation
+  if (y->AXPBYNorm && length_y > 0) {
+    bool has_valid_array_x = true, has_valid_array_y = true;
+
+    CeedCall(CeedVectorHasValidArray(x, &has_valid_array_x));
+    CeedCheck(has_valid_array_x, CeedVectorReturnCeed(y), CEED_ERROR_BACKEND,
+              "CeedVector x has no valid data, must set data with CeedVectorSetValue or CeedVectorSetArray");
+    CeedCall(CeedVectorHasValidArray(y, &has_valid_array_y));
+    CeedCheck(has_valid_array_y, CeedVectorReturnCeed(y), CEED_ERROR_BACKEND,
+              "CeedVector y has no valid data, must set data with CeedVectorSetValue or CeedVectorSetArray");
+    CeedCall(y->AXPBYNorm(y, alpha, beta, x, norm_type, norm));
+    CeedCall(CeedTraceEnd(CeedVectorReturnCeed(y), "CeedVectorAXPBYNorm", NULL, y->length, trace_start));
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Default implementation
+  CeedCall(CeedVectorAXPBY(y, alpha, beta, x));
+  CeedCall(CeedVectorNorm(y, norm_type, norm));
+  CeedCall(CeedTraceEnd(CeedVectorReturnCeed(y), "CeedVectorAXPBYNorm", NULL, y->length, trace_start));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Compute the dot products `dots[i] = x . vecs[i]` for several `CeedVector` in one pass over `x`
+
+  Note: This operation is local to the `CeedVector`, see @ref CeedVectorNorm().
+
+  @param[in]  x        `CeedVector` shared by all dot products
+  @param[in]  num_vecs Number of `CeedVector` in `vecs`
+  @param[in]  vecs     Array of `CeedVector` with the same length as `x`
+  @param[out] dots     Array of `num_vecs` dot products
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorMDot(CeedVector x, CeedInt num_vecs, CeedVector *vecs, CeedScalar *dots) {
+  bool              has_valid_array_x = true;
+  CeedSize          length_x;
+  const CeedScalar *x_array;
+  double            trace_start;
+
+  CeedCall(CeedVectorGetLength(x, &length_x));
+  CeedCall(CeedVectorHasValidArray(x, &has_valid_array_x));
+  CeedCheck(has_valid_array_x, CeedVectorReturnCeed(x), CEED_ERROR_BACKEND,
+            "CeedVector x has no valid data, must set data with CeedVectorSetValue or CeedVectorSetArray");
+  for (CeedInt v = 0; v < num_vecs; v++) {
+    bool     has_valid_array_v = true;
+    CeedSize length_v;
+
+    CeedCall(CeedVectorGetLength(vecs[v], &length_v));
+    CeedCheck(length_v == length_x, CeedVectorReturnCeed(x), CEED_ERROR_UNSUPPORTED,
+              "Cannot compute dot product of vectors of different lengths."
+              " x length: %" CeedSize_FMT " vecs[%" CeedInt_FMT "] length: %" CeedSize_FMT,
+              length_x, v, length_v);
+    CeedCall(CeedVectorHasValidArray(vecs[v], &has_valid_array_v));
+    CeedCheck(has_valid_array_v, CeedVectorReturnCeed(x), CEED_ERROR_BACKEND,
+              "CeedVector vecs[%" CeedInt_FMT "] has no valid data, must set data with CeedVectorSetValue or CeedVectorSetArray", v);
+    dots[v] = 0.0;
+  }
+
+  // Return early for empty vectors
+  if (length_x == 0 || num_vecs == 0) return CEED_ERROR_SUCCESS;
+
+  CeedCall(CeedTraceBegin(CeedVectorReturnCeed(x), &trace_start));
+  // Backend implementation
+  if (x->MDot) {
+    CeedCall(x->MDot(x, num_vecs, vecs, dots));
+    CeedCall(CeedTraceEnd(CeedVectorReturnCeed(x), "CeedVectorMDot", NULL, x->length, trace_start));
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Default implementation
+  CeedCall(CeedVectorGetArrayRead(x, CEED_MEM_HOST, &x_array));
+  for (CeedInt v = 0; v < num_vecs; v++) {
+    const CeedScalar *v_array;
+
+    if (vecs[v] == x) {
+      v_array = x_array;
+    } else {
+      CeedCall(CeedVectorGetArrayRead(vecs[v], CEED_MEM_HOST, &v_array));
+    }
+    for (CeedSize i = 0; i < length_x; i++) dots[v] += x_array[i] * v_array[i];
+    if (vecs[v] != x) CeedCall(CeedVectorRestoreArrayRead(vecs[v], &v_array));
+  }
+  CeedCall(CeedVectorRestoreArrayRead(x, &x_array));
+  CeedCall(CeedTraceEnd(CeedVectorReturnCeed(x), "CeedVectorMDot", NULL, x->length, trace_start));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -878,6 +1025,7 @@ int CeedVectorPointwiseMult(CeedVector w, CeedVector x, CeedVector y) {
   CeedScalar       *w_array = NULL;
   CeedScalar const *x_array = NULL, *y_array = NULL;
   CeedSize          length_w, length_x, length_y;
+  double            trace_start;
 
   CeedCall(CeedVectorGetLength(w, &length_w));
   CeedCall(CeedVectorGetLength(x, &length_x));
@@ -916,9 +1064,11 @@ int CeedVectorPointwiseMult(CeedVector w, CeedVector x, CeedVector y) {
   // Return early for empty vectors
   if (length_w == 0) return CEED_ERROR_SUCCESS;
 
+  CeedCall(CeedTraceBegin(CeedVectorReturnCeed(w), &trace_start));
   // Backend implementation
   if (w->PointwiseMult) {
     CeedCall(w->PointwiseMult(w, x, y));
+    CeedCall(CeedTraceEnd(CeedVectorReturnCeed(w), "CeedVectorPointwiseMult", NULL, w->length, trace_start));
     return CEED_ERROR_SUCCESS;
   }
 
@@ -950,6 +1100,7 @@ int CeedVectorPointwiseMult(CeedVector w, CeedVector x, CeedVector y) {
   if (y != w && y != x) CeedCall(CeedVectorRestoreArrayRead(y, &y_array));
   if (x != w) CeedCall(CeedVectorRestoreArrayRead(x, &x_array));
   CeedCall(CeedVectorRestoreArray(w, &w_array));
+  CeedCall(CeedTraceEnd(CeedVectorReturnCeed(w), "CeedVectorPointwiseMult", NULL, w->length, trace_start));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -966,6 +1117,7 @@ int CeedVectorReciprocal(CeedVector vec) {
   bool        has_valid_array = true;
   CeedSize    length;
   CeedScalar *array;
+  double      trace_start;
 
   CeedCall(CeedVectorHasValidArray(vec, &has_valid_array));
   CeedCheck(has_valid_array, CeedVectorReturnCeed(vec), CEED_ERROR_BACKEND,
@@ -978,9 +1130,11 @@ int CeedVectorReciprocal(CeedVector vec) {
   CeedCall(CeedVectorGetLength(vec, &length));
   if (length == 0) return CEED_ERROR_SUCCESS;
 
+  CeedCall(CeedTraceBegin(CeedVectorReturnCeed(vec), &trace_start));
   // Backend impl for GPU, if added
   if (vec->Reciprocal) {
     CeedCall(vec->Reciprocal(vec));
+    CeedCall(CeedTraceEnd(CeedVectorReturnCeed(vec), "CeedVectorReciprocal", NULL, vec->length, trace_start));
     return CEED_ERROR_SUCCESS;
   }
 
@@ -990,6 +1144,7 @@ int CeedVectorReciprocal(CeedVector vec) {
   }
 
   CeedCall(CeedVectorRestoreArray(vec, &array));
+  CeedCall(CeedTraceEnd(CeedVectorReturnCeed(vec), "CeedVectorReciprocal", NULL, vec->length, trace_start));
   return CEED_ERROR_SUCCESS;
 }
 
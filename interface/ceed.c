@@ -16,6 +16,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 /// @cond DOXYGEN_SKIP
 static CeedRequest ceed_request_immediate;
@@ -93,8 +94,12 @@ CeedRequest *const CEED_REQUEST_ORDERED = &ceed_request_ordered;
   @ref User
 **/
 int CeedRequestWait(CeedRequest *req) {
+  int ierr;
+
   if (!*req) return CEED_ERROR_SUCCESS;
-  return CeedError(NULL, CEED_ERROR_UNSUPPORTED, "CeedRequestWait not implemented");
+  ierr = (*req)->Wait(*req);
+  CeedCall(CeedFree(req));
+  return ierr;
 }
 
 /// @}
@@ -170,11 +175,70 @@ static int CeedWorkVectorsDestroy(Ceed ceed) {
     ceed->ref_count -= 1;  // Note: restore ref_count
   }
   CeedCall(CeedFree(&ceed->work_vectors->is_in_use));
+  CeedCall(CeedFree(&ceed->work_vectors->lengths));
+  CeedCall(CeedFree(&ceed->work_vectors->last_use));
   CeedCall(CeedFree(&ceed->work_vectors->vecs));
   CeedCall(CeedFree(&ceed->work_vectors));
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Remove an inactive work vector from the work vector space of a `ceed`
+
+  @param[in,out] ceed `Ceed` context
+  @param[in]     i    Index of work vector to remove, the last work vector is moved to this index
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedWorkVectorsRemove(Ceed ceed, CeedInt i) {
+  CeedWorkVectors work_vectors = ceed->work_vectors;
+  const CeedInt   last         = work_vectors->num_vecs - 1;
+
+  ceed->ref_count += 2;  // Note: increase ref_count to prevent Ceed destructor from triggering
+  CeedCall(CeedVectorDestroy(&work_vectors->vecs[i]));
+  ceed->ref_count -= 1;  // Note: restore ref_count
+  work_vectors->total_len -= work_vectors->lengths[i];
+
+  // Move last work vector into the gap
+  work_vectors->vecs[i]         = work_vectors->vecs[last];
+  work_vectors->is_in_use[i]    = work_vectors->is_in_use[last];
+  work_vectors->lengths[i]      = work_vectors->lengths[last];
+  work_vectors->last_use[i]     = work_vectors->last_use[last];
+  work_vectors->vecs[last]      = NULL;
+  work_vectors->is_in_use[last] = false;
+  work_vectors->num_vecs--;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Evict least recently used inactive work vectors until `len` more entries fit in the memory limit of a `ceed`
+
+  @param[in,out] ceed `Ceed` context
+  @param[in]     len  Length of work vector to be added
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedWorkVectorsEvict(Ceed ceed, CeedSize len) {
+  CeedWorkVectors work_vectors = ceed->work_vectors;
+
+  if (work_vectors->max_len == 0) return CEED_ERROR_SUCCESS;
+  while (work_vectors->total_len + len > work_vectors->max_len) {
+    CeedInt lru = -1;
+
+    for (CeedInt i = 0; i < work_vectors->num_vecs; i++) {
+      if (!work_vectors->is_in_use[i] && (lru == -1 || work_vectors->last_use[i] < work_vectors->last_use[lru])) lru = i;
+    }
+    // Vectors that are checked out cannot be evicted, so the limit may be exceeded
+    if (lru == -1) break;
+    CeedCall(CeedWorkVectorsRemove(ceed, lru));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -829,18 +893,55 @@ int CeedReference(Ceed ceed) {
 int CeedGetWorkVectorMemoryUsage(Ceed ceed, CeedScalar *usage_mb) {
   *usage_mb = 0.0;
   if (ceed->work_vectors) {
-    for (CeedInt i = 0; i < ceed->work_vectors->num_vecs; i++) {
-      CeedSize vec_len;
-      CeedCall(CeedVectorGetLength(ceed->work_vectors->vecs[i], &vec_len));
-      *usage_mb += vec_len;
-    }
-    *usage_mb *= sizeof(CeedScalar) * 1e-6;
+    *usage_mb = ceed->work_vectors->total_len * sizeof(CeedScalar) * 1e-6;
     CeedDebug(ceed, "Resource {%s}: Work vectors memory usage: %" CeedInt_FMT " vectors, %g MB\n", ceed->resource, ceed->work_vectors->num_vecs,
               *usage_mb);
   }
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get reuse statistics of the work vectors in a `Ceed` context.
+
+  @param[in]  ceed          `Ceed` context
+  @param[out] num_hits      Variable to store number of @ref CeedGetWorkVector() calls served by an existing work vector, or `NULL`
+  @param[out] num_misses    Variable to store number of @ref CeedGetWorkVector() calls that created a new work vector, or `NULL`
+  @param[out] peak_usage_mb Variable to store peak memory usage of the work vectors in MB, or `NULL`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedGetWorkVectorStatistics(Ceed ceed, CeedSize *num_hits, CeedSize *num_misses, CeedScalar *peak_usage_mb) {
+  const bool has_work_vectors = ceed->work_vectors;
+
+  if (num_hits) *num_hits = has_work_vectors ? ceed->work_vectors->num_hits : 0;
+  if (num_misses) *num_misses = has_work_vectors ? ceed->work_vectors->num_misses : 0;
+  if (peak_usage_mb) *peak_usage_mb = has_work_vectors ? ceed->work_vectors->peak_len * sizeof(CeedScalar) * 1e-6 : 0.0;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Limit the memory held by the work vectors in a `Ceed` context.
+
+  When a new work vector would exceed the limit, the least recently used inactive work vectors are destroyed first.
+  Work vectors that are checked out are never destroyed, so the limit can be exceeded while they are in use.
+
+  @param[in,out] ceed     `Ceed` context
+  @param[in]     limit_mb Memory limit in MB, or 0 for no limit
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedSetWorkVectorMemoryLimit(Ceed ceed, CeedScalar limit_mb) {
+  CeedCheck(limit_mb >= 0.0, ceed, CEED_ERROR_MINOR, "Work vector memory limit must be non-negative, got %g MB", limit_mb);
+  if (!ceed->work_vectors) CeedCall(CeedWorkVectorsCreate(ceed));
+  ceed->work_vectors->max_len = (CeedSize)(limit_mb * 1e6 / sizeof(CeedScalar) + 0.5);
+  CeedCall(CeedWorkVectorsEvict(ceed, 0));
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Clear inactive work vectors in a `Ceed` context below a minimum length.
 
@@ -854,21 +955,9 @@ int CeedGetWorkVectorMemoryUsage(Ceed ceed, CeedScalar *usage_mb) {
 int CeedClearWorkVectors(Ceed ceed, CeedSize min_len) {
   if (!ceed->work_vectors) return CEED_ERROR_SUCCESS;
   for (CeedInt i = 0; i < ceed->work_vectors->num_vecs; i++) {
-    if (ceed->work_vectors->is_in_use[i]) continue;
-    CeedSize vec_len;
-    CeedCall(CeedVectorGetLength(ceed->work_vectors->vecs[i], &vec_len));
-    if (vec_len < min_len) {
-      ceed->ref_count += 2;  // Note: increase ref_count to prevent Ceed destructor from triggering
-      CeedCall(CeedVectorDestroy(&ceed->work_vectors->vecs[i]));
-      ceed->ref_count -= 1;  // Note: restore ref_count
-      ceed->work_vectors->num_vecs--;
-      if (ceed->work_vectors->num_vecs > 0) {
-        ceed->work_vectors->vecs[i]                                 = ceed->work_vectors->vecs[ceed->work_vectors->num_vecs];
-        ceed->work_vectors->is_in_use[i]                            = ceed->work_vectors->is_in_use[ceed->work_vectors->num_vecs];
-        ceed->work_vectors->is_in_use[ceed->work_vectors->num_vecs] = false;
-        i--;
-      }
-    }
+    if (ceed->work_vectors->is_in_use[i] || ceed->work_vectors->lengths[i] >= min_len) continue;
+    CeedCall(CeedWorkVectorsRemove(ceed, i));
+    i--;
   }
   return CEED_ERROR_SUCCESS;
 }
@@ -887,40 +976,50 @@ int CeedClearWorkVectors(Ceed ceed, CeedSize min_len) {
   @ref Backend
 **/
 int CeedGetWorkVector(Ceed ceed, CeedSize len, CeedVector *vec) {
-  CeedInt    i = 0;
-  CeedScalar usage_mb;
+  CeedInt         i = -1;
+  CeedScalar      usage_mb;
+  CeedWorkVectors work_vectors;
 
   if (!ceed->work_vectors) CeedCall(CeedWorkVectorsCreate(ceed));
+  work_vectors = ceed->work_vectors;
 
-  // Search for big enough work vector
-  for (i = 0; i < ceed->work_vectors->num_vecs; i++) {
-    if (!ceed->work_vectors->is_in_use[i]) {
-      CeedSize work_len;
-
-      CeedCall(CeedVectorGetLength(ceed->work_vectors->vecs[i], &work_len));
-      if (work_len >= len) break;
-    }
+  // Search for the shortest long enough work vector
+  for (CeedInt j = 0; j < work_vectors->num_vecs; j++) {
+    if (!work_vectors->is_in_use[j] && work_vectors->lengths[j] >= len && (i == -1 || work_vectors->lengths[j] < work_vectors->lengths[i])) i = j;
   }
-  // Long enough vector was not found
-  if (i == ceed->work_vectors->num_vecs) {
-    if (ceed->work_vectors->max_vecs == 0) {
-      ceed->work_vectors->max_vecs = 1;
-      CeedCall(CeedCalloc(ceed->work_vectors->max_vecs, &ceed->work_vectors->vecs));
-      CeedCall(CeedCalloc(ceed->work_vectors->max_vecs, &ceed->work_vectors->is_in_use));
-    } else if (ceed->work_vectors->max_vecs == i) {
-      ceed->work_vectors->max_vecs *= 2;
-      CeedCall(CeedRealloc(ceed->work_vectors->max_vecs, &ceed->work_vectors->vecs));
-      CeedCall(CeedRealloc(ceed->work_vectors->max_vecs, &ceed->work_vectors->is_in_use));
+  if (i != -1) {
+    work_vectors->num_hits++;
+  } else {
+    // Long enough vector was not found
+    work_vectors->num_misses++;
+    CeedCall(CeedWorkVectorsEvict(ceed, len));
+    i = work_vectors->num_vecs;
+    if (work_vectors->max_vecs == 0) {
+      work_vectors->max_vecs = 1;
+      CeedCall(CeedCalloc(work_vectors->max_vecs, &work_vectors->vecs));
+      CeedCall(CeedCalloc(work_vectors->max_vecs, &work_vectors->is_in_use));
+      CeedCall(CeedCalloc(work_vectors->max_vecs, &work_vectors->lengths));
+      CeedCall(CeedCalloc(work_vectors->max_vecs, &work_vectors->last_use));
+    } else if (work_vectors->max_vecs == i) {
+      work_vectors->max_vecs *= 2;
+      CeedCall(CeedRealloc(work_vectors->max_vecs, &work_vectors->vecs));
+      CeedCall(CeedRealloc(work_vectors->max_vecs, &work_vectors->is_in_use));
+      CeedCall(CeedRealloc(work_vectors->max_vecs, &work_vectors->lengths));
+      CeedCall(CeedRealloc(work_vectors->max_vecs, &work_vectors->last_use));
     }
-    ceed->work_vectors->num_vecs++;
-    CeedCallBackend(CeedVectorCreate(ceed, len, &ceed->work_vectors->vecs[i]));
+    work_vectors->num_vecs++;
+    CeedCallBackend(CeedVectorCreate(ceed, len, &work_vectors->vecs[i]));
     ceed->ref_count--;  // Note: ref_count manipulation to prevent a ref-loop
+    work_vectors->lengths[i] = len;
+    work_vectors->total_len += len;
+    if (work_vectors->total_len > work_vectors->peak_len) work_vectors->peak_len = work_vectors->total_len;
     if (ceed->is_debug) CeedGetWorkVectorMemoryUsage(ceed, &usage_mb);
   }
   // Return pointer to work vector
-  ceed->work_vectors->is_in_use[i] = true;
-  *vec                             = NULL;
-  CeedCall(CeedVectorReferenceCopy(ceed->work_vectors->vecs[i], vec));
+  work_vectors->is_in_use[i] = true;
+  work_vectors->last_use[i]  = ++work_vectors->num_checkouts;
+  *vec                       = NULL;
+  CeedCall(CeedVectorReferenceCopy(work_vectors->vecs[i], vec));
   ceed->ref_count++;  // Note: bump ref_count to account for external access
   return CEED_ERROR_SUCCESS;
 }
@@ -1038,6 +1137,70 @@ int CeedRestoreJitDefines(Ceed ceed, const char ***jit_defines) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get the current wall time, for timing libCEED calls
+
+  @param[out] time Wall time in seconds, from an arbitrary fixed starting point
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedGetWallTime(double *time) {
+#if defined(__unix__) || defined(__APPLE__)
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  *time = ts.tv_sec + 1e-9 * ts.tv_nsec;
+#else
+  *time = (double)clock() / CLOCKS_PER_SEC;
+#endif
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Start timing an event for a tracing backend, such as `/cpu/self/trace`.
+
+  The `Ceed` context and its parents are searched for a backend recording events, so objects created through a delegate are traced.
+
+  @param[in]  ceed  `Ceed` context of the object the event acts on
+  @param[out] start Wall time in seconds the event started, or `-1` if no backend records events
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedTraceBegin(Ceed ceed, double *start) {
+  while (ceed && !ceed->TraceEvent) ceed = ceed->parent ? ceed->parent : ceed->op_fallback_parent;
+  *start = -1.0;
+  if (ceed) CeedCall(CeedGetWallTime(start));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Record an event started with @ref CeedTraceBegin() for a tracing backend
+
+  @param[in] ceed        `Ceed` context of the object the event acts on
+  @param[in] name        Name of the event, such as the libCEED function called; must outlive the `Ceed` context
+  @param[in] object_name Name of the object the event acts on, such as set by @ref CeedOperatorSetName(), or `NULL`
+  @param[in] size        Size of the work of the event, such as the length of a `CeedVector`
+  @param[in] start       Wall time the event started, from @ref CeedTraceBegin()
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedTraceEnd(Ceed ceed, const char *name, const char *object_name, CeedSize size, double start) {
+  double end = start;
+
+  if (start < 0.0) return CEED_ERROR_SUCCESS;
+  while (ceed && !ceed->TraceEvent) ceed = ceed->parent ? ceed->parent : ceed->op_fallback_parent;
+  if (!ceed) return CEED_ERROR_SUCCESS;
+  CeedCall(CeedGetWallTime(&end));
+  CeedCall(ceed->TraceEvent(ceed, name, object_name, size, start, end - start));
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -1140,6 +1303,15 @@ int CeedInit(const char *resource, Ceed *ceed) {
       match_index    = i;
     }
   }
+  // Backends with a prefix ending in '/', such as "/cpu/self/trace/", wrap the backend named by the rest of the resource
+  const size_t resource_len = stem_length;
+  bool         is_wrapper   = false;
+  if (match_index < num_backends) {
+    const size_t prefix_len = strlen(backends[match_index].prefix);
+
+    is_wrapper = prefix_len > 1 && backends[match_index].prefix[prefix_len - 1] == '/' && match_len + 1 >= prefix_len;
+    if (is_wrapper && match_len == prefix_len) stem_length = match_len;
+  }
   // Using Levenshtein distance to find closest match
   if (match_len <= 1 || match_len != stem_length) {
     // LCOV_EXCL_START
@@ -1194,6 +1366,7 @@ int CeedInit(const char *resource, Ceed *ceed) {
   FOffset f_offsets[] = {
       CEED_FTABLE_ENTRY(Ceed, Error),
       CEED_FTABLE_ENTRY(Ceed, SetStream),
+      CEED_FTABLE_ENTRY(Ceed, SetBlockSize),
       CEED_FTABLE_ENTRY(Ceed, GetPreferredMemType),
       CEED_FTABLE_ENTRY(Ceed, Destroy),
       CEED_FTABLE_ENTRY(Ceed, VectorCreate),
@@ -1210,6 +1383,7 @@ int CeedInit(const char *resource, Ceed *ceed) {
       CEED_FTABLE_ENTRY(Ceed, OperatorCreate),
       CEED_FTABLE_ENTRY(Ceed, OperatorCreateAtPoints),
       CEED_FTABLE_ENTRY(Ceed, CompositeOperatorCreate),
+      CEED_FTABLE_ENTRY(Ceed, TraceEvent),
       CEED_FTABLE_ENTRY(CeedVector, HasValidArray),
       CEED_FTABLE_ENTRY(CeedVector, HasBorrowedArrayOfType),
       CEED_FTABLE_ENTRY(CeedVector, CopyStrided),
@@ -1227,6 +1401,8 @@ int CeedInit(const char *resource, Ceed *ceed) {
       CEED_FTABLE_ENTRY(CeedVector, Scale),
       CEED_FTABLE_ENTRY(CeedVector, AXPY),
       CEED_FTABLE_ENTRY(CeedVector, AXPBY),
+      CEED_FTABLE_ENTRY(CeedVector, AXPBYNorm),
+      CEED_FTABLE_ENTRY(CeedVector, MDot),
       CEED_FTABLE_ENTRY(CeedVector, PointwiseMult),
       CEED_FTABLE_ENTRY(CeedVector, Reciprocal),
       CEED_FTABLE_ENTRY(CeedVector, Destroy),
@@ -1236,6 +1412,7 @@ int CeedInit(const char *resource, Ceed *ceed) {
       CEED_FTABLE_ENTRY(CeedElemRestriction, ApplyAtPointsInElement),
       CEED_FTABLE_ENTRY(CeedElemRestriction, ApplyBlock),
       CEED_FTABLE_ENTRY(CeedElemRestriction, GetOffsets),
+      CEED_FTABLE_ENTRY(CeedElemRestriction, RestoreOffsets),
       CEED_FTABLE_ENTRY(CeedElemRestriction, GetOrientations),
       CEED_FTABLE_ENTRY(CeedElemRestriction, GetCurlOrientations),
       CEED_FTABLE_ENTRY(CeedElemRestriction, GetAtPointsElementOffset),
@@ -1263,6 +1440,7 @@ int CeedInit(const char *resource, Ceed *ceed) {
       CEED_FTABLE_ENTRY(CeedQFunctionContext, Destroy),
       CEED_FTABLE_ENTRY(CeedOperator, LinearAssembleQFunction),
       CEED_FTABLE_ENTRY(CeedOperator, LinearAssembleQFunctionUpdate),
+      CEED_FTABLE_ENTRY(CeedOperator, LinearAssembleQFunctionElements),
       CEED_FTABLE_ENTRY(CeedOperator, LinearAssembleDiagonal),
       CEED_FTABLE_ENTRY(CeedOperator, LinearAssembleAddDiagonal),
       CEED_FTABLE_ENTRY(CeedOperator, LinearAssemblePointBlockDiagonal),
@@ -1290,8 +1468,13 @@ int CeedInit(const char *resource, Ceed *ceed) {
   // Record env variables CEED_DEBUG or DBG
   (*ceed)->is_debug = getenv("CEED_DEBUG") || getenv("DEBUG") || getenv("DBG");
 
-  // Copy resource prefix, if backend setup successful
-  CeedCall(CeedStringAllocCopy(backends[match_index].prefix, (char **)&(*ceed)->resource));
+  // Copy resource prefix, or the full resource for wrapping backends, if backend setup successful
+  if (is_wrapper) {
+    CeedCall(CeedCalloc(resource_len + 1, (char **)&(*ceed)->resource));
+    memcpy((char *)(*ceed)->resource, &resource[match_help], resource_len);
+  } else {
+    CeedCall(CeedStringAllocCopy(backends[match_index].prefix, (char **)&(*ceed)->resource));
+  }
 
   // Set default JiT source root
   // Note: there will always be the default root for every Ceed but all additional paths are added to the top-most parent
@@ -1327,6 +1510,34 @@ int CeedSetStream(Ceed ceed, void *handle) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Set the element block size used by CPU backends that process elements in blocks
+
+  The block size applies to operators set up after this call.
+  Backends that do not process elements in blocks return an error.
+
+  @param[in,out] ceed       `Ceed` context to set the block size
+  @param[in]     block_size Number of elements processed together
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedSetBlockSize(Ceed ceed, CeedInt block_size) {
+  CeedCheck(block_size > 0, ceed, CEED_ERROR_INCOMPATIBLE, "Block size must be positive");
+  if (ceed->SetBlockSize) {
+    CeedCall(ceed->SetBlockSize(ceed, block_size));
+  } else {
+    Ceed delegate;
+    CeedCall(CeedGetDelegate(ceed, &delegate));
+
+    if (delegate) CeedCall(CeedSetBlockSize(delegate, block_size));
+    else return CeedError(ceed, CEED_ERROR_UNSUPPORTED, "Backend does not support setting block size");
+    CeedCall(CeedDestroy(&delegate));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Copy the pointer to a `Ceed` context.
 
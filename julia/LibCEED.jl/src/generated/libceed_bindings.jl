@@ -77,6 +77,14 @@ end
     CEED_CONTEXT_FIELD_INT32 = 2
 end
 
+@cenum CeedOperatorPhase::UInt32 begin
+    CEED_OPERATOR_PHASE_INPUT_RESTRICTION = 0
+    CEED_OPERATOR_PHASE_INPUT_BASIS = 1
+    CEED_OPERATOR_PHASE_QFUNCTION = 2
+    CEED_OPERATOR_PHASE_OUTPUT_BASIS = 3
+    CEED_OPERATOR_PHASE_OUTPUT_RESTRICTION = 4
+end
+
 mutable struct Ceed_private end
 
 const Ceed = Ptr{Ceed_private}
@@ -133,6 +141,10 @@ function CeedSetStream(ceed, handle)
     ccall((:CeedSetStream, libceed), Cint, (Ceed, Ptr{Cvoid}), ceed, handle)
 end
 
+function CeedSetBlockSize(ceed, block_size)
+    ccall((:CeedSetBlockSize, libceed), Cint, (Ceed, CeedInt), ceed, block_size)
+end
+
 function CeedReferenceCopy(ceed, ceed_copy)
     ccall((:CeedReferenceCopy, libceed), Cint, (Ceed, Ptr{Ceed}), ceed, ceed_copy)
 end
@@ -248,6 +260,14 @@ function CeedVectorAXPBY(y, alpha, beta, x)
     ccall((:CeedVectorAXPBY, libceed), Cint, (CeedVector, CeedScalar, CeedScalar, CeedVector), y, alpha, beta, x)
 end
 
+function CeedVectorAXPBYNorm(y, alpha, beta, x, norm_type, norm)
+    ccall((:CeedVectorAXPBYNorm, libceed), Cint, (CeedVector, CeedScalar, CeedScalar, CeedVector, CeedNormType, Ptr{CeedScalar}), y, alpha, beta, x, norm_type, norm)
+end
+
+function CeedVectorMDot(x, num_vecs, vecs, dots)
+    ccall((:CeedVectorMDot, libceed), Cint, (CeedVector, CeedInt, Ptr{CeedVector}, Ptr{CeedScalar}), x, num_vecs, vecs, dots)
+end
+
 function CeedVectorPointwiseMult(w, x, y)
     ccall((:CeedVectorPointwiseMult, libceed), Cint, (CeedVector, CeedVector, CeedVector), w, x, y)
 end
@@ -559,6 +579,14 @@ function CeedQFunctionSetUserFlopsEstimate(qf, flops)
     ccall((:CeedQFunctionSetUserFlopsEstimate, libceed), Cint, (CeedQFunction, CeedSize), qf, flops)
 end
 
+function CeedQFunctionSetAssemblySymmetric(qf, is_symmetric)
+    ccall((:CeedQFunctionSetAssemblySymmetric, libceed), Cint, (CeedQFunction, Bool), qf, is_symmetric)
+end
+
+function CeedQFunctionSetAssemblyZeroBlock(qf, input_field_name, output_field_name)
+    ccall((:CeedQFunctionSetAssemblyZeroBlock, libceed), Cint, (CeedQFunction, Ptr{Cchar}, Ptr{Cchar}), qf, input_field_name, output_field_name)
+end
+
 function CeedQFunctionView(qf, stream)
     ccall((:CeedQFunctionView, libceed), Cint, (CeedQFunction, Ptr{Libc.FILE}), qf, stream)
 end
@@ -734,6 +762,10 @@ function CeedOperatorLinearAssembleSymbolic(op, num_entries, rows, cols)
     ccall((:CeedOperatorLinearAssembleSymbolic, libceed), Cint, (CeedOperator, Ptr{CeedSize}, Ptr{Ptr{CeedInt}}, Ptr{Ptr{CeedInt}}), op, num_entries, rows, cols)
 end
 
+function CeedOperatorLinearAssembleSymbolicCeedSize(op, num_entries, rows, cols)
+    ccall((:CeedOperatorLinearAssembleSymbolicCeedSize, libceed), Cint, (CeedOperator, Ptr{CeedSize}, Ptr{Ptr{CeedSize}}, Ptr{Ptr{CeedSize}}), op, num_entries, rows, cols)
+end
+
 function CeedOperatorLinearAssemble(op, values)
     ccall((:CeedOperatorLinearAssemble, libceed), Cint, (CeedOperator, CeedVector), op, values)
 end
@@ -754,6 +786,10 @@ function CeedOperatorMultigridLevelCreateH1(op_fine, p_mult_fine, rstr_coarse, b
     ccall((:CeedOperatorMultigridLevelCreateH1, libceed), Cint, (CeedOperator, CeedVector, CeedElemRestriction, CeedBasis, Ptr{CeedScalar}, Ptr{CeedOperator}, Ptr{CeedOperator}, Ptr{CeedOperator}), op_fine, p_mult_fine, rstr_coarse, basis_coarse, interp_c_to_f, op_coarse, op_prolong, op_restrict)
 end
 
+function CeedOperatorMultigridHierarchyCreate(op_fine, num_levels, p_mult, rstrs_coarse, bases_coarse, ops_coarse, ops_prolong, ops_restrict)
+    ccall((:CeedOperatorMultigridHierarchyCreate, libceed), Cint, (CeedOperator, CeedInt, Ptr{CeedVector}, Ptr{CeedElemRestriction}, Ptr{CeedBasis}, Ptr{CeedOperator}, Ptr{CeedOperator}, Ptr{CeedOperator}), op_fine, num_levels, p_mult, rstrs_coarse, bases_coarse, ops_coarse, ops_prolong, ops_restrict)
+end
+
 function CeedOperatorCreateFDMElementInverse(op, fdm_inv, request)
     ccall((:CeedOperatorCreateFDMElementInverse, libceed), Cint, (CeedOperator, Ptr{CeedOperator}, Ptr{CeedRequest}), op, fdm_inv, request)
 end
@@ -782,6 +818,22 @@ function CeedOperatorGetFlopsEstimate(op, flops)
     ccall((:CeedOperatorGetFlopsEstimate, libceed), Cint, (CeedOperator, Ptr{CeedSize}), op, flops)
 end
 
+function CeedOperatorSetProfiling(op, is_profiling)
+    ccall((:CeedOperatorSetProfiling, libceed), Cint, (CeedOperator, Bool), op, is_profiling)
+end
+
+function CeedOperatorGetProfile(op, phase, num_calls, time, bytes, flops)
+    ccall((:CeedOperatorGetProfile, libceed), Cint, (CeedOperator, CeedOperatorPhase, Ptr{CeedSize}, Ptr{Cdouble}, Ptr{CeedSize}, Ptr{CeedSize}), op, phase, num_calls, time, bytes, flops)
+end
+
+function CeedOperatorResetProfile(op)
+    ccall((:CeedOperatorResetProfile, libceed), Cint, (CeedOperator,), op)
+end
+
+function CeedOperatorViewProfile(op, stream)
+    ccall((:CeedOperatorViewProfile, libceed), Cint, (CeedOperator, Ptr{Libc.FILE}), op, stream)
+end
+
 function CeedOperatorGetContext(op, ctx)
     ccall((:CeedOperatorGetContext, libceed), Cint, (CeedOperator, Ptr{CeedQFunctionContext}), op, ctx)
 end
@@ -985,6 +1037,26 @@ function CeedReference(ceed)
     ccall((:CeedReference, libceed), Cint, (Ceed,), ceed)
 end
 
+function CeedGetWorkVectorStatistics(ceed, num_hits, num_misses, peak_usage_mb)
+    ccall((:CeedGetWorkVectorStatistics, libceed), Cint, (Ceed, Ptr{CeedSize}, Ptr{CeedSize}, Ptr{CeedScalar}), ceed, num_hits, num_misses, peak_usage_mb)
+end
+
+function CeedSetWorkVectorMemoryLimit(ceed, limit_mb)
+    ccall((:CeedSetWorkVectorMemoryLimit, libceed), Cint, (Ceed, CeedScalar), ceed, limit_mb)
+end
+
+function CeedGetWallTime(time)
+    ccall((:CeedGetWallTime, libceed), Cint, (Ptr{Cdouble},), time)
+end
+
+function CeedTraceBegin(ceed, start)
+    ccall((:CeedTraceBegin, libceed), Cint, (Ceed, Ptr{Cdouble}), ceed, start)
+end
+
+function CeedTraceEnd(ceed, name, object_name, size, start)
+    ccall((:CeedTraceEnd, libceed), Cint, (Ceed, Ptr{Cchar}, Ptr{Cchar}, CeedSize, Cdouble), ceed, name, object_name, size, start)
+end
+
 function CeedVectorHasValidArray(vec, has_valid_array)
     ccall((:CeedVectorHasValidArray, libceed), Cint, (CeedVector, Ptr{Bool}), vec, has_valid_array)
 end
@@ -1179,6 +1251,10 @@ function CeedQFunctionSetFortranStatus(qf, status)
     ccall((:CeedQFunctionSetFortranStatus, libceed), Cint, (CeedQFunction, Bool), qf, status)
 end
 
+function CeedQFunctionGetFortranStatus(qf, is_fortran)
+    ccall((:CeedQFunctionGetFortranStatus, libceed), Cint, (CeedQFunction, Ptr{Bool}), qf, is_fortran)
+end
+
 function CeedQFunctionGetVectorLength(qf, vec_length)
     ccall((:CeedQFunctionGetVectorLength, libceed), Cint, (CeedQFunction, Ptr{CeedInt}), qf, vec_length)
 end
@@ -1235,6 +1311,14 @@ function CeedQFunctionIsContextWritable(qf, is_writable)
     ccall((:CeedQFunctionIsContextWritable, libceed), Cint, (CeedQFunction, Ptr{Bool}), qf, is_writable)
 end
 
+function CeedQFunctionIsAssemblySymmetric(qf, is_symmetric)
+    ccall((:CeedQFunctionIsAssemblySymmetric, libceed), Cint, (CeedQFunction, Ptr{Bool}), qf, is_symmetric)
+end
+
+function CeedQFunctionGetAssemblyZeroBlocks(qf, num_zero_blocks, zero_blocks)
+    ccall((:CeedQFunctionGetAssemblyZeroBlocks, libceed), Cint, (CeedQFunction, Ptr{CeedInt}, Ptr{Ptr{CeedInt}}), qf, num_zero_blocks, zero_blocks)
+end
+
 function CeedQFunctionGetData(qf, data)
     ccall((:CeedQFunctionGetData, libceed), Cint, (CeedQFunction, Ptr{Cvoid}), qf, data)
 end
@@ -1375,6 +1459,10 @@ function CeedOperatorAssemblyDataGetEvalModes(data, num_active_bases_in, num_eva
     ccall((:CeedOperatorAssemblyDataGetEvalModes, libceed), Cint, (CeedOperatorAssemblyData, Ptr{CeedInt}, Ptr{Ptr{CeedInt}}, Ptr{Ptr{Ptr{CeedEvalMode}}}, Ptr{Ptr{Ptr{CeedSize}}}, Ptr{CeedInt}, Ptr{Ptr{CeedInt}}, Ptr{Ptr{Ptr{CeedEvalMode}}}, Ptr{Ptr{Ptr{CeedSize}}}, Ptr{CeedSize}), data, num_active_bases_in, num_eval_modes_in, eval_modes_in, eval_mode_offsets_in, num_active_bases_out, num_eval_modes_out, eval_modes_out, eval_mode_offsets_out, num_output_components)
 end
 
+function CeedOperatorAssemblyDataGetQFunctionEntries(data, num_input_components, num_entries, entry_map)
+    ccall((:CeedOperatorAssemblyDataGetQFunctionEntries, libceed), Cint, (CeedOperatorAssemblyData, Ptr{CeedInt}, Ptr{CeedInt}, Ptr{Ptr{CeedInt}}), data, num_input_components, num_entries, entry_map)
+end
+
 function CeedOperatorAssemblyDataGetBases(data, num_active_bases_in, active_bases_in, assembled_bases_in, num_active_bases_out, active_bases_out, assembled_bases_out)
     ccall((:CeedOperatorAssemblyDataGetBases, libceed), Cint, (CeedOperatorAssemblyData, Ptr{CeedInt}, Ptr{Ptr{CeedBasis}}, Ptr{Ptr{Ptr{CeedScalar}}}, Ptr{CeedInt}, Ptr{Ptr{CeedBasis}}, Ptr{Ptr{Ptr{CeedScalar}}}), data, num_active_bases_in, active_bases_in, assembled_bases_in, num_active_bases_out, active_bases_out, assembled_bases_out)
 end
@@ -1451,6 +1539,18 @@ function CeedOperatorSetSetupDone(op)
     ccall((:CeedOperatorSetSetupDone, libceed), Cint, (CeedOperator,), op)
 end
 
+function CeedOperatorIsProfiling(op, is_profiling)
+    ccall((:CeedOperatorIsProfiling, libceed), Cint, (CeedOperator, Ptr{Bool}), op, is_profiling)
+end
+
+function CeedOperatorProfileLap(time, phase_time)
+    ccall((:CeedOperatorProfileLap, libceed), Cint, (Ptr{Cdouble}, Ptr{Cdouble}), time, phase_time)
+end
+
+function CeedOperatorAddProfile(op, phase_times)
+    ccall((:CeedOperatorAddProfile, libceed), Cint, (CeedOperator, Ptr{Cdouble}), op, phase_times)
+end
+
 function CeedMatrixMatrixMultiply(ceed, mat_A, mat_B, mat_C, m, n, kk)
     ccall((:CeedMatrixMatrixMultiply, libceed), Cint, (Ceed, Ptr{CeedScalar}, Ptr{CeedScalar}, Ptr{CeedScalar}, CeedInt, CeedInt, CeedInt), ceed, mat_A, mat_B, mat_C, m, n, kk)
 end
@@ -1483,6 +1583,8 @@ const CeedSize_FMT = "td"
 
 const CeedInt8_FMT = "d"
 
+const CEED_OPERATOR_NUM_PHASES = 5
+
 const CEED_VERSION_MAJOR = 0
 
 const CEED_VERSION_MINOR = 12
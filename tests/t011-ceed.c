@@ -0,0 +1,81 @@
+/// @file
+/// Test timeline of libCEED calls written by the trace backend
+/// \test Test timeline of libCEED calls written by the trace backend
+#define _POSIX_C_SOURCE 200112L
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define NUM_ELEM 4
+#define ELEM_SIZE 3
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction;
+  CeedQFunction       qf_identity;
+  CeedOperator        op_identity;
+  CeedVector          u, v;
+  CeedScalar          norm;
+  char                resource[256], file_name[64];
+  const CeedInt       len = NUM_ELEM * ELEM_SIZE;
+
+  // Trace the requested backend
+  if (strncmp(argv[1], "/cpu/self/trace", 15)) snprintf(resource, sizeof(resource), "/cpu/self/trace%s", argv[1]);
+  else snprintf(resource, sizeof(resource), "%s", argv[1]);
+  snprintf(file_name, sizeof(file_name), "t011-ceed-trace-%ld.json", (long)getpid());
+  setenv("CEED_TRACE_FILE", file_name, 1);
+  CeedInit(resource, &ceed);
+
+  CeedVectorCreate(ceed, len, &u);
+  CeedVectorCreate(ceed, len, &v);
+  CeedVectorSetValue(u, 2.0);
+  CeedVectorSetValue(v, 0.0);
+
+  CeedElemRestrictionCreateStrided(ceed, NUM_ELEM, ELEM_SIZE, 1, len, CEED_STRIDES_BACKEND, &elem_restriction);
+  CeedQFunctionCreateIdentity(ceed, 1, CEED_EVAL_NONE, CEED_EVAL_NONE, &qf_identity);
+  CeedOperatorCreate(ceed, qf_identity, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_identity);
+  CeedOperatorSetField(op_identity, "input", elem_restriction, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_identity, "output", elem_restriction, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetName(op_identity, "identity");
+
+  CeedOperatorApply(op_identity, u, v, CEED_REQUEST_IMMEDIATE);
+  CeedVectorNorm(v, CEED_NORM_1, &norm);
+  if (fabs(norm - 2.0 * len) > 100. * CEED_EPSILON) printf("Incorrect norm: %f != %f\n", norm, 2.0 * len);
+
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedElemRestrictionDestroy(&elem_restriction);
+  CeedQFunctionDestroy(&qf_identity);
+  CeedOperatorDestroy(&op_identity);
+  CeedDestroy(&ceed);
+
+  // Check the timeline written on destruction
+  {
+    FILE       *file = fopen(file_name, "r");
+    char        trace[1 << 16];
+    size_t      trace_len;
+    const char *events[] = {"\"traceEvents\"", "\"CeedVectorSetValue\"", "\"CeedOperatorApply\"", "\"object\":\"identity\"", "\"CeedVectorNorm\""};
+
+    if (!file) {
+      // LCOV_EXCL_START
+      printf("Trace file %s not written\n", file_name);
+      return 1;
+      // LCOV_EXCL_STOP
+    }
+    trace_len        = fread(trace, 1, sizeof(trace) - 1, file);
+    trace[trace_len] = '\0';
+    fclose(file);
+    remove(file_name);
+    for (CeedInt i = 0; i < (CeedInt)(sizeof(events) / sizeof(events[0])); i++) {
+      if (!strstr(trace, events[i])) {
+        // LCOV_EXCL_START
+        printf("Trace missing %s\n", events[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,102 @@
+/// @file
+/// Test fused AXPBY with norm and multiple dot products, with threaded vector operations
+/// \test Test fused AXPBY with norm and multiple dot products, with threaded vector operations
+
+//TESTARGS(name="length 10") {ceed_resource} 10
+//TESTARGS(name="length 20000") {ceed_resource} 20000
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define NUM_VECS 3
+
+static void ComputeFused(const char *resource, CeedInt len, CeedScalar norms[3], CeedScalar dots[NUM_VECS]) {
+  Ceed       ceed;
+  CeedVector x, y, vecs[NUM_VECS];
+
+  CeedInit(resource, &ceed);
+  CeedVectorCreate(ceed, len, &x);
+  CeedVectorCreate(ceed, len, &y);
+  for (CeedInt v = 0; v < NUM_VECS; v++) CeedVectorCreate(ceed, len, &vecs[v]);
+  {
+    CeedScalar array[len];
+
+    for (CeedInt i = 0; i < len; i++) array[i] = sin(0.1 * i);
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, array);
+    for (CeedInt v = 0; v < NUM_VECS; v++) {
+      for (CeedInt i = 0; i < len; i++) array[i] = cos(0.3 * (v + 1) * i) - 0.5 * v;
+      CeedVectorSetArray(vecs[v], CEED_MEM_HOST, CEED_COPY_VALUES, array);
+    }
+  }
+
+  // y = 2 x - 3 y, one norm type per update
+  CeedVectorSetValue(y, 1.0);
+  CeedVectorAXPBYNorm(y, 2.0, -3.0, x, CEED_NORM_1, &norms[0]);
+  CeedVectorAXPBYNorm(y, 2.0, -3.0, x, CEED_NORM_2, &norms[1]);
+  CeedVectorAXPBYNorm(y, 2.0, -3.0, x, CEED_NORM_MAX, &norms[2]);
+
+  // (y, vecs[v]), with the updated y
+  CeedVectorMDot(y, NUM_VECS, vecs, dots);
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&y);
+  for (CeedInt v = 0; v < NUM_VECS; v++) CeedVectorDestroy(&vecs[v]);
+  CeedDestroy(&ceed);
+}
+
+int main(int argc, char **argv) {
+  CeedInt    len = argc > 2 ? atoi(argv[2]) : 10;
+  CeedScalar norms[3], dots[NUM_VECS], norms_threaded[3], dots_threaded[NUM_VECS];
+  CeedScalar norms_true[3] = {0.0, 0.0, 0.0}, dots_true[NUM_VECS] = {0.0};
+
+  // Reference values
+  {
+    CeedScalar y[len];
+
+    for (CeedInt i = 0; i < len; i++) y[i] = 1.0;
+    for (CeedInt k = 0; k < 3; k++) {
+      CeedScalar norm = 0.0;
+
+      for (CeedInt i = 0; i < len; i++) {
+        y[i] = 2.0 * sin(0.1 * i) - 3.0 * y[i];
+        if (k == 0) norm += fabs(y[i]);
+        if (k == 1) norm += y[i] * y[i];
+        if (k == 2) norm = fmax(norm, fabs(y[i]));
+      }
+      norms_true[k] = k == 1 ? sqrt(norm) : norm;
+    }
+    for (CeedInt v = 0; v < NUM_VECS; v++) {
+      for (CeedInt i = 0; i < len; i++) dots_true[v] += y[i] * (cos(0.3 * (v + 1) * i) - 0.5 * v);
+    }
+  }
+
+  ComputeFused(argv[1], len, norms, dots);
+  ComputeFused("/cpu/self/opt/blocked:threads=4", len, norms_threaded, dots_threaded);
+
+  for (CeedInt k = 0; k < 3; k++) {
+    if (fabs(norms[k] - norms_true[k]) > 1000. * CEED_EPSILON * fmax(1.0, norms_true[k])) {
+      // LCOV_EXCL_START
+      printf("Error in AXPBYNorm for norm type %" CeedInt_FMT ", computed: %f actual: %f\n", k, norms[k], norms_true[k]);
+      // LCOV_EXCL_STOP
+    }
+    if (fabs(norms_threaded[k] - norms_true[k]) > 1000. * CEED_EPSILON * fmax(1.0, norms_true[k])) {
+      // LCOV_EXCL_START
+      printf("Error in threaded AXPBYNorm for norm type %" CeedInt_FMT ", computed: %f actual: %f\n", k, norms_threaded[k], norms_true[k]);
+      // LCOV_EXCL_STOP
+    }
+  }
+  for (CeedInt v = 0; v < NUM_VECS; v++) {
+    if (fabs(dots[v] - dots_true[v]) > 1000. * CEED_EPSILON * fmax(1.0, fabs(dots_true[v]) + norms_true[1] * norms_true[1])) {
+      // LCOV_EXCL_START
+      printf("Error in MDot for vector %" CeedInt_FMT ", computed: %f actual: %f\n", v, dots[v], dots_true[v]);
+      // LCOV_EXCL_STOP
+    }
+    if (fabs(dots_threaded[v] - dots_true[v]) > 1000. * CEED_EPSILON * fmax(1.0, fabs(dots_true[v]) + norms_true[1] * norms_true[1])) {
+      // LCOV_EXCL_START
+      printf("Error in threaded MDot for vector %" CeedInt_FMT ", computed: %f actual: %f\n", v, dots_threaded[v], dots_true[v]);
+      // LCOV_EXCL_STOP
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,72 @@
+/// @file
+/// Test best fit reuse, statistics, and memory limit of work vectors
+/// \test Test best fit reuse, statistics, and memory limit of work vectors
+
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <math.h>
+#include <stdio.h>
+
+static CeedScalar expected_usage(CeedSize length) { return length * sizeof(CeedScalar) * 1e-6; }
+
+int main(int argc, char **argv) {
+  Ceed       ceed;
+  CeedVector x, y, z;
+  CeedSize   num_hits, num_misses;
+  CeedScalar usage_mb, peak_usage_mb;
+
+  CeedInit(argv[1], &ceed);
+
+  // Add work vectors of different lengths
+  CeedGetWorkVector(ceed, 50, &x);
+  CeedGetWorkVector(ceed, 30, &y);
+  CeedGetWorkVector(ceed, 40, &z);
+  CeedRestoreWorkVector(ceed, &x);
+  CeedRestoreWorkVector(ceed, &y);
+  CeedRestoreWorkVector(ceed, &z);
+
+  // Best fit should give the length 30 vector for 25 entries
+  {
+    CeedSize length;
+
+    CeedGetWorkVector(ceed, 25, &x);
+    CeedVectorGetLength(x, &length);
+    if (length != 30) printf("Wrong best fit work vector length: %" CeedSize_FMT " != 30\n", length);
+    CeedRestoreWorkVector(ceed, &x);
+  }
+
+  // Check statistics, 3 misses, 1 hit, and peak usage 120 * sizeof(CeedScalar)
+  CeedGetWorkVectorStatistics(ceed, &num_hits, &num_misses, &peak_usage_mb);
+  if (num_hits != 1 || num_misses != 3) printf("Wrong statistics: %" CeedSize_FMT " hits, %" CeedSize_FMT " misses\n", num_hits, num_misses);
+  if (fabs(peak_usage_mb - expected_usage(120)) > 100. * CEED_EPSILON) {
+    // LCOV_EXCL_START
+    printf("Wrong peak usage: %0.8g MB != %0.8g MB\n", peak_usage_mb, expected_usage(120));
+    // LCOV_EXCL_STOP
+  }
+
+  // Use the length 40 vector, so the length 50 vector is least recently used
+  CeedGetWorkVector(ceed, 35, &x);
+  CeedRestoreWorkVector(ceed, &x);
+
+  // Limit of 140 entries must evict the length 50 vector to add a length 60 vector
+  CeedSetWorkVectorMemoryLimit(ceed, expected_usage(140));
+  CeedGetWorkVector(ceed, 60, &x);
+  CeedGetWorkVectorMemoryUsage(ceed, &usage_mb);
+  if (fabs(usage_mb - expected_usage(130)) > 100. * CEED_EPSILON) printf("Wrong usage: %0.8g MB != %0.8g MB\n", usage_mb, expected_usage(130));
+
+  // Lowering the limit evicts inactive vectors only
+  CeedSetWorkVectorMemoryLimit(ceed, expected_usage(10));
+  CeedGetWorkVectorMemoryUsage(ceed, &usage_mb);
+  if (fabs(usage_mb - expected_usage(60)) > 100. * CEED_EPSILON) printf("Wrong usage: %0.8g MB != %0.8g MB\n", usage_mb, expected_usage(60));
+  CeedRestoreWorkVector(ceed, &x);
+
+  // Removing the limit keeps new work vectors
+  CeedSetWorkVectorMemoryLimit(ceed, 0.0);
+  CeedGetWorkVector(ceed, 70, &x);
+  CeedRestoreWorkVector(ceed, &x);
+  CeedGetWorkVectorMemoryUsage(ceed, &usage_mb);
+  if (fabs(usage_mb - expected_usage(130)) > 100. * CEED_EPSILON) printf("Wrong usage: %0.8g MB != %0.8g MB\n", usage_mb, expected_usage(130));
+
+  CeedDestroy(&ceed);
+  return 0;
+}
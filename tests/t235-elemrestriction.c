@@ -0,0 +1,132 @@
+/// @file
+/// Test element restrictions with structured, compact, and spread out offsets
+/// \test Test element restrictions with structured, compact, and spread out offsets
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define NUM_ELEM 6
+#define ELEM_SIZE 4
+#define NUM_COMP 2
+#define NUM_NODES 200000
+
+// Offsets of node i in element e, shared pattern, compact, or spread over more than 2^16 nodes
+static CeedInt Offset(CeedInt kind, CeedInt e, CeedInt i) {
+  const CeedInt structured[ELEM_SIZE] = {0, 1, 5, 6};
+
+  if (kind == 0) return 3 * e + structured[i];
+  if (kind == 1) return (13 * e + 7 * i * i + e * i) % 500;
+  return ((CeedSize)(e * ELEM_SIZE + i) * 30011) % NUM_NODES;
+}
+
+int main(int argc, char **argv) {
+  Ceed        ceed;
+  CeedVector  x, y, z;
+  CeedInt     ind[NUM_ELEM * ELEM_SIZE];
+  CeedScalar *x_array, *multiplicity;
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, NUM_COMP * NUM_NODES, &x);
+  CeedVectorCreate(ceed, NUM_COMP * NUM_NODES, &z);
+  x_array      = malloc(NUM_COMP * NUM_NODES * sizeof(CeedScalar));
+  multiplicity = malloc(NUM_NODES * sizeof(CeedScalar));
+  for (CeedInt c = 0; c < NUM_COMP; c++) {
+    for (CeedInt n = 0; n < NUM_NODES; n++) x_array[c * NUM_NODES + n] = n % 1000 + 0.5 * c;
+  }
+  CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+
+  for (CeedInt kind = 0; kind < 3; kind++) {
+    for (CeedInt e = 0; e < NUM_ELEM; e++) {
+      for (CeedInt i = 0; i < ELEM_SIZE; i++) ind[e * ELEM_SIZE + i] = Offset(kind, e, i);
+    }
+    for (CeedInt n = 0; n < NUM_NODES; n++) multiplicity[n] = 0.0;
+    for (CeedInt i = 0; i < NUM_ELEM * ELEM_SIZE; i++) multiplicity[ind[i]] += 1.0;
+
+    for (CeedInt is_blocked = 0; is_blocked < 2; is_blocked++) {
+      CeedElemRestriction elem_restriction;
+
+      if (is_blocked) {
+        CeedElemRestrictionCreateBlocked(ceed, NUM_ELEM, ELEM_SIZE, 4, NUM_COMP, NUM_NODES, NUM_COMP * NUM_NODES, CEED_MEM_HOST, CEED_COPY_VALUES,
+                                         ind, &elem_restriction);
+      } else {
+        CeedElemRestrictionCreate(ceed, NUM_ELEM, ELEM_SIZE, NUM_COMP, NUM_NODES, NUM_COMP * NUM_NODES, CEED_MEM_HOST, CEED_COPY_VALUES, ind,
+                                  &elem_restriction);
+      }
+      CeedElemRestrictionCreateVector(elem_restriction, NULL, &y);
+
+      // Restrict to E-vector
+      CeedElemRestrictionApply(elem_restriction, CEED_NOTRANSPOSE, x, y, CEED_REQUEST_IMMEDIATE);
+      if (!is_blocked) {
+        const CeedScalar *y_array;
+
+        CeedVectorGetArrayRead(y, CEED_MEM_HOST, &y_array);
+        for (CeedInt e = 0; e < NUM_ELEM; e++) {
+          for (CeedInt c = 0; c < NUM_COMP; c++) {
+            for (CeedInt i = 0; i < ELEM_SIZE; i++) {
+              const CeedScalar y_i = y_array[(e * NUM_COMP + c) * ELEM_SIZE + i], y_true = x_array[c * NUM_NODES + ind[e * ELEM_SIZE + i]];
+
+              if (y_i != y_true) {
+                // LCOV_EXCL_START
+                printf("Error in restricted array, offsets %" CeedInt_FMT ", y[%" CeedInt_FMT ", %" CeedInt_FMT ", %" CeedInt_FMT "] = %f != %f\n",
+                       kind, e, c, i, y_i, y_true);
+                // LCOV_EXCL_STOP
+              }
+            }
+          }
+        }
+        CeedVectorRestoreArrayRead(y, &y_array);
+      }
+
+      // Sum back into L-vector, z = multiplicity x
+      CeedVectorSetValue(z, 0.0);
+      CeedElemRestrictionApply(elem_restriction, CEED_TRANSPOSE, y, z, CEED_REQUEST_IMMEDIATE);
+      {
+        const CeedScalar *z_array;
+
+        CeedVectorGetArrayRead(z, CEED_MEM_HOST, &z_array);
+        for (CeedInt c = 0; c < NUM_COMP; c++) {
+          for (CeedInt n = 0; n < NUM_NODES; n++) {
+            const CeedScalar z_true = multiplicity[n] * x_array[c * NUM_NODES + n];
+
+            if (fabs(z_array[c * NUM_NODES + n] - z_true) > 100. * CEED_EPSILON * fabs(z_true)) {
+              // LCOV_EXCL_START
+              printf("Error in transpose, offsets %" CeedInt_FMT " blocked %" CeedInt_FMT ", z[%" CeedInt_FMT "] = %f != %f\n", kind, is_blocked,
+                     c * NUM_NODES + n, z_array[c * NUM_NODES + n], z_true);
+              // LCOV_EXCL_STOP
+            }
+          }
+        }
+        CeedVectorRestoreArrayRead(z, &z_array);
+      }
+
+      // Offsets are returned as given
+      if (!is_blocked) {
+        const CeedInt *offsets;
+
+        CeedElemRestrictionGetOffsets(elem_restriction, CEED_MEM_HOST, &offsets);
+        for (CeedInt i = 0; i < NUM_ELEM * ELEM_SIZE; i++) {
+          if (offsets[i] != ind[i]) {
+            // LCOV_EXCL_START
+            printf("Error in offsets %" CeedInt_FMT ", offsets[%" CeedInt_FMT "] = %" CeedInt_FMT " != %" CeedInt_FMT "\n", kind, i, offsets[i],
+                   ind[i]);
+            // LCOV_EXCL_STOP
+          }
+        }
+        CeedElemRestrictionRestoreOffsets(elem_restriction, &offsets);
+      }
+
+      CeedVectorDestroy(&y);
+      CeedElemRestrictionDestroy(&elem_restriction);
+    }
+  }
+
+  free(x_array);
+  free(multiplicity);
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&z);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,129 @@
+/// @file
+/// Test polynomial gradient and gradient transpose at arbitrary points in multiple elements
+/// \test Test polynomial gradient and gradient transpose at arbitrary points in multiple elements
+//TESTARGS(only="cpu") {ceed_resource}
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+
+// f_c,e = (e + 1) (1 + x + x y^2) + c y^3
+static CeedScalar EvalGrad(CeedInt e, CeedInt c, CeedInt d, const CeedScalar x[2]) {
+  if (d == 0) return (e + 1) * (1 + x[1] * x[1]);
+  return (e + 1) * 2 * x[0] * x[1] + 3 * c * x[1] * x[1];
+}
+
+static CeedScalar Eval(CeedInt e, CeedInt c, const CeedScalar x[2]) { return (e + 1) * (1 + x[0] + x[0] * x[1] * x[1]) + c * x[1] * x[1] * x[1]; }
+
+int main(int argc, char **argv) {
+  Ceed          ceed;
+  CeedVector    x_points, u, v, u_points, v_nodes;
+  CeedBasis     basis_u;
+  const CeedInt dim = 2, num_comp = 2, p = 4, q = 5, num_elem = 3, num_nodes = p * p;
+  const CeedInt num_points[3] = {7, 45, 0}, total_num_points = 52;
+  CeedScalar    x_nodes_1d[p], w_nodes_1d[p];
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, dim * total_num_points, &x_points);
+  CeedVectorCreate(ceed, num_comp * num_elem * num_nodes, &u);
+  CeedVectorCreate(ceed, dim * num_comp * total_num_points, &v);
+  CeedVectorCreate(ceed, dim * num_comp * total_num_points, &u_points);
+  CeedVectorCreate(ceed, num_comp * num_elem * num_nodes, &v_nodes);
+
+  // Nodal values, ordered [comp][elem][node]
+  CeedLobattoQuadrature(p, x_nodes_1d, w_nodes_1d);
+  {
+    CeedScalar u_array[num_comp * num_elem * num_nodes];
+
+    for (CeedInt c = 0; c < num_comp; c++) {
+      for (CeedInt e = 0; e < num_elem; e++) {
+        for (CeedInt j = 0; j < p; j++) {
+          for (CeedInt i = 0; i < p; i++) {
+            const CeedScalar x[2] = {x_nodes_1d[i], x_nodes_1d[j]};
+
+            u_array[(c * num_elem + e) * num_nodes + j * p + i] = Eval(e, c, x);
+          }
+        }
+      }
+    }
+    CeedVectorSetArray(u, CEED_MEM_HOST, CEED_COPY_VALUES, u_array);
+  }
+
+  // Point coordinates, ordered [dim][elem][point]
+  {
+    CeedScalar x_array[dim * total_num_points];
+
+    for (CeedInt i = 0; i < total_num_points; i++) {
+      x_array[0 * total_num_points + i] = sin(1.3 * i);
+      x_array[1 * total_num_points + i] = cos(0.7 * i + 0.2);
+    }
+    CeedVectorSetArray(x_points, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+
+  // Gradient at points
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, num_comp, p, q, CEED_GAUSS, &basis_u);
+  CeedBasisApplyAtPoints(basis_u, num_elem, num_points, CEED_NOTRANSPOSE, CEED_EVAL_GRAD, x_points, u, v);
+  {
+    const CeedScalar *x_array, *v_array;
+
+    CeedVectorGetArrayRead(x_points, CEED_MEM_HOST, &x_array);
+    CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+    for (CeedInt e = 0, offset = 0; e < num_elem; offset += num_points[e], e++) {
+      for (CeedInt i = offset; i < offset + num_points[e]; i++) {
+        const CeedScalar x[2] = {x_array[i], x_array[total_num_points + i]};
+
+        for (CeedInt d = 0; d < dim; d++) {
+          for (CeedInt c = 0; c < num_comp; c++) {
+            const CeedScalar dfx = EvalGrad(e, c, d, x), v_i = v_array[(d * num_comp + c) * total_num_points + i];
+
+            if (fabs(v_i - dfx) > 1000. * CEED_EPSILON) {
+              // LCOV_EXCL_START
+              printf("[%" CeedInt_FMT ", %" CeedInt_FMT "] %f != %f\n", e, i, v_i, dfx);
+              // LCOV_EXCL_STOP
+            }
+          }
+        }
+      }
+    }
+    CeedVectorRestoreArrayRead(x_points, &x_array);
+    CeedVectorRestoreArrayRead(v, &v_array);
+  }
+
+  // Gradient transpose at points, check (v, G u) == (G^T v, u)
+  {
+    CeedScalar u_points_array[dim * num_comp * total_num_points];
+
+    for (CeedInt i = 0; i < dim * num_comp * total_num_points; i++) u_points_array[i] = 1.0 + 0.1 * (i % 11);
+    CeedVectorSetArray(u_points, CEED_MEM_HOST, CEED_COPY_VALUES, u_points_array);
+  }
+  CeedBasisApplyAtPoints(basis_u, num_elem, num_points, CEED_TRANSPOSE, CEED_EVAL_GRAD, x_points, u_points, v_nodes);
+  {
+    const CeedScalar *u_array, *v_array, *u_points_array, *v_nodes_array;
+    CeedScalar        sum_points = 0.0, sum_nodes = 0.0;
+
+    CeedVectorGetArrayRead(u, CEED_MEM_HOST, &u_array);
+    CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+    CeedVectorGetArrayRead(u_points, CEED_MEM_HOST, &u_points_array);
+    CeedVectorGetArrayRead(v_nodes, CEED_MEM_HOST, &v_nodes_array);
+    for (CeedInt i = 0; i < dim * num_comp * total_num_points; i++) sum_points += u_points_array[i] * v_array[i];
+    for (CeedInt i = 0; i < num_comp * num_elem * num_nodes; i++) sum_nodes += v_nodes_array[i] * u_array[i];
+    if (fabs(sum_points - sum_nodes) > 5000. * CEED_EPSILON) {
+      // LCOV_EXCL_START
+      printf("Incorrect transpose, %f != %f\n", sum_points, sum_nodes);
+      // LCOV_EXCL_STOP
+    }
+    CeedVectorRestoreArrayRead(u, &u_array);
+    CeedVectorRestoreArrayRead(v, &v_array);
+    CeedVectorRestoreArrayRead(u_points, &u_points_array);
+    CeedVectorRestoreArrayRead(v_nodes, &v_nodes_array);
+  }
+
+  CeedVectorDestroy(&x_points);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&u_points);
+  CeedVectorDestroy(&v_nodes);
+  CeedBasisDestroy(&basis_u);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,85 @@
+/// @file
+/// Test interp and grad in 2D across 1D basis sizes against the reference backend
+/// \test Test interp and grad in 2D across 1D basis sizes against the reference backend
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+
+#define DIM 2
+#define NUM_COMP 2
+#define NUM_ELEM 3
+#define MAX_SIZE 11
+
+// Apply interp and grad and their transposes, storing the results
+static void ApplyBasis(Ceed ceed, CeedInt P, CeedInt Q, CeedScalar *results) {
+  const CeedInt len_u = NUM_ELEM * NUM_COMP * P * P, len_q = NUM_ELEM * NUM_COMP * Q * Q;
+  CeedBasis     basis;
+  CeedVector    u, q, dq, v;
+
+  CeedBasisCreateTensorH1Lagrange(ceed, DIM, NUM_COMP, P, Q, CEED_GAUSS, &basis);
+  CeedVectorCreate(ceed, len_u, &u);
+  CeedVectorCreate(ceed, len_q, &q);
+  CeedVectorCreate(ceed, DIM * len_q, &dq);
+  CeedVectorCreate(ceed, len_u, &v);
+  {
+    CeedScalar u_array[len_u];
+
+    for (CeedInt i = 0; i < len_u; i++) u_array[i] = sin(0.37 * i) + 0.1 * i / len_u;
+    CeedVectorSetArray(u, CEED_MEM_HOST, CEED_COPY_VALUES, u_array);
+  }
+
+  CeedBasisApply(basis, NUM_ELEM, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, u, q);
+  CeedBasisApply(basis, NUM_ELEM, CEED_NOTRANSPOSE, CEED_EVAL_GRAD, u, dq);
+  CeedBasisApply(basis, NUM_ELEM, CEED_TRANSPOSE, CEED_EVAL_INTERP, q, v);
+  CeedBasisApplyAdd(basis, NUM_ELEM, CEED_TRANSPOSE, CEED_EVAL_GRAD, dq, v);
+  {
+    const CeedScalar *q_array, *dq_array, *v_array;
+
+    CeedVectorGetArrayRead(q, CEED_MEM_HOST, &q_array);
+    CeedVectorGetArrayRead(dq, CEED_MEM_HOST, &dq_array);
+    CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+    for (CeedInt i = 0; i < len_q; i++) results[i] = q_array[i];
+    for (CeedInt i = 0; i < DIM * len_q; i++) results[len_q + i] = dq_array[i];
+    for (CeedInt i = 0; i < len_u; i++) results[(DIM + 1) * len_q + i] = v_array[i];
+    CeedVectorRestoreArrayRead(q, &q_array);
+    CeedVectorRestoreArrayRead(dq, &dq_array);
+    CeedVectorRestoreArrayRead(v, &v_array);
+  }
+
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&q);
+  CeedVectorDestroy(&dq);
+  CeedVectorDestroy(&v);
+  CeedBasisDestroy(&basis);
+}
+
+int main(int argc, char **argv) {
+  Ceed       ceed, ceed_ref;
+  CeedScalar results[(DIM + 2) * NUM_ELEM * NUM_COMP * MAX_SIZE * MAX_SIZE], results_ref[(DIM + 2) * NUM_ELEM * NUM_COMP * MAX_SIZE * MAX_SIZE];
+
+  CeedInit(argv[1], &ceed);
+  CeedInit("/cpu/self/ref/serial", &ceed_ref);
+
+  // Sizes from 2 to MAX_SIZE, in both directions of the contractions
+  for (CeedInt P = 2; P <= MAX_SIZE; P++) {
+    for (CeedInt Q = 2; Q <= MAX_SIZE; Q++) {
+      const CeedInt num_results = (DIM + 1) * NUM_ELEM * NUM_COMP * Q * Q + NUM_ELEM * NUM_COMP * P * P;
+      CeedScalar    max_result  = 1.0;
+
+      ApplyBasis(ceed, P, Q, results);
+      ApplyBasis(ceed_ref, P, Q, results_ref);
+      for (CeedInt i = 0; i < num_results; i++) max_result = fmax(max_result, fabs(results_ref[i]));
+      for (CeedInt i = 0; i < num_results; i++) {
+        if (fabs(results[i] - results_ref[i]) > 1000. * CEED_EPSILON * max_result) {
+          // LCOV_EXCL_START
+          printf("Error for P %" CeedInt_FMT " Q %" CeedInt_FMT ", result[%" CeedInt_FMT "] = %f != %f\n", P, Q, i, results[i], results_ref[i]);
+          // LCOV_EXCL_STOP
+        }
+      }
+    }
+  }
+
+  CeedDestroy(&ceed);
+  CeedDestroy(&ceed_ref);
+  return 0;
+}
@@ -0,0 +1,130 @@
+/// @file
+/// Test creation, action, and destruction for mass matrix operator with selectable element block size
+/// \test Test creation, action, and destruction for mass matrix operator with selectable element block size
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "t510-operator.h"
+
+static void ApplyMass(const char *resource, CeedInt block_size, CeedInt nx, CeedInt ny, CeedScalar *v_out) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x, elem_restriction_u, elem_restriction_q_data;
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup, qf_mass;
+  CeedOperator        op_setup, op_mass;
+  CeedVector          q_data, x, u, v;
+  CeedInt             num_elem = nx * ny, dim = 2, p = 3, q = 4;
+  CeedInt             num_dofs = (nx * 2 + 1) * (ny * 2 + 1), num_qpts = num_elem * q * q;
+  CeedInt             ind_x[num_elem * p * p];
+  CeedScalar          x_array[dim * num_dofs], u_array[num_dofs];
+
+  CeedInit(resource, &ceed);
+  if (block_size > 0) CeedSetBlockSize(ceed, block_size);
+
+  for (CeedInt i = 0; i < num_dofs; i++) {
+    x_array[i]            = (1. / (nx * 2)) * (CeedScalar)(i % (nx * 2 + 1));
+    x_array[i + num_dofs] = (1. / (ny * 2)) * (CeedScalar)(i / (nx * 2 + 1));
+    u_array[i]            = 1.0 + x_array[i] * x_array[i + num_dofs];
+  }
+  CeedVectorCreate(ceed, dim * num_dofs, &x);
+  CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  CeedVectorCreate(ceed, num_dofs, &u);
+  CeedVectorSetArray(u, CEED_MEM_HOST, CEED_COPY_VALUES, u_array);
+  CeedVectorCreate(ceed, num_dofs, &v);
+  CeedVectorCreate(ceed, num_qpts, &q_data);
+
+  // Restrictions
+  for (CeedInt e = 0; e < num_elem; e++) {
+    const CeedInt col = e % nx, row = e / nx, offset = col * 2 + row * (nx * 2 + 1) * 2;
+
+    for (CeedInt j = 0; j < p; j++) {
+      for (CeedInt i = 0; i < p; i++) ind_x[e * p * p + j * p + i] = offset + j * (nx * 2 + 1) + i;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p * p, dim, num_dofs, dim * num_dofs, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+  CeedElemRestrictionCreate(ceed, num_elem, p * p, 1, 1, num_dofs, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_u);
+
+  CeedInt strides_q_data[3] = {1, q * q, q * q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q * q, 1, num_qpts, strides_q_data, &elem_restriction_q_data);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, p, q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, 1, p, q, CEED_GAUSS, &basis_u);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", dim * dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", elem_restriction_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass);
+  CeedOperatorSetField(op_mass, "rho", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_mass, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_setup, x, q_data, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_mass, u, v, CEED_REQUEST_IMMEDIATE);
+
+  // Copy output
+  {
+    const CeedScalar *v_array;
+
+    CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+    for (CeedInt i = 0; i < num_dofs; i++) v_out[i] = v_array[i];
+    CeedVectorRestoreArrayRead(v, &v_array);
+  }
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&q_data);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedDestroy(&ceed);
+}
+
+int main(int argc, char **argv) {
+  const char *resources[3]   = {"/cpu/self/opt/blocked:block_size=4", "/cpu/self/opt/blocked", "/cpu/self/opt/blocked:block_size=32:threads=2"};
+  CeedInt     block_sizes[3] = {0, 16, 0};
+  CeedInt     nx = 7, ny = 5, num_dofs = (nx * 2 + 1) * (ny * 2 + 1);
+  CeedScalar  v[num_dofs], v_block[num_dofs];
+
+  ApplyMass(argv[1], 0, nx, ny, v);
+  for (CeedInt r = 0; r < 3; r++) {
+    ApplyMass(resources[r], block_sizes[r], nx, ny, v_block);
+
+    // Check output
+    CeedScalar sum = 0.0;
+
+    for (CeedInt i = 0; i < num_dofs; i++) {
+      if (fabs(v[i] - v_block[i]) > 100. * CEED_EPSILON) {
+        // LCOV_EXCL_START
+        printf("%s [%" CeedInt_FMT "] v %g != v_block %g\n", resources[r], i, v[i], v_block[i]);
+        // LCOV_EXCL_STOP
+      }
+      sum += v_block[i];
+    }
+    if (fabs(sum - 1.25) > 100. * CEED_EPSILON) printf("%s Computed Area: %f != True Area: 1.25\n", resources[r], sum);
+  }
+  return 0;
+}
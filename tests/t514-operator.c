@@ -0,0 +1,129 @@
+/// @file
+/// Test non-blocking application of mass matrix operator
+/// \test Test non-blocking application of mass matrix operator
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "t510-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x, elem_restriction_u, elem_restriction_q_data;
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup, qf_mass;
+  CeedOperator        op_setup, op_mass;
+  CeedVector          q_data, x, u, v;
+  CeedInt             nx = 7, ny = 5, num_elem = nx * ny, dim = 2, p = 3, q = 4;
+  CeedInt             num_dofs = (nx * 2 + 1) * (ny * 2 + 1), num_qpts = num_elem * q * q;
+  CeedInt             ind_x[num_elem * p * p];
+  CeedScalar          x_array[dim * num_dofs], u_array[num_dofs];
+  CeedRequest         request = NULL;
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt i = 0; i < num_dofs; i++) {
+    x_array[i]            = (1. / (nx * 2)) * (CeedScalar)(i % (nx * 2 + 1));
+    x_array[i + num_dofs] = (1. / (ny * 2)) * (CeedScalar)(i / (nx * 2 + 1));
+    u_array[i]            = 1.0 + x_array[i] * x_array[i + num_dofs];
+  }
+  CeedVectorCreate(ceed, dim * num_dofs, &x);
+  CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  CeedVectorCreate(ceed, num_dofs, &u);
+  CeedVectorSetArray(u, CEED_MEM_HOST, CEED_COPY_VALUES, u_array);
+  CeedVectorCreate(ceed, num_dofs, &v);
+  CeedVectorCreate(ceed, num_qpts, &q_data);
+
+  // Restrictions
+  for (CeedInt e = 0; e < num_elem; e++) {
+    const CeedInt col = e % nx, row = e / nx, offset = col * 2 + row * (nx * 2 + 1) * 2;
+
+    for (CeedInt j = 0; j < p; j++) {
+      for (CeedInt i = 0; i < p; i++) ind_x[e * p * p + j * p + i] = offset + j * (nx * 2 + 1) + i;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p * p, dim, num_dofs, dim * num_dofs, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+  CeedElemRestrictionCreate(ceed, num_elem, p * p, 1, 1, num_dofs, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_u);
+
+  CeedInt strides_q_data[3] = {1, q * q, q * q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q * q, 1, num_qpts, strides_q_data, &elem_restriction_q_data);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, p, q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, 1, p, q, CEED_GAUSS, &basis_u);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", dim * dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", elem_restriction_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass);
+  CeedOperatorSetField(op_mass, "rho", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_mass, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_setup, x, q_data, &request);
+  CeedRequestWait(&request);
+  if (request) printf("Request not zeroed on completion\n");
+
+  // Apply mass operator while unrelated work proceeds
+  CeedScalar u_sum = 0.0;
+
+  CeedOperatorApply(op_mass, u, v, &request);
+  for (CeedInt i = 0; i < num_dofs; i++) u_sum += u_array[i];
+  CeedRequestWait(&request);
+  if (u_sum <= 0.0) printf("Unexpected sum of u: %f\n", u_sum);
+
+  // Check output
+  {
+    const CeedScalar *v_array;
+    CeedScalar        sum = 0.0;
+
+    CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+    for (CeedInt i = 0; i < num_dofs; i++) sum += v_array[i];
+    CeedVectorRestoreArrayRead(v, &v_array);
+    if (fabs(sum - 1.25) > 100. * CEED_EPSILON) printf("Computed Area: %f != True Area: 1.25\n", sum);
+  }
+
+  // Apply and add
+  CeedOperatorApplyAdd(op_mass, u, v, &request);
+  CeedRequestWait(&request);
+  {
+    const CeedScalar *v_array;
+    CeedScalar        sum = 0.0;
+
+    CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+    for (CeedInt i = 0; i < num_dofs; i++) sum += v_array[i];
+    CeedVectorRestoreArrayRead(v, &v_array);
+    if (fabs(sum - 2.5) > 100. * CEED_EPSILON) printf("Computed Area: %f != True Area: 2.5\n", sum);
+  }
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&q_data);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedDestroy(&ceed);
+  return 0;
+}
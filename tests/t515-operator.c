@@ -0,0 +1,165 @@
+/// @file
+/// Test assembly of mass and Poisson operator QFunction with threaded element loop
+/// \test Test assembly of mass and Poisson operator QFunction with threaded element loop
+
+//TESTARGS(name="1 thread") {ceed_resource} 1
+//TESTARGS(name="4 threads") {ceed_resource} 4
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "t532-operator.h"
+
+static void AssembleQFunction(const char *resource, const char *num_threads, CeedInt nx, CeedInt ny, CeedScalar *assembled_out) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x, elem_restriction_u, elem_restriction_q_data_mass, elem_restriction_q_data_diff, elem_restriction_assembled;
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup_mass, qf_setup_diff, qf_apply;
+  CeedOperator        op_setup_mass, op_setup_diff, op_apply;
+  CeedVector          q_data_mass, q_data_diff, x, assembled;
+  CeedInt             num_elem = nx * ny, p = 3, q = 4, dim = 2;
+  CeedInt             num_dofs = (nx * 2 + 1) * (ny * 2 + 1), num_qpts = num_elem * q * q;
+  CeedInt             ind_x[num_elem * p * p];
+  char                resource_threads[256];
+
+  // Only the opt backends take a number of threads
+  if (num_threads && !strncmp(resource, "/cpu/self/opt", 13)) {
+    snprintf(resource_threads, sizeof(resource_threads), "%s:threads=%s", resource, num_threads);
+  } else {
+    snprintf(resource_threads, sizeof(resource_threads), "%s", resource);
+  }
+  CeedInit(resource_threads, &ceed);
+
+  // Vectors
+  CeedVectorCreate(ceed, dim * num_dofs, &x);
+  {
+    CeedScalar x_array[dim * num_dofs];
+
+    for (CeedInt i = 0; i < nx * 2 + 1; i++) {
+      for (CeedInt j = 0; j < ny * 2 + 1; j++) {
+        x_array[i + j * (nx * 2 + 1) + 0 * num_dofs] = (CeedScalar)i / (2 * nx) + 0.05 * (CeedScalar)(j % 2) / nx;
+        x_array[i + j * (nx * 2 + 1) + 1 * num_dofs] = (CeedScalar)j / (2 * ny);
+      }
+    }
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedVectorCreate(ceed, num_qpts, &q_data_mass);
+  CeedVectorCreate(ceed, num_qpts * dim * (dim + 1) / 2, &q_data_diff);
+
+  // Restrictions
+  for (CeedInt i = 0; i < num_elem; i++) {
+    const CeedInt col = i % nx, row = i / nx, offset = col * (p - 1) + row * (nx * 2 + 1) * (p - 1);
+
+    for (CeedInt j = 0; j < p; j++) {
+      for (CeedInt k = 0; k < p; k++) ind_x[p * (p * i + k) + j] = offset + k * (nx * 2 + 1) + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p * p, dim, num_dofs, dim * num_dofs, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+  CeedElemRestrictionCreate(ceed, num_elem, p * p, 1, 1, num_dofs, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_u);
+
+  CeedInt strides_q_data_mass[3] = {1, q * q, q * q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q * q, 1, num_qpts, strides_q_data_mass, &elem_restriction_q_data_mass);
+
+  CeedInt strides_q_data_diff[3] = {1, q * q, q * q * dim * (dim + 1) / 2};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q * q, dim * (dim + 1) / 2, dim * (dim + 1) / 2 * num_qpts, strides_q_data_diff,
+                                   &elem_restriction_q_data_diff);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, p, q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, 1, p, q, CEED_GAUSS, &basis_u);
+
+  // QFunctions - setup
+  CeedQFunctionCreateInterior(ceed, 1, setup_mass, setup_mass_loc, &qf_setup_mass);
+  CeedQFunctionAddInput(qf_setup_mass, "dx", dim * dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddInput(qf_setup_mass, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddOutput(qf_setup_mass, "q data", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, setup_diff, setup_diff_loc, &qf_setup_diff);
+  CeedQFunctionAddInput(qf_setup_diff, "dx", dim * dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddInput(qf_setup_diff, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddOutput(qf_setup_diff, "q data", dim * (dim + 1) / 2, CEED_EVAL_NONE);
+
+  // Operators - setup
+  CeedOperatorCreate(ceed, qf_setup_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup_mass);
+  CeedOperatorSetField(op_setup_mass, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup_mass, "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup_mass, "q data", elem_restriction_q_data_mass, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_setup_diff, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup_diff);
+  CeedOperatorSetField(op_setup_diff, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup_diff, "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup_diff, "q data", elem_restriction_q_data_diff, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_setup_mass, x, q_data_mass, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_setup_diff, x, q_data_diff, CEED_REQUEST_IMMEDIATE);
+
+  // QFunction - apply
+  CeedQFunctionCreateInterior(ceed, 1, apply, apply_loc, &qf_apply);
+  CeedQFunctionAddInput(qf_apply, "du", dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddInput(qf_apply, "mass q data", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_apply, "diff q data", dim * (dim + 1) / 2, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_apply, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_apply, "v", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_apply, "dv", dim, CEED_EVAL_GRAD);
+
+  // Operator - apply
+  CeedOperatorCreate(ceed, qf_apply, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_apply);
+  CeedOperatorSetField(op_apply, "du", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_apply, "mass q data", elem_restriction_q_data_mass, CEED_BASIS_NONE, q_data_mass);
+  CeedOperatorSetField(op_apply, "diff q data", elem_restriction_q_data_diff, CEED_BASIS_NONE, q_data_diff);
+  CeedOperatorSetField(op_apply, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_apply, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_apply, "dv", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  // Assemble QFunction
+  CeedOperatorLinearAssembleQFunction(op_apply, &assembled, &elem_restriction_assembled, CEED_REQUEST_IMMEDIATE);
+
+  // Copy output
+  {
+    const CeedScalar *assembled_array;
+
+    CeedVectorGetArrayRead(assembled, CEED_MEM_HOST, &assembled_array);
+    for (CeedInt i = 0; i < num_qpts * (dim + 1) * (dim + 1); i++) assembled_out[i] = assembled_array[i];
+    CeedVectorRestoreArrayRead(assembled, &assembled_array);
+  }
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&assembled);
+  CeedVectorDestroy(&q_data_mass);
+  CeedVectorDestroy(&q_data_diff);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data_mass);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data_diff);
+  CeedElemRestrictionDestroy(&elem_restriction_assembled);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedQFunctionDestroy(&qf_setup_mass);
+  CeedQFunctionDestroy(&qf_setup_diff);
+  CeedQFunctionDestroy(&qf_apply);
+  CeedOperatorDestroy(&op_setup_mass);
+  CeedOperatorDestroy(&op_setup_diff);
+  CeedOperatorDestroy(&op_apply);
+  CeedDestroy(&ceed);
+}
+
+int main(int argc, char **argv) {
+  CeedInt    nx = 7, ny = 5, num_entries = nx * ny * 4 * 4 * 3 * 3;
+  CeedScalar assembled[num_entries], assembled_ref[num_entries];
+
+  // The QFunction has three active input and output components, assembled in batches of directions
+  AssembleQFunction(argv[1], argv[2], nx, ny, assembled);
+  AssembleQFunction("/cpu/self/ref/serial", NULL, nx, ny, assembled_ref);
+
+  // Check output
+  for (CeedInt i = 0; i < num_entries; i++) {
+    if (fabs(assembled[i] - assembled_ref[i]) > 100. * CEED_EPSILON) {
+      // LCOV_EXCL_START
+      printf("[%" CeedInt_FMT "] assembled %g != assembled_ref %g\n", i, assembled[i], assembled_ref[i]);
+      // LCOV_EXCL_STOP
+    }
+  }
+  return 0;
+}
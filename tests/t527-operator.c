@@ -0,0 +1,152 @@
+/// @file
+/// Test vector mass operator with a read-only QFunction context on JiT QFunctions
+/// \test Test vector mass operator with a read-only QFunction context on JiT QFunctions
+#include <ceed.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "t527-operator.h"
+
+#define NUM_ELEM 15
+#define NUM_COMP 2
+#define P 5
+#define Q 8
+#define NUM_NODES_X (NUM_ELEM + 1)
+#define NUM_NODES_U (NUM_ELEM * (P - 1) + 1)
+
+// Apply the scaled mass operator before and after changing the context
+static void ComputeMass(const char *resource, CeedScalar v_out[2][NUM_COMP * NUM_NODES_U]) {
+  Ceed                 ceed;
+  CeedElemRestriction  elem_restriction_x, elem_restriction_u, elem_restriction_q_data;
+  CeedBasis            basis_x, basis_u;
+  CeedQFunction        qf_setup, qf_mass;
+  CeedQFunctionContext ctx;
+  CeedOperator         op_setup, op_mass;
+  CeedVector           q_data, x, u, v;
+  CeedInt              ind_x[NUM_ELEM * 2], ind_u[NUM_ELEM * P];
+  ScaledMassContext    ctx_data = {.scale = 1.5, .shift = 0.25};
+
+  CeedInit(resource, &ceed);
+
+  CeedVectorCreate(ceed, NUM_NODES_X, &x);
+  {
+    CeedScalar x_array[NUM_NODES_X];
+
+    for (CeedInt i = 0; i < NUM_NODES_X; i++) x_array[i] = (CeedScalar)i / (NUM_NODES_X - 1) + 0.01 * sin(3.0 * i);
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedVectorCreate(ceed, NUM_COMP * NUM_NODES_U, &u);
+  {
+    CeedScalar u_array[NUM_COMP * NUM_NODES_U];
+
+    for (CeedInt i = 0; i < NUM_COMP * NUM_NODES_U; i++) u_array[i] = 1.0 + cos(0.7 * i) / 3.0;
+    CeedVectorSetArray(u, CEED_MEM_HOST, CEED_COPY_VALUES, u_array);
+  }
+  CeedVectorCreate(ceed, NUM_COMP * NUM_NODES_U, &v);
+  CeedVectorCreate(ceed, NUM_ELEM * Q, &q_data);
+
+  // Restrictions
+  for (CeedInt i = 0; i < NUM_ELEM; i++) {
+    ind_x[2 * i + 0] = i;
+    ind_x[2 * i + 1] = i + 1;
+  }
+  CeedElemRestrictionCreate(ceed, NUM_ELEM, 2, 1, 1, NUM_NODES_X, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+
+  for (CeedInt i = 0; i < NUM_ELEM; i++) {
+    for (CeedInt j = 0; j < P; j++) ind_u[P * i + j] = i * (P - 1) + j;
+  }
+  CeedElemRestrictionCreate(ceed, NUM_ELEM, P, NUM_COMP, NUM_NODES_U, NUM_COMP * NUM_NODES_U, CEED_MEM_HOST, CEED_USE_POINTER, ind_u,
+                            &elem_restriction_u);
+
+  CeedInt strides_q_data[3] = {1, Q, Q};
+  CeedElemRestrictionCreateStrided(ceed, NUM_ELEM, Q, 1, Q * NUM_ELEM, strides_q_data, &elem_restriction_q_data);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, NUM_COMP, P, Q, CEED_GAUSS, &basis_u);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, scaled_mass, scaled_mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", NUM_COMP, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", NUM_COMP, CEED_EVAL_INTERP);
+
+  CeedQFunctionContextCreate(ceed, &ctx);
+  CeedQFunctionContextSetData(ctx, CEED_MEM_HOST, CEED_COPY_VALUES, sizeof(ctx_data), &ctx_data);
+  CeedQFunctionContextRegisterDouble(ctx, "scale", offsetof(ScaledMassContext, scale), 1, "scaling of u");
+  CeedQFunctionSetContext(qf_mass, ctx);
+  CeedQFunctionSetContextWritable(qf_mass, false);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", elem_restriction_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass);
+  CeedOperatorSetField(op_mass, "rho", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_mass, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_setup, x, q_data, CEED_REQUEST_IMMEDIATE);
+
+  // Apply, then apply again after the context changes
+  for (CeedInt k = 0; k < 2; k++) {
+    const CeedScalar *v_array;
+
+    if (k == 1) {
+      CeedContextFieldLabel scale_label;
+      double                scale = -0.5;
+
+      CeedOperatorGetContextFieldLabel(op_mass, "scale", &scale_label);
+      CeedOperatorSetContextDouble(op_mass, scale_label, &scale);
+    }
+    CeedOperatorApply(op_mass, u, v, CEED_REQUEST_IMMEDIATE);
+    CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+    for (CeedInt i = 0; i < NUM_COMP * NUM_NODES_U; i++) v_out[k][i] = v_array[i];
+    CeedVectorRestoreArrayRead(v, &v_array);
+  }
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&q_data);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedQFunctionContextDestroy(&ctx);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedDestroy(&ceed);
+}
+
+int main(int argc, char **argv) {
+  const char *jit_resources[3] = {"/cpu/self/opt/serial:jit=1", "/cpu/self/opt/blocked:jit=1", "/cpu/self/opt/blocked:threads=2:jit=1"};
+  CeedScalar  v[2][NUM_COMP * NUM_NODES_U], v_jit[2][NUM_COMP * NUM_NODES_U];
+
+  ComputeMass(argv[1], v);
+  for (CeedInt r = 0; r < 3; r++) {
+    ComputeMass(jit_resources[r], v_jit);
+    for (CeedInt k = 0; k < 2; k++) {
+      for (CeedInt i = 0; i < NUM_COMP * NUM_NODES_U; i++) {
+        if (fabs(v_jit[k][i] - v[k][i]) > 1000. * CEED_EPSILON * fmax(1.0, fabs(v[k][i]))) {
+          // LCOV_EXCL_START
+          printf("Error in %s, apply %" CeedInt_FMT ", v[%" CeedInt_FMT "] = %f != %f\n", jit_resources[r], k, i, v_jit[k][i], v[k][i]);
+          // LCOV_EXCL_STOP
+        }
+      }
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,32 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#include <ceed/types.h>
+
+typedef struct {
+  CeedScalar scale, shift;
+} ScaledMassContext;
+
+CEED_QFUNCTION(setup)(void *ctx, const CeedInt Q, const CeedScalar *const *in, CeedScalar *const *out) {
+  const CeedScalar *weight = in[0], *dxdX = in[1];
+  CeedScalar       *rho = out[0];
+
+  for (CeedInt i = 0; i < Q; i++) rho[i] = weight[i] * dxdX[i];
+  return 0;
+}
+
+CEED_QFUNCTION(scaled_mass)(void *ctx, const CeedInt Q, const CeedScalar *const *in, CeedScalar *const *out) {
+  const ScaledMassContext *context = (const ScaledMassContext *)ctx;
+  const CeedScalar        *rho = in[0];
+  const CeedScalar(*u)[CEED_Q_VLA] = (const CeedScalar(*)[CEED_Q_VLA])in[1];
+  CeedScalar(*v)[CEED_Q_VLA]       = (CeedScalar(*)[CEED_Q_VLA])out[0];
+
+  for (CeedInt i = 0; i < Q; i++) {
+    for (CeedInt c = 0; c < 2; c++) v[c][i] = rho[i] * (context->scale * u[c][i] + context->shift);
+  }
+  return 0;
+}
@@ -0,0 +1,169 @@
+/// @file
+/// Test composite operator with suboperators sharing active element restrictions
+/// \test Test composite operator with suboperators sharing active element restrictions
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "t528-operator.h"
+
+#define NUM_ELEM 15
+#define NUM_ELEM_HALF 7
+#define NUM_ELEM_FEW 2
+#define P 5
+#define Q 8
+#define NUM_NODES_X (NUM_ELEM + 1)
+#define NUM_NODES_U (NUM_ELEM * (P - 1) + 1)
+#define NUM_SUB 8
+
+// Apply the composite operator, then add to the result with a second apply
+static void ApplyComposite(const char *resource, CeedScalar v_out[2][NUM_NODES_U]) {
+  Ceed                ceed, ceed_other;
+  CeedElemRestriction elem_restriction_x, elem_restriction_u[3], elem_restriction_q_data[3];
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup, qf_mass, qf_diff, qf_scale;
+  CeedOperator        op_setup, op_sub[NUM_SUB], op_composite;
+  CeedVector          q_data, x, u, v;
+  CeedInt             ind_x[NUM_ELEM * 2], ind_u[NUM_ELEM * P], num_elem[3] = {NUM_ELEM, NUM_ELEM_HALF, NUM_ELEM_FEW};
+
+  CeedInit(resource, &ceed);
+  CeedInit(resource, &ceed_other);
+
+  CeedVectorCreate(ceed, NUM_NODES_X, &x);
+  {
+    CeedScalar x_array[NUM_NODES_X];
+
+    for (CeedInt i = 0; i < NUM_NODES_X; i++) x_array[i] = (CeedScalar)i / (NUM_NODES_X - 1) + 0.01 * sin(3.0 * i);
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedVectorCreate(ceed, NUM_NODES_U, &u);
+  {
+    CeedScalar u_array[NUM_NODES_U];
+
+    for (CeedInt i = 0; i < NUM_NODES_U; i++) u_array[i] = 1.0 + cos(0.7 * i) / 3.0;
+    CeedVectorSetArray(u, CEED_MEM_HOST, CEED_COPY_VALUES, u_array);
+  }
+  CeedVectorCreate(ceed, NUM_NODES_U, &v);
+  CeedVectorCreate(ceed, NUM_ELEM * Q, &q_data);
+
+  // Restrictions, over all elements, the first half of the elements, and few enough elements to shrink the element block
+  for (CeedInt i = 0; i < NUM_ELEM; i++) {
+    ind_x[2 * i + 0] = i;
+    ind_x[2 * i + 1] = i + 1;
+  }
+  CeedElemRestrictionCreate(ceed, NUM_ELEM, 2, 1, 1, NUM_NODES_X, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+
+  for (CeedInt i = 0; i < NUM_ELEM; i++) {
+    for (CeedInt j = 0; j < P; j++) ind_u[P * i + j] = i * (P - 1) + j;
+  }
+  CeedInt strides_q_data[3] = {1, Q, Q};
+  for (CeedInt r = 0; r < 3; r++) {
+    CeedElemRestrictionCreate(ceed, num_elem[r], P, 1, 1, NUM_NODES_U, CEED_MEM_HOST, CEED_USE_POINTER, ind_u, &elem_restriction_u[r]);
+    CeedElemRestrictionCreateStrided(ceed, num_elem[r], Q, 1, Q * NUM_ELEM, strides_q_data, &elem_restriction_q_data[r]);
+  }
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &basis_u);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  CeedQFunctionCreateInterior(ceed, 1, diff, diff_loc, &qf_diff);
+  CeedQFunctionAddInput(qf_diff, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_diff, "du", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_diff, "dv", 1, CEED_EVAL_GRAD);
+
+  CeedQFunctionCreateInterior(ceed, 1, scale, scale_loc, &qf_scale);
+  CeedQFunctionAddInput(qf_scale, "u", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddOutput(qf_scale, "v", 1, CEED_EVAL_NONE);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", elem_restriction_q_data[0], CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+  CeedOperatorApply(op_setup, x, q_data, CEED_REQUEST_IMMEDIATE);
+
+  // -- Mass and diffusion sharing the restriction of u, over all elements, the first half, and a smaller element block
+  for (CeedInt s = 0; s < 6; s++) {
+    const bool    is_mass = s % 2 == 0;
+    const CeedInt r       = s / 2;
+
+    CeedOperatorCreate(ceed, is_mass ? qf_mass : qf_diff, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_sub[s]);
+    CeedOperatorSetField(op_sub[s], "rho", elem_restriction_q_data[r], CEED_BASIS_NONE, q_data);
+    CeedOperatorSetField(op_sub[s], is_mass ? "u" : "du", elem_restriction_u[r], basis_u, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op_sub[s], is_mass ? "v" : "dv", elem_restriction_u[r], basis_u, CEED_VECTOR_ACTIVE);
+  }
+  // -- Scaling at the nodes, with an input sharing the restriction of u and an output without basis action
+  CeedOperatorCreate(ceed, qf_scale, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_sub[6]);
+  CeedOperatorSetField(op_sub[6], "u", elem_restriction_u[0], CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_sub[6], "v", elem_restriction_u[0], CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+  // -- Mass on another Ceed, with the same restriction of u
+  CeedOperatorCreate(ceed_other, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_sub[7]);
+  CeedOperatorSetField(op_sub[7], "rho", elem_restriction_q_data[0], CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_sub[7], "u", elem_restriction_u[0], basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_sub[7], "v", elem_restriction_u[0], basis_u, CEED_VECTOR_ACTIVE);
+
+  CeedCompositeOperatorCreate(ceed, &op_composite);
+  for (CeedInt s = 0; s < NUM_SUB; s++) CeedCompositeOperatorAddSub(op_composite, op_sub[s]);
+
+  for (CeedInt k = 0; k < 2; k++) {
+    const CeedScalar *v_array;
+
+    if (k == 0) CeedOperatorApply(op_composite, u, v, CEED_REQUEST_IMMEDIATE);
+    else CeedOperatorApplyAdd(op_composite, u, v, CEED_REQUEST_IMMEDIATE);
+    CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+    for (CeedInt i = 0; i < NUM_NODES_U; i++) v_out[k][i] = v_array[i];
+    CeedVectorRestoreArrayRead(v, &v_array);
+  }
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&q_data);
+  for (CeedInt r = 0; r < 3; r++) {
+    CeedElemRestrictionDestroy(&elem_restriction_u[r]);
+    CeedElemRestrictionDestroy(&elem_restriction_q_data[r]);
+  }
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedQFunctionDestroy(&qf_diff);
+  CeedQFunctionDestroy(&qf_scale);
+  CeedOperatorDestroy(&op_setup);
+  for (CeedInt s = 0; s < NUM_SUB; s++) CeedOperatorDestroy(&op_sub[s]);
+  CeedOperatorDestroy(&op_composite);
+  CeedDestroy(&ceed_other);
+  CeedDestroy(&ceed);
+}
+
+int main(int argc, char **argv) {
+  CeedScalar v[2][NUM_NODES_U], v_ref[2][NUM_NODES_U];
+
+  ApplyComposite(argv[1], v);
+  ApplyComposite("/cpu/self/ref/serial", v_ref);
+
+  // Check output
+  for (CeedInt k = 0; k < 2; k++) {
+    for (CeedInt i = 0; i < NUM_NODES_U; i++) {
+      if (fabs(v[k][i] - v_ref[k][i]) > 500. * CEED_EPSILON * fmax(1.0, fabs(v_ref[k][i]))) {
+        // LCOV_EXCL_START
+        printf("Error in apply %" CeedInt_FMT ", v[%" CeedInt_FMT "] = %f != %f\n", k, i, v[k][i], v_ref[k][i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,40 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#include <ceed/types.h>
+
+CEED_QFUNCTION(setup)(void *ctx, const CeedInt Q, const CeedScalar *const *in, CeedScalar *const *out) {
+  const CeedScalar *weight = in[0], *dxdX = in[1];
+  CeedScalar       *rho = out[0];
+
+  for (CeedInt i = 0; i < Q; i++) rho[i] = weight[i] * dxdX[i];
+  return 0;
+}
+
+CEED_QFUNCTION(mass)(void *ctx, const CeedInt Q, const CeedScalar *const *in, CeedScalar *const *out) {
+  const CeedScalar *rho = in[0], *u = in[1];
+  CeedScalar       *v = out[0];
+
+  for (CeedInt i = 0; i < Q; i++) v[i] = rho[i] * u[i];
+  return 0;
+}
+
+CEED_QFUNCTION(diff)(void *ctx, const CeedInt Q, const CeedScalar *const *in, CeedScalar *const *out) {
+  const CeedScalar *rho = in[0], *du = in[1];
+  CeedScalar       *dv = out[0];
+
+  for (CeedInt i = 0; i < Q; i++) dv[i] = rho[i] * du[i];
+  return 0;
+}
+
+CEED_QFUNCTION(scale)(void *ctx, const CeedInt Q, const CeedScalar *const *in, CeedScalar *const *out) {
+  const CeedScalar *u = in[0];
+  CeedScalar       *v = out[0];
+
+  for (CeedInt i = 0; i < Q; i++) v[i] = 0.5 * u[i];
+  return 0;
+}
@@ -0,0 +1,224 @@
+/// @file
+/// Test profiling of the phases of operator and composite operator applications
+/// \test Test profiling of the phases of operator and composite operator applications
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "t500-operator.h"
+
+#define NUM_ELEM 15
+#define P 5
+#define Q 8
+#define NUM_NODES_X (NUM_ELEM + 1)
+#define NUM_NODES_U (NUM_ELEM * (P - 1) + 1)
+
+// Check the number of calls of every phase, the estimated FLOPs and QFunction bytes, and the phase times against the wall time of the calls
+static double CheckProfile(CeedOperator op, const char *op_name, CeedSize num_calls_true, CeedSize flops_per_call, double elapsed, bool is_timed) {
+  CeedSize num_calls, bytes, flops, total_flops = 0;
+  double   time, total_time = 0.0;
+
+  for (CeedInt p = 0; p < CEED_OPERATOR_NUM_PHASES; p++) {
+    CeedOperatorGetProfile(op, (CeedOperatorPhase)p, &num_calls, &time, &bytes, &flops);
+    if (num_calls != num_calls_true) {
+      // LCOV_EXCL_START
+      printf("Error in %s %s calls: %" CeedSize_FMT " != %" CeedSize_FMT "\n", op_name, CeedOperatorPhases[p], num_calls, num_calls_true);
+      // LCOV_EXCL_STOP
+    }
+    if (time < 0.0) {
+      // LCOV_EXCL_START
+      printf("Error in %s %s time: %f < 0\n", op_name, CeedOperatorPhases[p], time);
+      // LCOV_EXCL_STOP
+    }
+    total_flops += flops;
+    total_time += time;
+  }
+  if (total_flops != num_calls_true * flops_per_call) {
+    // LCOV_EXCL_START
+    printf("Error in %s FLOPs: %" CeedSize_FMT " != %" CeedSize_FMT "\n", op_name, total_flops, num_calls_true * flops_per_call);
+    // LCOV_EXCL_STOP
+  }
+  if (total_time > elapsed) {
+    // LCOV_EXCL_START
+    printf("Error in %s time: phases %g s > total %g s\n", op_name, total_time, elapsed);
+    // LCOV_EXCL_STOP
+  }
+  if (is_timed && num_calls_true > 0 && total_time <= 0.0) {
+    // LCOV_EXCL_START
+    printf("Error in %s time: %f <= 0\n", op_name, total_time);
+    // LCOV_EXCL_STOP
+  }
+  if (num_calls_true == 0 && total_time != 0.0) {
+    // LCOV_EXCL_START
+    printf("Error in %s time: %f != 0 after reset\n", op_name, total_time);
+    // LCOV_EXCL_STOP
+  }
+
+  // QFunction reads rho and u and writes v at each quadrature point
+  CeedOperatorGetProfile(op, CEED_OPERATOR_PHASE_QFUNCTION, NULL, NULL, &bytes, NULL);
+  if (bytes != num_calls_true * 3 * NUM_ELEM * Q * (CeedSize)sizeof(CeedScalar)) {
+    // LCOV_EXCL_START
+    printf("Error in %s QFunction bytes: %" CeedSize_FMT " != %" CeedSize_FMT "\n", op_name, bytes,
+           num_calls_true * 3 * NUM_ELEM * Q * (CeedSize)sizeof(CeedScalar));
+    // LCOV_EXCL_STOP
+  }
+  return total_time;
+}
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x, elem_restriction_u, elem_restriction_q_data;
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup, qf_mass;
+  CeedOperator        op_setup, op_mass, op_mass_2, op_composite;
+  CeedVector          q_data, x, u, v;
+  CeedInt             ind_x[NUM_ELEM * 2], ind_u[NUM_ELEM * P];
+  CeedSize            flops_per_call;
+  double              start, end, time, time_disabled;
+  const bool          is_timed = !strncmp(argv[1], "/cpu/self", 9);
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, NUM_NODES_X, &x);
+  {
+    CeedScalar x_array[NUM_NODES_X];
+
+    for (CeedInt i = 0; i < NUM_NODES_X; i++) x_array[i] = (CeedScalar)i / (NUM_NODES_X - 1);
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedVectorCreate(ceed, NUM_NODES_U, &u);
+  CeedVectorSetValue(u, 1.0);
+  CeedVectorCreate(ceed, NUM_NODES_U, &v);
+  CeedVectorCreate(ceed, NUM_ELEM * Q, &q_data);
+
+  // Restrictions
+  for (CeedInt i = 0; i < NUM_ELEM; i++) {
+    ind_x[2 * i + 0] = i;
+    ind_x[2 * i + 1] = i + 1;
+  }
+  CeedElemRestrictionCreate(ceed, NUM_ELEM, 2, 1, 1, NUM_NODES_X, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+
+  for (CeedInt i = 0; i < NUM_ELEM; i++) {
+    for (CeedInt j = 0; j < P; j++) ind_u[P * i + j] = i * (P - 1) + j;
+  }
+  CeedElemRestrictionCreate(ceed, NUM_ELEM, P, 1, 1, NUM_NODES_U, CEED_MEM_HOST, CEED_USE_POINTER, ind_u, &elem_restriction_u);
+
+  CeedInt strides_q_data[3] = {1, Q, Q};
+  CeedElemRestrictionCreateStrided(ceed, NUM_ELEM, Q, 1, Q * NUM_ELEM, strides_q_data, &elem_restriction_q_data);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &basis_u);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+  CeedQFunctionSetUserFlopsEstimate(qf_mass, 1);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", elem_restriction_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass);
+  CeedOperatorSetField(op_mass, "rho", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_mass, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetName(op_mass, "mass");
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass_2);
+  CeedOperatorSetField(op_mass_2, "rho", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_mass_2, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass_2, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  CeedCompositeOperatorCreate(ceed, &op_composite);
+  CeedCompositeOperatorAddSub(op_composite, op_mass);
+  CeedCompositeOperatorAddSub(op_composite, op_mass_2);
+
+  CeedOperatorApply(op_setup, x, q_data, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorGetFlopsEstimate(op_mass, &flops_per_call);
+
+  // Profile three applications
+  CeedOperatorSetProfiling(op_mass, true);
+  CeedGetWallTime(&start);
+  for (CeedInt k = 0; k < 3; k++) CeedOperatorApply(op_mass, u, v, CEED_REQUEST_IMMEDIATE);
+  CeedGetWallTime(&end);
+  time = CheckProfile(op_mass, "mass", 3, flops_per_call, end - start, is_timed);
+
+  // Applications are not counted when profiling is disabled
+  CeedOperatorSetProfiling(op_mass, false);
+  CeedOperatorApply(op_mass, u, v, CEED_REQUEST_IMMEDIATE);
+  time_disabled = CheckProfile(op_mass, "disabled mass", 3, flops_per_call, end - start, is_timed);
+  if (time_disabled != time) {
+    // LCOV_EXCL_START
+    printf("Error in disabled mass time: %g != %g\n", time_disabled, time);
+    // LCOV_EXCL_STOP
+  }
+
+  // Reset zeroes the counters
+  CeedOperatorResetProfile(op_mass);
+  CheckProfile(op_mass, "reset mass", 0, flops_per_call, 0.0, is_timed);
+
+  // Composite profiles sum the suboperators, along with the time of work shared between them
+  CeedOperatorSetProfiling(op_composite, true);
+  CeedGetWallTime(&start);
+  for (CeedInt k = 0; k < 2; k++) CeedOperatorApply(op_composite, u, v, CEED_REQUEST_IMMEDIATE);
+  CeedGetWallTime(&end);
+  time = CheckProfile(op_composite, "composite", 4, flops_per_call, end - start, is_timed);
+  {
+    const double time_mass   = CheckProfile(op_mass, "suboperator mass", 2, flops_per_call, end - start, is_timed);
+    const double time_mass_2 = CheckProfile(op_mass_2, "suboperator mass 2", 2, flops_per_call, end - start, is_timed);
+
+    if (time < time_mass + time_mass_2) {
+      // LCOV_EXCL_START
+      printf("Error in composite time: %g < suboperators %g\n", time, time_mass + time_mass_2);
+      // LCOV_EXCL_STOP
+    }
+  }
+
+  // Disabling profiling on the composite disables it on the suboperators
+  CeedOperatorSetProfiling(op_composite, false);
+  CeedOperatorApply(op_composite, u, v, CEED_REQUEST_IMMEDIATE);
+  CheckProfile(op_mass, "disabled suboperator mass", 2, flops_per_call, end - start, is_timed);
+  time_disabled = CheckProfile(op_composite, "disabled composite", 4, flops_per_call, end - start, is_timed);
+  if (time_disabled != time) {
+    // LCOV_EXCL_START
+    printf("Error in disabled composite time: %g != %g\n", time_disabled, time);
+    // LCOV_EXCL_STOP
+  }
+
+  // Reset on the composite zeroes the suboperators
+  CeedOperatorResetProfile(op_composite);
+  CheckProfile(op_composite, "reset composite", 0, flops_per_call, 0.0, is_timed);
+  CheckProfile(op_mass, "reset suboperator mass", 0, flops_per_call, 0.0, is_timed);
+  CheckProfile(op_mass_2, "reset suboperator mass 2", 0, flops_per_call, 0.0, is_timed);
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&q_data);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedOperatorDestroy(&op_mass_2);
+  CeedOperatorDestroy(&op_composite);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,146 @@
+/// @file
+/// Test FDM element inverse for mass and Poisson operator on anisotropic elements
+/// \test Test FDM element inverse for mass and Poisson operator on anisotropic elements
+#include "t542-operator.h"
+
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x, elem_restriction_u, elem_restriction_q_data;
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup, qf_apply;
+  CeedOperator        op_setup, op_apply, op_inverse;
+  CeedVector          q_data, x, u, v, w;
+  CeedInt             num_elem = 3, p = 4, q = 5, dim = 2;
+  CeedInt             num_dofs = num_elem * p * p, num_qpts = num_elem * q * q, q_data_size = 1 + dim * (dim + 1) / 2;
+  CeedScalar          widths[3][2] = {
+      {1.0,  1.0 },
+      {1.0,  0.25},
+      {0.25, 2.0 }
+  };
+
+  CeedInit(argv[1], &ceed);
+
+  // Test skipped if using single precision
+  if (CEED_SCALAR_TYPE == CEED_SCALAR_FP32) return CeedError(ceed, CEED_ERROR_UNSUPPORTED, "Test not implemented in single precision");
+
+  // Vectors
+  CeedVectorCreate(ceed, dim * num_elem * (2 * 2), &x);
+  {
+    CeedScalar x_array[dim * num_elem * (2 * 2)];
+
+    for (CeedInt e = 0; e < num_elem; e++) {
+      for (CeedInt i = 0; i < 2; i++) {
+        for (CeedInt j = 0; j < 2; j++) {
+          x_array[e * dim * 4 + i + j * 2 + 0 * 4] = e + i * widths[e][0];
+          x_array[e * dim * 4 + i + j * 2 + 1 * 4] = j * widths[e][1];
+        }
+      }
+    }
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedVectorCreate(ceed, num_dofs, &u);
+  CeedVectorCreate(ceed, num_dofs, &v);
+  CeedVectorCreate(ceed, num_dofs, &w);
+  CeedVectorCreate(ceed, q_data_size * num_qpts, &q_data);
+
+  // Restrictions
+  CeedInt strides_x[3] = {1, 2 * 2, 2 * 2 * dim};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, 2 * 2, dim, dim * num_elem * 2 * 2, strides_x, &elem_restriction_x);
+
+  CeedInt strides_u[3] = {1, p * p, p * p};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, p * p, 1, num_dofs, strides_u, &elem_restriction_u);
+
+  CeedInt strides_q_data[3] = {1, q * q, q_data_size * q * q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q * q, q_data_size, num_qpts * q_data_size, strides_q_data, &elem_restriction_q_data);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, 2, q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, 1, p, q, CEED_GAUSS, &basis_u);
+
+  // QFunction - setup
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "dx", dim * dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddOutput(qf_setup, "q data", q_data_size, CEED_EVAL_NONE);
+
+  // Operator - setup
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "q data", elem_restriction_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+  // Apply Setup Operator
+  CeedOperatorApply(op_setup, x, q_data, CEED_REQUEST_IMMEDIATE);
+
+  // QFunction - apply
+  CeedQFunctionCreateInterior(ceed, 1, apply, apply_loc, &qf_apply);
+  CeedQFunctionAddInput(qf_apply, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddInput(qf_apply, "du", dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddInput(qf_apply, "q data", q_data_size, CEED_EVAL_NONE);
+  CeedQFunctionAddOutput(qf_apply, "v", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_apply, "dv", dim, CEED_EVAL_GRAD);
+
+  // Operator - apply
+  CeedOperatorCreate(ceed, qf_apply, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_apply);
+  CeedOperatorSetField(op_apply, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_apply, "du", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_apply, "q data", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_apply, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_apply, "dv", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  // Create FDM element inverse
+  CeedOperatorCreateFDMElementInverse(op_apply, &op_inverse, CEED_REQUEST_IMMEDIATE);
+
+  // Set initial values
+  {
+    CeedScalar u_array[num_dofs];
+
+    for (CeedInt i = 0; i < num_dofs; i++) u_array[i] = sin(1.7 * i) + 0.5 * cos(0.3 * i);
+    CeedVectorSetArray(u, CEED_MEM_HOST, CEED_COPY_VALUES, u_array);
+  }
+
+  // Apply original operator and FDM inverse
+  CeedOperatorApply(op_apply, u, v, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_inverse, v, w, CEED_REQUEST_IMMEDIATE);
+
+  // Check output, inverse is exact on affine rectangular elements up to the Laplacian perturbation
+  {
+    const CeedScalar *u_array, *w_array;
+
+    CeedVectorGetArrayRead(u, CEED_MEM_HOST, &u_array);
+    CeedVectorGetArrayRead(w, CEED_MEM_HOST, &w_array);
+    for (CeedInt i = 0; i < num_dofs; i++) {
+      if (fabs(u_array[i] - w_array[i]) > 5e-3) {
+        // LCOV_EXCL_START
+        printf("[%" CeedInt_FMT "] Error in inverse: %e != %e\n", i, w_array[i], u_array[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(u, &u_array);
+    CeedVectorRestoreArrayRead(w, &w_array);
+  }
+
+  // Cleanup
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&q_data);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&w);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_x);
+  CeedBasisDestroy(&basis_u);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_apply);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_apply);
+  CeedOperatorDestroy(&op_inverse);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,55 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#include <ceed/types.h>
+
+CEED_QFUNCTION(setup)(void *ctx, const CeedInt Q, const CeedScalar *const *in, CeedScalar *const *out) {
+  // in[0] is Jacobians with shape [2, nc=2, Q]
+  // in[1] is quadrature weights, size (Q)
+  const CeedScalar *J = in[0], *w = in[1];
+
+  // out[0] is qdata, size (4*Q)
+  CeedScalar *q_data = out[0];
+
+  // Quadrature point loop
+  CeedPragmaSIMD for (CeedInt i = 0; i < Q; i++) {
+    // Qdata stored as mass followed by diffusion in Voigt convention
+    const CeedScalar J11 = J[i + Q * 0];
+    const CeedScalar J21 = J[i + Q * 1];
+    const CeedScalar J12 = J[i + Q * 2];
+    const CeedScalar J22 = J[i + Q * 3];
+    const CeedScalar det = J11 * J22 - J21 * J12;
+    const CeedScalar qw  = w[i] / det;
+
+    q_data[i + Q * 0] = w[i] * det;
+    q_data[i + Q * 1] = qw * (J12 * J12 + J22 * J22);
+    q_data[i + Q * 2] = qw * (J11 * J11 + J21 * J21);
+    q_data[i + Q * 3] = -qw * (J11 * J12 + J21 * J22);
+  }  // End of Quadrature Point Loop
+  return 0;
+}
+
+CEED_QFUNCTION(apply)(void *ctx, const CeedInt Q, const CeedScalar *const *in, CeedScalar *const *out) {
+  // in[0] is u, size (Q)
+  // in[1] is gradient u, shape [2, nc=1, Q]
+  // in[2] is quadrature data, size (4*Q)
+  const CeedScalar *u = in[0], *ug = in[1], *q_data = in[2];
+
+  // out[0] is output to multiply against v, size (Q)
+  // out[1] is output to multiply against gradient v, shape [2, nc=1, Q]
+  CeedScalar *v = out[0], *vg = out[1];
+
+  // Quadrature point loop
+  CeedPragmaSIMD for (CeedInt i = 0; i < Q; i++) {
+    const CeedScalar du[2] = {ug[i + Q * 0], ug[i + Q * 1]};
+
+    v[i]          = q_data[i + Q * 0] * u[i];
+    vg[i + Q * 0] = du[0] * q_data[i + Q * 1] + du[1] * q_data[i + Q * 3];
+    vg[i + Q * 1] = du[0] * q_data[i + Q * 3] + du[1] * q_data[i + Q * 2];
+  }  // End of Quadrature Point Loop
+  return 0;
+}
@@ -0,0 +1,159 @@
+/// @file
+/// Test creation, action, and destruction for mass matrix operator with multigrid hierarchy, tensor basis and interpolation basis generation
+/// \test Test creation, action, and destruction for mass matrix operator with multigrid hierarchy, tensor basis and interpolation basis generation
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "t502-operator.h"
+
+#define NUM_LEVELS 3
+
+static CeedScalar SumArray(CeedVector vec) {
+  CeedSize          length;
+  CeedScalar        sum = 0.;
+  const CeedScalar *array;
+
+  CeedVectorGetLength(vec, &length);
+  CeedVectorGetArrayRead(vec, CEED_MEM_HOST, &array);
+  for (CeedSize i = 0; i < length; i++) sum += array[i];
+  CeedVectorRestoreArrayRead(vec, &array);
+  return sum;
+}
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x, elem_restriction_q_data, elem_restriction_u[NUM_LEVELS + 1];
+  CeedBasis           basis_x, basis_u[NUM_LEVELS + 1];
+  CeedQFunction       qf_setup, qf_mass;
+  CeedOperator        op_setup, op_mass_fine, op_mass_coarse[NUM_LEVELS], op_prolong[NUM_LEVELS], op_restrict[NUM_LEVELS];
+  CeedVector          q_data, x, u[NUM_LEVELS + 1], v[NUM_LEVELS + 1], p_mult[NUM_LEVELS];
+  CeedInt             num_elem = 15, p[NUM_LEVELS + 1] = {7, 5, 3, 2}, q = 8, num_comp = 2;
+  CeedInt             num_dofs_x = num_elem + 1, num_dofs_u[NUM_LEVELS + 1], ind_x[num_elem * 2];
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, num_dofs_x, &x);
+  {
+    CeedScalar x_array[num_dofs_x];
+
+    for (CeedInt i = 0; i < num_dofs_x; i++) x_array[i] = (CeedScalar)i / (num_dofs_x - 1);
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedVectorCreate(ceed, num_elem * q, &q_data);
+
+  // Restrictions
+  for (CeedInt i = 0; i < num_elem; i++) {
+    ind_x[2 * i + 0] = i;
+    ind_x[2 * i + 1] = i + 1;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_dofs_x, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+
+  for (CeedInt l = 0; l < NUM_LEVELS + 1; l++) {
+    CeedInt ind_u[num_elem * p[l]];
+
+    num_dofs_u[l] = num_elem * (p[l] - 1) + 1;
+    for (CeedInt i = 0; i < num_elem; i++) {
+      for (CeedInt j = 0; j < p[l]; j++) ind_u[p[l] * i + j] = i * (p[l] - 1) + j;
+    }
+    CeedElemRestrictionCreate(ceed, num_elem, p[l], num_comp, num_dofs_u[l], num_comp * num_dofs_u[l], CEED_MEM_HOST, CEED_COPY_VALUES, ind_u,
+                              &elem_restriction_u[l]);
+    CeedVectorCreate(ceed, num_comp * num_dofs_u[l], &u[l]);
+    CeedVectorCreate(ceed, num_comp * num_dofs_u[l], &v[l]);
+    if (l < NUM_LEVELS) {
+      CeedVectorCreate(ceed, num_comp * num_dofs_u[l], &p_mult[l]);
+      CeedVectorSetValue(p_mult[l], 1.0);
+    }
+  }
+
+  CeedInt strides_q_data[3] = {1, q, q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q, 1, q * num_elem, strides_q_data, &elem_restriction_q_data);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, q, CEED_GAUSS, &basis_x);
+  for (CeedInt l = 0; l < NUM_LEVELS + 1; l++) CeedBasisCreateTensorH1Lagrange(ceed, 1, num_comp, p[l], q, CEED_GAUSS, &basis_u[l]);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1 * 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "q data", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "q data", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", num_comp, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", num_comp, CEED_EVAL_INTERP);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "q data", elem_restriction_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass_fine);
+  CeedOperatorSetField(op_mass_fine, "q data", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_mass_fine, "u", elem_restriction_u[0], basis_u[0], CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass_fine, "v", elem_restriction_u[0], basis_u[0], CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_setup, x, q_data, CEED_REQUEST_IMMEDIATE);
+
+  // Create multigrid hierarchy
+  CeedOperatorMultigridHierarchyCreate(op_mass_fine, NUM_LEVELS, p_mult, &elem_restriction_u[1], &basis_u[1], op_mass_coarse, op_prolong,
+                                       op_restrict);
+
+  // Coarse problems
+  for (CeedInt l = 0; l < NUM_LEVELS; l++) {
+    CeedScalar sum;
+
+    CeedVectorSetValue(u[l + 1], 1.0);
+    CeedOperatorApply(op_mass_coarse[l], u[l + 1], v[l + 1], CEED_REQUEST_IMMEDIATE);
+    sum = SumArray(v[l + 1]);
+    if (fabs(sum - 2.) > 1000. * CEED_EPSILON) printf("Computed Area Coarse Grid %" CeedInt_FMT ": %f != True Area: 2.0\n", l + 1, sum);
+  }
+
+  // Prolong coarsest u through the hierarchy
+  for (CeedInt l = NUM_LEVELS - 1; l >= 0; l--) CeedOperatorApply(op_prolong[l], u[l + 1], u[l], CEED_REQUEST_IMMEDIATE);
+
+  // Fine problem
+  CeedOperatorApply(op_mass_fine, u[0], v[0], CEED_REQUEST_IMMEDIATE);
+  {
+    CeedScalar sum = SumArray(v[0]);
+
+    if (fabs(sum - 2.) > 1000. * CEED_EPSILON) printf("Computed Area Fine Grid: %f != True Area: 2.0\n", sum);
+  }
+
+  // Restrict state through the hierarchy
+  for (CeedInt l = 0; l < NUM_LEVELS; l++) {
+    CeedScalar sum;
+
+    CeedOperatorApply(op_restrict[l], v[l], v[l + 1], CEED_REQUEST_IMMEDIATE);
+    sum = SumArray(v[l + 1]);
+    if (fabs(sum - 2.) > 1000. * CEED_EPSILON) printf("Computed Area Restricted Grid %" CeedInt_FMT ": %f != True Area: 2.0\n", l + 1, sum);
+  }
+
+  // Cleanup
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&q_data);
+  for (CeedInt l = 0; l < NUM_LEVELS + 1; l++) {
+    CeedVectorDestroy(&u[l]);
+    CeedVectorDestroy(&v[l]);
+    CeedElemRestrictionDestroy(&elem_restriction_u[l]);
+    CeedBasisDestroy(&basis_u[l]);
+  }
+  for (CeedInt l = 0; l < NUM_LEVELS; l++) {
+    CeedVectorDestroy(&p_mult[l]);
+    CeedOperatorDestroy(&op_mass_coarse[l]);
+    CeedOperatorDestroy(&op_prolong[l]);
+    CeedOperatorDestroy(&op_restrict[l]);
+  }
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_x);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass_fine);
+  CeedDestroy(&ceed);
+  return 0;
+}
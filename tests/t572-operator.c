@@ -0,0 +1,131 @@
+/// @file
+/// Test full assembly of non-symmetric 3D operator with interpolation and gradient inputs and outputs
+/// \test Test full assembly of non-symmetric 3D operator with interpolation and gradient inputs and outputs
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "t572-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_u;
+  CeedBasis           basis_u;
+  CeedQFunction       qf_apply;
+  CeedOperator        op_apply;
+  CeedVector          u, v;
+  CeedInt             n = 3, p = 3, q = 4, dim = 3, num_elem = n * n * n, num_dofs_1d = n * (p - 1) + 1;
+  CeedInt             num_dofs = num_dofs_1d * num_dofs_1d * num_dofs_1d, elem_size = p * p * p;
+  CeedInt             ind_u[num_elem * elem_size];
+  CeedScalar         *assembled_values = malloc(num_dofs * num_dofs * sizeof(CeedScalar));
+  CeedScalar         *assembled_true   = malloc(num_dofs * num_dofs * sizeof(CeedScalar));
+
+  CeedInit(argv[1], &ceed);
+
+  // Vectors
+  CeedVectorCreate(ceed, num_dofs, &u);
+  CeedVectorCreate(ceed, num_dofs, &v);
+
+  // Restriction
+  for (CeedInt e = 0; e < num_elem; e++) {
+    const CeedInt e_x = e % n, e_y = (e / n) % n, e_z = e / (n * n);
+
+    for (CeedInt k = 0; k < p; k++) {
+      for (CeedInt j = 0; j < p; j++) {
+        for (CeedInt i = 0; i < p; i++) {
+          ind_u[e * elem_size + (k * p + j) * p + i] =
+              ((e_z * (p - 1) + k) * num_dofs_1d + e_y * (p - 1) + j) * num_dofs_1d + e_x * (p - 1) + i;
+        }
+      }
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, elem_size, 1, 1, num_dofs, CEED_MEM_HOST, CEED_USE_POINTER, ind_u, &elem_restriction_u);
+
+  // Basis
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, 1, p, q, CEED_GAUSS, &basis_u);
+
+  // QFunction
+  CeedQFunctionCreateInterior(ceed, 1, apply, apply_loc, &qf_apply);
+  CeedQFunctionAddInput(qf_apply, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddInput(qf_apply, "du", dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_apply, "v", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_apply, "dv", dim, CEED_EVAL_GRAD);
+
+  // Operator
+  CeedOperatorCreate(ceed, qf_apply, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_apply);
+  CeedOperatorSetField(op_apply, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_apply, "du", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_apply, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_apply, "dv", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  // Fully assemble operator
+  CeedSize   num_entries;
+  CeedInt   *rows;
+  CeedInt   *cols;
+  CeedVector assembled;
+
+  for (CeedInt k = 0; k < num_dofs * num_dofs; ++k) {
+    assembled_values[k] = 0.0;
+    assembled_true[k]   = 0.0;
+  }
+  CeedOperatorLinearAssembleSymbolic(op_apply, &num_entries, &rows, &cols);
+  CeedVectorCreate(ceed, num_entries, &assembled);
+  CeedOperatorLinearAssemble(op_apply, assembled);
+  {
+    const CeedScalar *assembled_array;
+
+    CeedVectorGetArrayRead(assembled, CEED_MEM_HOST, &assembled_array);
+    for (CeedInt k = 0; k < num_entries; ++k) assembled_values[rows[k] * num_dofs + cols[k]] += assembled_array[k];
+    CeedVectorRestoreArrayRead(assembled, &assembled_array);
+  }
+
+  // Manually assemble operator
+  CeedVectorSetValue(u, 0.0);
+  for (CeedInt j = 0; j < num_dofs; j++) {
+    CeedScalar       *u_array;
+    const CeedScalar *v_array;
+
+    // Set input
+    CeedVectorGetArray(u, CEED_MEM_HOST, &u_array);
+    u_array[j] = 1.0;
+    if (j) u_array[j - 1] = 0.0;
+    CeedVectorRestoreArray(u, &u_array);
+
+    // Compute entries for column j
+    CeedOperatorApply(op_apply, u, v, CEED_REQUEST_IMMEDIATE);
+
+    CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+    for (CeedInt i = 0; i < num_dofs; i++) assembled_true[i * num_dofs + j] = v_array[i];
+    CeedVectorRestoreArrayRead(v, &v_array);
+  }
+
+  // Check output
+  for (CeedInt i = 0; i < num_dofs; i++) {
+    for (CeedInt j = 0; j < num_dofs; j++) {
+      const CeedScalar tol = 100. * CEED_EPSILON * fmax(1.0, fabs(assembled_true[i * num_dofs + j]));
+
+      if (fabs(assembled_values[i * num_dofs + j] - assembled_true[i * num_dofs + j]) > tol) {
+        // LCOV_EXCL_START
+        printf("[%" CeedInt_FMT ", %" CeedInt_FMT "] Error in assembly: %f != %f\n", i, j, assembled_values[i * num_dofs + j],
+               assembled_true[i * num_dofs + j]);
+        // LCOV_EXCL_STOP
+      }
+    }
+  }
+
+  // Cleanup
+  free(rows);
+  free(cols);
+  free(assembled_values);
+  free(assembled_true);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&assembled);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedBasisDestroy(&basis_u);
+  CeedQFunctionDestroy(&qf_apply);
+  CeedOperatorDestroy(&op_apply);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,137 @@
+/// @file
+/// Test assembly of non-symmetric 3D operator diagonal and point block diagonal with interpolation and gradient inputs and outputs
+/// \test Test assembly of non-symmetric 3D operator diagonal and point block diagonal with interpolation and gradient inputs and outputs
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "t573-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_u, elem_restriction_scale;
+  CeedBasis           basis_u;
+  CeedQFunction       qf_apply;
+  CeedOperator        op_apply;
+  CeedVector          scale, assembled_diag, assembled_point_block_diag, assembled;
+  CeedInt             n_x = 7, n_y = 7, n_z = 6, p = 3, q = 4, dim = 3, num_comp = 2, num_elem = n_x * n_y * n_z, elem_size = p * p * p;
+  CeedInt             num_dofs_x = n_x * (p - 1) + 1, num_dofs_y = n_y * (p - 1) + 1, num_dofs = num_dofs_x * num_dofs_y * (n_z * (p - 1) + 1);
+  CeedInt            *ind_u           = malloc(num_elem * elem_size * sizeof(CeedInt));
+  CeedScalar         *diag_true       = calloc(num_comp * num_dofs, sizeof(CeedScalar));
+  CeedScalar         *point_block_true = calloc(num_comp * num_comp * num_dofs, sizeof(CeedScalar));
+
+  CeedInit(argv[1], &ceed);
+
+  // Pointwise scaling, varying by element
+  {
+    CeedInt    strides_scale[3] = {1, q * q * q, q * q * q};
+    CeedScalar scale_array[num_elem * q * q * q];
+
+    for (CeedInt i = 0; i < num_elem * q * q * q; i++) scale_array[i] = 1.0 + 0.5 * sin(0.1 * i);
+    CeedVectorCreate(ceed, num_elem * q * q * q, &scale);
+    CeedVectorSetArray(scale, CEED_MEM_HOST, CEED_COPY_VALUES, scale_array);
+    CeedElemRestrictionCreateStrided(ceed, num_elem, q * q * q, 1, num_elem * q * q * q, strides_scale, &elem_restriction_scale);
+  }
+
+  // Restriction
+  for (CeedInt e = 0; e < num_elem; e++) {
+    const CeedInt e_x = e % n_x, e_y = (e / n_x) % n_y, e_z = e / (n_x * n_y);
+
+    for (CeedInt k = 0; k < p; k++) {
+      for (CeedInt j = 0; j < p; j++) {
+        for (CeedInt i = 0; i < p; i++) {
+          ind_u[e * elem_size + (k * p + j) * p + i] = ((e_z * (p - 1) + k) * num_dofs_y + e_y * (p - 1) + j) * num_dofs_x + e_x * (p - 1) + i;
+        }
+      }
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, elem_size, num_comp, num_dofs, num_comp * num_dofs, CEED_MEM_HOST, CEED_USE_POINTER, ind_u,
+                            &elem_restriction_u);
+
+  // Basis
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, num_comp, p, q, CEED_GAUSS, &basis_u);
+
+  // QFunction
+  CeedQFunctionCreateInterior(ceed, 1, apply, apply_loc, &qf_apply);
+  CeedQFunctionAddInput(qf_apply, "u", num_comp, CEED_EVAL_INTERP);
+  CeedQFunctionAddInput(qf_apply, "du", num_comp * dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddInput(qf_apply, "scale", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddOutput(qf_apply, "v", num_comp, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_apply, "dv", num_comp * dim, CEED_EVAL_GRAD);
+
+  // Operator
+  CeedOperatorCreate(ceed, qf_apply, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_apply);
+  CeedOperatorSetField(op_apply, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_apply, "du", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_apply, "scale", elem_restriction_scale, CEED_BASIS_NONE, scale);
+  CeedOperatorSetField(op_apply, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_apply, "dv", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  // Assemble diagonal and point block diagonal
+  CeedVectorCreate(ceed, num_comp * num_dofs, &assembled_diag);
+  CeedOperatorLinearAssembleDiagonal(op_apply, assembled_diag, CEED_REQUEST_IMMEDIATE);
+  CeedVectorCreate(ceed, num_comp * num_comp * num_dofs, &assembled_point_block_diag);
+  CeedOperatorLinearAssemblePointBlockDiagonal(op_apply, assembled_point_block_diag, CEED_REQUEST_IMMEDIATE);
+
+  // Extract true diagonal and point block diagonal from full assembly
+  {
+    CeedSize          num_entries;
+    CeedInt          *rows, *cols;
+    const CeedScalar *assembled_array;
+
+    CeedOperatorLinearAssembleSymbolic(op_apply, &num_entries, &rows, &cols);
+    CeedVectorCreate(ceed, num_entries, &assembled);
+    CeedOperatorLinearAssemble(op_apply, assembled);
+    CeedVectorGetArrayRead(assembled, CEED_MEM_HOST, &assembled_array);
+    for (CeedSize k = 0; k < num_entries; k++) {
+      const CeedInt node = rows[k] % num_dofs, c_out = rows[k] / num_dofs, c_in = cols[k] / num_dofs;
+
+      if (rows[k] == cols[k]) diag_true[rows[k]] += assembled_array[k];
+      if (node == cols[k] % num_dofs) point_block_true[(node * num_comp + c_out) * num_comp + c_in] += assembled_array[k];
+    }
+    CeedVectorRestoreArrayRead(assembled, &assembled_array);
+    free(rows);
+    free(cols);
+  }
+
+  // Check output
+  {
+    const CeedScalar *assembled_array;
+
+    CeedVectorGetArrayRead(assembled_diag, CEED_MEM_HOST, &assembled_array);
+    for (CeedInt i = 0; i < num_comp * num_dofs; i++) {
+      if (fabs(assembled_array[i] - diag_true[i]) > 100. * CEED_EPSILON * fmax(1.0, fabs(diag_true[i]))) {
+        // LCOV_EXCL_START
+        printf("[%" CeedInt_FMT "] Error in diagonal assembly: %f != %f\n", i, assembled_array[i], diag_true[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(assembled_diag, &assembled_array);
+    CeedVectorGetArrayRead(assembled_point_block_diag, CEED_MEM_HOST, &assembled_array);
+    for (CeedInt i = 0; i < num_comp * num_comp * num_dofs; i++) {
+      if (fabs(assembled_array[i] - point_block_true[i]) > 100. * CEED_EPSILON * fmax(1.0, fabs(point_block_true[i]))) {
+        // LCOV_EXCL_START
+        printf("[%" CeedInt_FMT "] Error in point block diagonal assembly: %f != %f\n", i, assembled_array[i], point_block_true[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(assembled_point_block_diag, &assembled_array);
+  }
+
+  // Cleanup
+  free(ind_u);
+  free(diag_true);
+  free(point_block_true);
+  CeedVectorDestroy(&scale);
+  CeedVectorDestroy(&assembled_diag);
+  CeedVectorDestroy(&assembled_point_block_diag);
+  CeedVectorDestroy(&assembled);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_scale);
+  CeedBasisDestroy(&basis_u);
+  CeedQFunctionDestroy(&qf_apply);
+  CeedOperatorDestroy(&op_apply);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,24 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#include <ceed/types.h>
+
+// Non-symmetric coupling of two components and their reference gradients, scaled pointwise
+CEED_QFUNCTION(apply)(void *ctx, const CeedInt Q, const CeedScalar *const *in, CeedScalar *const *out) {
+  const CeedScalar(*u)[CEED_Q_VLA] = (const CeedScalar(*)[CEED_Q_VLA])in[0], (*du)[CEED_Q_VLA] = (const CeedScalar(*)[CEED_Q_VLA])in[1];
+  const CeedScalar *scale = in[2];
+  CeedScalar(*v)[CEED_Q_VLA] = (CeedScalar(*)[CEED_Q_VLA])out[0], (*dv)[CEED_Q_VLA] = (CeedScalar(*)[CEED_Q_VLA])out[1];
+
+  for (CeedInt i = 0; i < Q; i++) {
+    v[0][i] = scale[i] * (2.0 * u[0][i] + 0.5 * u[1][i] + 0.3 * du[0][i]);
+    v[1][i] = scale[i] * (-0.4 * u[0][i] + 1.5 * u[1][i] + 0.2 * du[4][i]);
+    for (CeedInt j = 0; j < 6; j++) {
+      dv[j][i] = scale[i] * ((1.0 + 0.1 * j) * du[j][i] + 0.2 * du[(j + 1) % 6][i] - 0.15 * du[(j + 3) % 6][i] + 0.05 * (j + 1) * u[j % 2][i]);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,144 @@
+/// @file
+/// Test diagonal and full assembly of operator with symmetric and zero block hints on QFunction linearization
+/// \test Test diagonal and full assembly of operator with symmetric and zero block hints on QFunction linearization
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "t574-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_u, elem_restriction_scale;
+  CeedBasis           basis_u;
+  CeedQFunction       qf_apply, qf_apply_hints;
+  CeedOperator        op_apply, op_apply_hints;
+  CeedVector          scale, diag, diag_hints, assembled, assembled_hints;
+  CeedInt             n = 3, p = 3, q = 4, dim = 3, num_elem = n * n * n, num_dofs_1d = n * (p - 1) + 1, num_qpts = q * q * q;
+  CeedInt             num_dofs = num_dofs_1d * num_dofs_1d * num_dofs_1d, elem_size = p * p * p;
+  CeedInt             ind_u[num_elem * elem_size];
+
+  CeedInit(argv[1], &ceed);
+
+  // Restrictions
+  for (CeedInt e = 0; e < num_elem; e++) {
+    const CeedInt e_x = e % n, e_y = (e / n) % n, e_z = e / (n * n);
+
+    for (CeedInt k = 0; k < p; k++) {
+      for (CeedInt j = 0; j < p; j++) {
+        for (CeedInt i = 0; i < p; i++) {
+          ind_u[e * elem_size + (k * p + j) * p + i] =
+              ((e_z * (p - 1) + k) * num_dofs_1d + e_y * (p - 1) + j) * num_dofs_1d + e_x * (p - 1) + i;
+        }
+      }
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, elem_size, 1, 1, num_dofs, CEED_MEM_HOST, CEED_USE_POINTER, ind_u, &elem_restriction_u);
+  {
+    CeedInt    strides_scale[3] = {1, num_qpts, num_qpts};
+    CeedScalar scale_array[num_elem * num_qpts];
+
+    for (CeedInt i = 0; i < num_elem * num_qpts; i++) scale_array[i] = 1.0 + 0.5 * sin(0.1 * i);
+    CeedVectorCreate(ceed, num_elem * num_qpts, &scale);
+    CeedVectorSetArray(scale, CEED_MEM_HOST, CEED_COPY_VALUES, scale_array);
+    CeedElemRestrictionCreateStrided(ceed, num_elem, num_qpts, 1, num_elem * num_qpts, strides_scale, &elem_restriction_scale);
+  }
+
+  // Basis
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, 1, p, q, CEED_GAUSS, &basis_u);
+
+  // QFunctions, with and without hints
+  CeedQFunctionCreateInterior(ceed, 1, apply, apply_loc, &qf_apply);
+  CeedQFunctionCreateInterior(ceed, 1, apply, apply_loc, &qf_apply_hints);
+  for (CeedInt i = 0; i < 2; i++) {
+    CeedQFunction qf = i ? qf_apply_hints : qf_apply;
+
+    CeedQFunctionAddInput(qf, "u", 1, CEED_EVAL_INTERP);
+    CeedQFunctionAddInput(qf, "du", dim, CEED_EVAL_GRAD);
+    CeedQFunctionAddInput(qf, "scale", 1, CEED_EVAL_NONE);
+    CeedQFunctionAddOutput(qf, "v", 1, CEED_EVAL_INTERP);
+    CeedQFunctionAddOutput(qf, "dv", dim, CEED_EVAL_GRAD);
+  }
+  CeedQFunctionSetAssemblySymmetric(qf_apply_hints, true);
+  CeedQFunctionSetAssemblyZeroBlock(qf_apply_hints, "u", "dv");
+  CeedQFunctionSetAssemblyZeroBlock(qf_apply_hints, "du", "v");
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_apply, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_apply);
+  CeedOperatorCreate(ceed, qf_apply_hints, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_apply_hints);
+  for (CeedInt i = 0; i < 2; i++) {
+    CeedOperator op = i ? op_apply_hints : op_apply;
+
+    CeedOperatorSetField(op, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op, "du", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op, "scale", elem_restriction_scale, CEED_BASIS_NONE, scale);
+    CeedOperatorSetField(op, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op, "dv", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  }
+  CeedOperatorSetQFunctionAssemblyReuse(op_apply_hints, true);
+
+  // Assemble diagonal
+  CeedVectorCreate(ceed, num_dofs, &diag);
+  CeedVectorCreate(ceed, num_dofs, &diag_hints);
+  CeedOperatorLinearAssembleDiagonal(op_apply, diag, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorLinearAssembleDiagonal(op_apply_hints, diag_hints, CEED_REQUEST_IMMEDIATE);
+  {
+    const CeedScalar *diag_array, *diag_hints_array;
+
+    CeedVectorGetArrayRead(diag, CEED_MEM_HOST, &diag_array);
+    CeedVectorGetArrayRead(diag_hints, CEED_MEM_HOST, &diag_hints_array);
+    for (CeedInt i = 0; i < num_dofs; i++) {
+      if (fabs(diag_array[i] - diag_hints_array[i]) > 100. * CEED_EPSILON * fmax(1.0, fabs(diag_array[i]))) {
+        // LCOV_EXCL_START
+        printf("[%" CeedInt_FMT "] Error in diagonal assembly: %f != %f\n", i, diag_hints_array[i], diag_array[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(diag, &diag_array);
+    CeedVectorRestoreArrayRead(diag_hints, &diag_hints_array);
+  }
+
+  // Fully assemble operator, reusing the stored entries
+  CeedSize num_entries;
+  CeedInt *rows, *cols;
+
+  CeedOperatorLinearAssembleSymbolic(op_apply, &num_entries, &rows, &cols);
+  CeedVectorCreate(ceed, num_entries, &assembled);
+  CeedVectorCreate(ceed, num_entries, &assembled_hints);
+  CeedOperatorLinearAssemble(op_apply, assembled);
+  CeedOperatorLinearAssemble(op_apply_hints, assembled_hints);
+  {
+    const CeedScalar *assembled_array, *assembled_hints_array;
+
+    CeedVectorGetArrayRead(assembled, CEED_MEM_HOST, &assembled_array);
+    CeedVectorGetArrayRead(assembled_hints, CEED_MEM_HOST, &assembled_hints_array);
+    for (CeedSize i = 0; i < num_entries; i++) {
+      if (fabs(assembled_array[i] - assembled_hints_array[i]) > 100. * CEED_EPSILON * fmax(1.0, fabs(assembled_array[i]))) {
+        // LCOV_EXCL_START
+        printf("[%" CeedInt_FMT ", %" CeedInt_FMT "] Error in assembly: %f != %f\n", rows[i], cols[i], assembled_hints_array[i], assembled_array[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(assembled, &assembled_array);
+    CeedVectorRestoreArrayRead(assembled_hints, &assembled_hints_array);
+  }
+
+  // Cleanup
+  free(rows);
+  free(cols);
+  CeedVectorDestroy(&scale);
+  CeedVectorDestroy(&diag);
+  CeedVectorDestroy(&diag_hints);
+  CeedVectorDestroy(&assembled);
+  CeedVectorDestroy(&assembled_hints);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_scale);
+  CeedBasisDestroy(&basis_u);
+  CeedQFunctionDestroy(&qf_apply);
+  CeedQFunctionDestroy(&qf_apply_hints);
+  CeedOperatorDestroy(&op_apply);
+  CeedOperatorDestroy(&op_apply_hints);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,22 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#include <ceed/types.h>
+
+// Symmetric mass and anisotropic diffusion, with no coupling between values and gradients
+CEED_QFUNCTION(apply)(void *ctx, const CeedInt Q, const CeedScalar *const *in, CeedScalar *const *out) {
+  const CeedScalar *u = in[0], (*du)[CEED_Q_VLA] = (const CeedScalar(*)[CEED_Q_VLA])in[1], *scale = in[2];
+  CeedScalar       *v = out[0], (*dv)[CEED_Q_VLA] = (CeedScalar(*)[CEED_Q_VLA])out[1];
+
+  for (CeedInt i = 0; i < Q; i++) {
+    v[i]     = 2.0 * scale[i] * u[i];
+    dv[0][i] = scale[i] * (1.0 * du[0][i] + 0.2 * du[1][i] - 0.1 * du[2][i]);
+    dv[1][i] = scale[i] * (0.2 * du[0][i] + 1.5 * du[1][i] + 0.3 * du[2][i]);
+    dv[2][i] = scale[i] * (-0.1 * du[0][i] + 0.3 * du[1][i] + 0.8 * du[2][i]);
+  }
+  return 0;
+}
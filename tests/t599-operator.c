@@ -0,0 +1,93 @@
+/// @file
+/// Test mass matrix operator with QFunction data stored in single precision
+/// \test Test mass matrix operator with QFunction data stored in single precision
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "t500-operator.h"
+
+#define NUM_ELEM 15
+#define P 5
+#define Q 8
+#define NUM_NODES_U (NUM_ELEM * (P - 1) + 1)
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_u, elem_restriction_q_data;
+  CeedBasis           basis_u;
+  CeedQFunction       qf_mass;
+  CeedOperator        op_mass;
+  CeedVector          q_data, u, v;
+  CeedInt             ind_u[NUM_ELEM * P];
+  char                resource[256];
+  const bool          is_mixed = !strncmp(argv[1], "/cpu/self/opt", 13);
+
+  // Only the opt backends store passive inputs in single precision
+  if (is_mixed) snprintf(resource, sizeof(resource), "%s:mixed_precision=1", argv[1]);
+  else snprintf(resource, sizeof(resource), "%s", argv[1]);
+  CeedInit(resource, &ceed);
+
+  CeedVectorCreate(ceed, NUM_NODES_U, &u);
+  CeedVectorSetValue(u, 1.0);
+  CeedVectorCreate(ceed, NUM_NODES_U, &v);
+  CeedVectorCreate(ceed, NUM_ELEM * Q, &q_data);
+
+  // Restrictions
+  for (CeedInt i = 0; i < NUM_ELEM; i++) {
+    for (CeedInt j = 0; j < P; j++) ind_u[P * i + j] = i * (P - 1) + j;
+  }
+  CeedElemRestrictionCreate(ceed, NUM_ELEM, P, 1, 1, NUM_NODES_U, CEED_MEM_HOST, CEED_USE_POINTER, ind_u, &elem_restriction_u);
+
+  CeedInt strides_q_data[3] = {1, Q, Q};
+  CeedElemRestrictionCreateStrided(ceed, NUM_ELEM, Q, 1, Q * NUM_ELEM, strides_q_data, &elem_restriction_q_data);
+
+  // Basis
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &basis_u);
+
+  // QFunction
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  // Operator
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass);
+  CeedOperatorSetField(op_mass, "rho", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_mass, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  // Apply with QFunction data that single precision cannot represent, then apply again after the data changes
+  for (CeedInt k = 0; k < 2; k++) {
+    const CeedScalar  rho      = (k + 1) * (1.0 + ldexp(1.0, -30));
+    const CeedScalar  rho_true = is_mixed ? (CeedScalar)(float)rho : rho;
+    const CeedScalar *v_array;
+    CeedScalar        sum = 0.0;
+
+    CeedVectorSetValue(q_data, rho);
+    CeedOperatorApply(op_mass, u, v, CEED_REQUEST_IMMEDIATE);
+
+    // The interpolation of u = 1 is 1 at every quadrature point, so v sums to the QFunction data over all points
+    CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+    for (CeedInt i = 0; i < NUM_NODES_U; i++) sum += v_array[i];
+    CeedVectorRestoreArrayRead(v, &v_array);
+    if (fabs(sum - rho_true * NUM_ELEM * Q) > 100. * CEED_EPSILON * NUM_ELEM * Q) {
+      // LCOV_EXCL_START
+      printf("Error in apply %" CeedInt_FMT ": sum %.17g != %.17g\n", k, sum, rho_true * NUM_ELEM * Q);
+      // LCOV_EXCL_STOP
+    }
+  }
+
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&q_data);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_u);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_mass);
+  CeedDestroy(&ceed);
+  return 0;
+}